@@ -0,0 +1,82 @@
+#include "benchmark.hpp"
+
+#include "saturn_fixture.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace ymir;
+
+namespace {
+
+constexpr uint32 kAccessesPerBatch = 4096;
+
+struct Region {
+    const char *name;
+    uint32 address;
+    uint32 size;
+    bool writable;
+};
+
+constexpr Region kRegions[] = {
+    {"ipl", 0x000'0000, 0x8'0000, false},       //
+    {"wram_low", 0x020'0000, 0x10'0000, true},  //
+    {"scsp_ram", 0x5A0'0000, 0x8'0000, true},   //
+    {"vdp1_vram", 0x5C0'0000, 0x8'0000, true},  //
+    {"vdp2_vram", 0x5E0'0000, 0x8'0000, true},  //
+    {"vdp2_cram", 0x5F0'0000, 0x1000, true},    //
+    {"wram_high", 0x600'0000, 0x10'0000, true}, //
+};
+
+// Strides through the region so that consecutive accesses land on different cache lines of the host.
+constexpr uint32 kStride = 0x44;
+
+Benchmark MakeReadBenchmark(const Region &region) {
+    return {
+        .name = std::string("bus/read32_") + region.name,
+        .unit = "access",
+        .setup =
+            [region] {
+                std::shared_ptr<Saturn> saturn = MakeSaturn();
+                return [saturn, region, offset = uint32{0}, sink = uint32{0}]() mutable {
+                    for (uint32 i = 0; i < kAccessesPerBatch; ++i) {
+                        sink += saturn->mainBus.Read<uint32>(region.address + offset);
+                        offset = (offset + kStride) & (region.size - 1) & ~3u;
+                    }
+                    // Keep the reads alive
+                    return uint64{kAccessesPerBatch} + (sink == 0x1234'5678 ? 1 : 0);
+                };
+            },
+    };
+}
+
+Benchmark MakeWriteBenchmark(const Region &region) {
+    return {
+        .name = std::string("bus/write32_") + region.name,
+        .unit = "access",
+        .setup =
+            [region] {
+                std::shared_ptr<Saturn> saturn = MakeSaturn();
+                return [saturn, region, offset = uint32{0}]() mutable {
+                    for (uint32 i = 0; i < kAccessesPerBatch; ++i) {
+                        saturn->mainBus.Write<uint32>(region.address + offset, i);
+                        offset = (offset + kStride) & (region.size - 1) & ~3u;
+                    }
+                    return uint64{kAccessesPerBatch};
+                };
+            },
+    };
+}
+
+} // namespace
+
+void AddBusBenchmarks(BenchmarkList &list) {
+    for (const Region &region : kRegions) {
+        list.push_back(MakeReadBenchmark(region));
+    }
+    for (const Region &region : kRegions) {
+        if (region.writable) {
+            list.push_back(MakeWriteBenchmark(region));
+        }
+    }
+}
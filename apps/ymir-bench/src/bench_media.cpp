@@ -0,0 +1,42 @@
+#include "benchmark.hpp"
+
+#include <ymir/media/cd_utils.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+
+using namespace ymir;
+
+namespace {
+
+constexpr uint32 kSectorsPerBatch = 256;
+
+Benchmark MakeSectorSynthesisBenchmark(std::string name, bool mode2) {
+    return {
+        .name = "media/" + std::move(name),
+        .unit = "sector",
+        .setup =
+            [mode2] {
+                auto sector = std::make_shared<std::array<uint8, 2352>>();
+                uint32 state = 0xDEADBEEF;
+                for (uint8 &byte : *sector) {
+                    state = state * 1664525u + 1013904223u;
+                    byte = state >> 24u;
+                }
+                return [sector, mode2] {
+                    for (uint32 fad = 150; fad < 150 + kSectorsPerBatch; ++fad) {
+                        media::SynthesizeSectorData(*sector, 2048, fad, 0x41, mode2);
+                    }
+                    return uint64{kSectorsPerBatch};
+                };
+            },
+    };
+}
+
+} // namespace
+
+void AddMediaBenchmarks(BenchmarkList &list) {
+    list.push_back(MakeSectorSynthesisBenchmark("synthesize_mode1", false));
+    list.push_back(MakeSectorSynthesisBenchmark("synthesize_mode2_form1", true));
+}
@@ -0,0 +1,52 @@
+#include "benchmark.hpp"
+
+#include "saturn_fixture.hpp"
+
+#include <ymir/savestate/savestate.hpp>
+
+#include <memory>
+
+using namespace ymir;
+
+namespace {
+
+struct SaveStateFixture {
+    std::unique_ptr<Saturn> saturn = MakeSaturn();
+    savestate::SaveState state{};
+
+    SaveStateFixture() {
+        FillRandom(*saturn, 0x0600'0000, 0x10'0000, 0x1111); // Work RAM High
+        FillRandom(*saturn, 0x05E0'0000, 0x8'0000, 0x2222);  // VDP2 VRAM
+        saturn->RunFrame();
+        saturn->SaveState(state);
+    }
+};
+
+} // namespace
+
+void AddSaveStateBenchmarks(BenchmarkList &list) {
+    list.push_back({
+        .name = "savestate/save",
+        .unit = "state",
+        .setup =
+            [] {
+                auto fixture = std::make_shared<SaveStateFixture>();
+                return [fixture] {
+                    fixture->saturn->SaveState(fixture->state);
+                    return uint64{1};
+                };
+            },
+    });
+    list.push_back({
+        .name = "savestate/load",
+        .unit = "state",
+        .setup =
+            [] {
+                auto fixture = std::make_shared<SaveStateFixture>();
+                return [fixture] {
+                    [[maybe_unused]] const bool loaded = fixture->saturn->LoadState(fixture->state);
+                    return uint64{1};
+                };
+            },
+    });
+}
@@ -0,0 +1,65 @@
+#include "benchmark.hpp"
+
+#include "saturn_fixture.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace ymir;
+
+namespace {
+
+constexpr uint32 kSoundRAM = 0x05A0'0000;
+constexpr uint32 kSCSPRegs = 0x05B0'0000;
+
+// Keys on a number of slots looping a sawtooth wave from sound RAM at slightly different pitches.
+void SetupSlots(Saturn &saturn, uint32 slotCount) {
+    auto write = [&](uint32 address, uint16 value) { saturn.mainBus.Write<uint16>(address, value); };
+
+    for (uint32 i = 0; i < 256; ++i) {
+        write(kSoundRAM + i * 2, static_cast<uint16>(i * 0x100 - 0x8000));
+    }
+
+    for (uint32 slot = 0; slot < slotCount; ++slot) {
+        const uint32 base = kSCSPRegs + slot * 0x20;
+        write(base + 0x02, 0x0000);                             // SA
+        write(base + 0x04, 0x0000);                             // LSA
+        write(base + 0x06, 256);                                // LEA
+        write(base + 0x08, 0x001F);                             // AR
+        write(base + 0x0A, 0x001F);                             // RR
+        write(base + 0x0C, 0x0020);                             // TL
+        write(base + 0x10, static_cast<uint16>(slot * 0x1F));   // OCT, FNS
+        write(base + 0x16, static_cast<uint16>(0xA000 | slot)); // DISDL, DIPAN
+    }
+    write(kSCSPRegs + 0x400, 0x000F); // MVOL
+    for (uint32 slot = 0; slot < slotCount; ++slot) {
+        write(kSCSPRegs + slot * 0x20, 0x0820); // KYONB, LPCTL
+    }
+    write(kSCSPRegs + 0x00, saturn.mainBus.Read<uint16>(kSCSPRegs + 0x00) | 0x1000); // KYONEX
+}
+
+Benchmark MakeSCSPBenchmark(std::string name, uint32 slotCount, uint32 stepGranularity) {
+    return {
+        .name = "scsp/" + std::move(name),
+        .unit = "frame",
+        .setup =
+            [=] {
+                std::shared_ptr<Saturn> saturn = MakeSaturn();
+                saturn->SCSP.SetStepGranularity(stepGranularity);
+                SetupSlots(*saturn, slotCount);
+                return [saturn] {
+                    saturn->RunFrame();
+                    return uint64{1};
+                };
+            },
+    };
+}
+
+} // namespace
+
+void AddSCSPBenchmarks(BenchmarkList &list) {
+    list.push_back(MakeSCSPBenchmark("slots_0", 0, 0));
+    list.push_back(MakeSCSPBenchmark("slots_8", 8, 0));
+    list.push_back(MakeSCSPBenchmark("slots_32", 32, 0));
+    list.push_back(MakeSCSPBenchmark("slots_32_per_slot_steps", 32, 5));
+}
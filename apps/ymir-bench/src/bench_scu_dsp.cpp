@@ -0,0 +1,63 @@
+#include "benchmark.hpp"
+
+#include <ymir/hw/scu/scu_dsp.hpp>
+
+#include <memory>
+
+using namespace ymir;
+
+namespace {
+
+// Runs a looping ALU and multiplier program on a standalone SCU DSP.
+struct SCUDSPFixture {
+    static constexpr uint64 kCyclesPerBatch = 200'000; // the DSP runs at half the main clock rate
+
+    sys::SH2Bus bus{};
+    scu::SCUDSP dsp{bus};
+
+    SCUDSPFixture() {
+        dsp.SetTriggerDSPEndCallback(util::MakeClassMemberRequiredCallback<&SCUDSPFixture::TriggerDSPEnd>(this));
+        dsp.Reset(true);
+
+        // clang-format off
+        static constexpr uint32 kProgram[] = {
+            0x1208'4000, // ADD  MOV M0,X  MOV M1,Y
+            0x1104'0000, // ADD  MOV MUL,P  MOV ALU,A
+            0x0640'0000, // AND  MOV MC0,X
+            0x0C04'1105, // XOR  MOV ALU,A  MOV #5,MC1
+            0x2004'0000, // SR   MOV ALU,A
+            0x1404'0000, // SUB  MOV ALU,A
+            0x1804'0000, // AD2  MOV ALU,A
+            0x3C04'0000, // RL8  MOV ALU,A
+            0xD000'0000, // JMP  0
+            0x0000'0000, // NOP
+        };
+        // clang-format on
+        for (uint32 i = 0; i < std::size(kProgram); ++i) {
+            dsp.programRAM[i].u32 = kProgram[i];
+        }
+        dsp.PC = 0;
+        dsp.programExecuting = true;
+    }
+
+    void TriggerDSPEnd() {}
+
+    uint64 Run() {
+        dsp.Run<false>(kCyclesPerBatch);
+        return kCyclesPerBatch / 2;
+    }
+};
+
+} // namespace
+
+void AddSCUDSPBenchmarks(BenchmarkList &list) {
+    list.push_back({
+        .name = "scu_dsp/alu_mul_loop",
+        .unit = "instr",
+        .setup =
+            [] {
+                auto fixture = std::make_shared<SCUDSPFixture>();
+                return [fixture] { return fixture->Run(); };
+            },
+    });
+}
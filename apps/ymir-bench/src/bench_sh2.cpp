@@ -0,0 +1,187 @@
+#include "benchmark.hpp"
+
+#include <ymir/hw/sh2/sh2.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <array>
+#include <memory>
+#include <span>
+
+using namespace ymir;
+
+namespace {
+
+// Runs a loop of instructions on a standalone SH-2 backed by 64 KiB of mirrored RAM.
+struct SH2Fixture {
+    static constexpr uint32 kRAMMask = 0xFFFF;
+    static constexpr uint32 kCodeAddress = 0x100;
+    static constexpr uint32 kStepsPerBatch = 100'000;
+
+    sys::SH2Bus bus{};
+    sh2::SH2 cpu{bus, true};
+    alignas(4) std::array<uint8, kRAMMask + 1> ram{};
+
+    SH2Fixture(std::span<const uint16> body, bool enableCache) {
+        bus.MapBoth(
+            0x000'0000, 0x7FF'FFFF, this,
+            [](uint32 address, void *ctx) -> uint8 { return static_cast<SH2Fixture *>(ctx)->ram[address & kRAMMask]; },
+            [](uint32 address, void *ctx) -> uint16 {
+                return util::ReadBE<uint16>(&static_cast<SH2Fixture *>(ctx)->ram[address & kRAMMask & ~1u]);
+            },
+            [](uint32 address, void *ctx) -> uint32 {
+                return util::ReadBE<uint32>(&static_cast<SH2Fixture *>(ctx)->ram[address & kRAMMask & ~3u]);
+            },
+            [](uint32 address, uint8 value, void *ctx) {
+                static_cast<SH2Fixture *>(ctx)->ram[address & kRAMMask] = value;
+            },
+            [](uint32 address, uint16 value, void *ctx) {
+                util::WriteBE<uint16>(&static_cast<SH2Fixture *>(ctx)->ram[address & kRAMMask & ~1u], value);
+            },
+            [](uint32 address, uint32 value, void *ctx) {
+                util::WriteBE<uint32>(&static_cast<SH2Fixture *>(ctx)->ram[address & kRAMMask & ~3u], value);
+            });
+
+        // Reset vectors
+        util::WriteBE<uint32>(&ram[0x0], kCodeAddress);
+        util::WriteBE<uint32>(&ram[0x4], 0x8000);
+
+        uint32 address = kCodeAddress;
+        auto emit = [&](uint16 instr) {
+            util::WriteBE<uint16>(&ram[address], instr);
+            address += sizeof(uint16);
+        };
+
+        // Prologue: R1..R7 = small constants, R8 = R9 = 0x4000 (data area)
+        static constexpr uint16 kPrologue[] = {0xE101, 0xE203, 0xE305, 0xE407, 0xE509, 0xE60B, 0xE70D,
+                                               0xE840, 0x4818, 0x6983};
+        for (uint16 instr : kPrologue) {
+            emit(instr);
+        }
+
+        const uint32 loopAddress = address;
+        for (uint16 instr : body) {
+            emit(instr);
+        }
+        // bra loop; nop
+        const sint32 disp = (static_cast<sint32>(loopAddress) - static_cast<sint32>(address + 4)) / 2;
+        emit(0xA000 | (disp & 0xFFF));
+        emit(0x0009);
+
+        cpu.Reset(true);
+        if (enableCache) {
+            // CCR.CE = 1
+            cpu.GetProbe().MemWriteByte(0xFFFF'FE92, 0x01, true);
+        }
+    }
+
+    template <bool emulateCache>
+    uint64 Run() {
+        for (uint32 i = 0; i < kStepsPerBatch; ++i) {
+            cpu.Step<false, emulateCache>();
+        }
+        return kStepsPerBatch;
+    }
+};
+
+// clang-format off
+constexpr uint16 kALUMix[] = {
+    0x321C, // add     r1, r2
+    0x3438, // sub     r3, r4
+    0x2529, // and     r2, r5
+    0x261B, // or      r1, r6
+    0x273A, // xor     r3, r7
+    0x4200, // shll    r2
+    0x4401, // shlr    r4
+    0x7901, // add     #1, r9
+    0x3210, // cmp/eq  r1, r2
+    0x6A29, // swap.w  r2, r10
+    0x6B37, // not     r3, r11
+    0x6C4B, // neg     r4, r12
+    0x2218, // tst     r1, r2
+    0x0D29, // movt    r13
+    0x4E10, // dt      r14
+    0x6523, // mov     r2, r5
+};
+
+constexpr uint16 kLoadStoreMix[] = {
+    0x5180, // mov.l   @(0,r8), r1
+    0x5281, // mov.l   @(4,r8), r2
+    0x1812, // mov.l   r1, @(8,r8)
+    0x1823, // mov.l   r2, @(12,r8)
+    0x6381, // mov.w   @r8, r3
+    0x6480, // mov.b   @r8, r4
+    0x2831, // mov.w   r3, @r8
+    0x2840, // mov.b   r4, @r8
+    0x6596, // mov.l   @r9+, r5
+    0x6596, // mov.l   @r9+, r5
+    0x5182, // mov.l   @(8,r8), r1
+    0x5283, // mov.l   @(12,r8), r2
+    0x1814, // mov.l   r1, @(16,r8)
+    0x1825, // mov.l   r2, @(20,r8)
+    0x6395, // mov.w   @r9+, r3
+    0x6496, // mov.l   @r9+, r4
+};
+
+constexpr uint16 kBranchMix[] = {
+    0x3110, // cmp/eq  r1, r1
+    0x8900, // bt      (taken)
+    0x8B00, // bf      (not taken)
+    0x3120, // cmp/eq  r2, r1
+    0x8900, // bt      (not taken)
+    0x8B00, // bf      (taken)
+    0x3110, // cmp/eq  r1, r1
+    0x8D00, // bt/s    (taken)
+    0x0009, // nop
+    0x3120, // cmp/eq  r2, r1
+    0x8F00, // bf/s    (taken)
+    0x0009, // nop
+    0x3110, // cmp/eq  r1, r1
+    0x8900, // bt      (taken)
+    0x3120, // cmp/eq  r2, r1
+    0x8B00, // bf      (taken)
+};
+
+constexpr uint16 kMulDivMix[] = {
+    0x0217, // mul.l   r1, r2
+    0x243F, // muls.w  r3, r4
+    0x351D, // dmuls.l r1, r5
+    0x3615, // dmulu.l r1, r6
+    0x071A, // sts     macl, r7
+    0x0019, // div0u
+    0x3934, // div1    r3, r9
+    0x3934, // div1    r3, r9
+    0x3934, // div1    r3, r9
+    0x3934, // div1    r3, r9
+    0x3934, // div1    r3, r9
+    0x3934, // div1    r3, r9
+    0x3934, // div1    r3, r9
+    0x3934, // div1    r3, r9
+    0x071A, // sts     macl, r7
+    0x0217, // mul.l   r1, r2
+};
+// clang-format on
+
+template <bool emulateCache>
+Benchmark MakeSH2Benchmark(std::string name, std::span<const uint16> body) {
+    return {
+        .name = std::move(name),
+        .unit = "instr",
+        .setup =
+            [body] {
+                auto fixture = std::make_shared<SH2Fixture>(body, emulateCache);
+                return [fixture] { return fixture->Run<emulateCache>(); };
+            },
+    };
+}
+
+} // namespace
+
+void AddSH2Benchmarks(BenchmarkList &list) {
+    list.push_back(MakeSH2Benchmark<false>("sh2/alu", kALUMix));
+    list.push_back(MakeSH2Benchmark<false>("sh2/load_store", kLoadStoreMix));
+    list.push_back(MakeSH2Benchmark<false>("sh2/branch", kBranchMix));
+    list.push_back(MakeSH2Benchmark<false>("sh2/muldiv", kMulDivMix));
+    list.push_back(MakeSH2Benchmark<true>("sh2/alu_cache", kALUMix));
+    list.push_back(MakeSH2Benchmark<true>("sh2/load_store_cache", kLoadStoreMix));
+}
@@ -0,0 +1,102 @@
+#include "benchmark.hpp"
+
+#include "saturn_fixture.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace ymir;
+
+namespace {
+
+constexpr uint32 kVDP1VRAM = 0x05C0'0000;
+constexpr uint32 kVDP1Regs = 0x05D0'0000;
+constexpr uint32 kVDP2Regs = 0x05F8'0000;
+
+constexpr uint32 kTextureAddress = 0x1'0000;
+constexpr uint32 kCommandCount = 64;
+
+enum class Command : uint16 {
+    NormalSprite = 0x0,
+    ScaledSprite = 0x1,
+    DistortedSprite = 0x2,
+    Polygon = 0x4,
+    Polyline = 0x5,
+    Line = 0x6,
+};
+
+// Builds a command table with system clipping and local coordinates followed by a batch of the same command with
+// varying positions, then sets VDP1 to erase and draw automatically on every frame change.
+void SetupCommandTable(Saturn &saturn, Command command) {
+    auto write = [&](uint32 address, uint16 value) { saturn.mainBus.Write<uint16>(address, value); };
+
+    // 32x32 RGB texture
+    FillRandom(saturn, kVDP1VRAM + kTextureAddress, 32 * 32 * sizeof(uint16), 0x9ABC);
+
+    write(kVDP1VRAM + 0x00, 0x0009); // system clipping
+    write(kVDP1VRAM + 0x14, 319);
+    write(kVDP1VRAM + 0x16, 223);
+    write(kVDP1VRAM + 0x20, 0x000A); // local coordinates
+    write(kVDP1VRAM + 0x2C, 0);
+    write(kVDP1VRAM + 0x2E, 0);
+
+    const bool sprite = command == Command::NormalSprite || command == Command::ScaledSprite ||
+                        command == Command::DistortedSprite;
+    for (uint32 i = 0; i < kCommandCount; ++i) {
+        const uint32 cmd = kVDP1VRAM + 0x40 + i * 0x20;
+        const sint16 x = static_cast<sint16>((i % 8) * 36);
+        const sint16 y = static_cast<sint16>((i / 8) * 26);
+        write(cmd + 0x00, static_cast<uint16>(command));
+        write(cmd + 0x04, sprite ? 0x00A8 : 0x00C0); // PMOD: RGB texture, no end codes / no transparency
+        write(cmd + 0x06, static_cast<uint16>(0x8000 | (i * 0x3C5)));
+        write(cmd + 0x08, kTextureAddress >> 3u);
+        write(cmd + 0x0A, 0x0420); // 32x32
+        write(cmd + 0x0C, x);
+        write(cmd + 0x0E, y);
+        write(cmd + 0x10, x + 48);
+        write(cmd + 0x12, y + 4);
+        write(cmd + 0x14, x + 56);
+        write(cmd + 0x16, y + 40);
+        write(cmd + 0x18, x - 4);
+        write(cmd + 0x1A, y + 32);
+    }
+    write(kVDP1VRAM + 0x40 + kCommandCount * 0x20, 0x8000); // end
+
+    write(kVDP1Regs + 0x0, 0x0000); // TVMR
+    write(kVDP1Regs + 0x2, 0x0000); // FBCR
+    write(kVDP1Regs + 0x6, 0x0000); // EWDR
+    write(kVDP1Regs + 0x8, 0x0000); // EWLR
+    write(kVDP1Regs + 0xA, 0x50E0); // EWRR
+    write(kVDP1Regs + 0x4, 0x0002); // PTMR: draw on frame change
+
+    write(kVDP2Regs + 0x0E0, 0x0020); // SPCTL
+    write(kVDP2Regs + 0x0F0, 0x0007); // PRISA
+    write(kVDP2Regs + 0x000, 0x8000); // TVMD: display on, 320x224
+}
+
+Benchmark MakeVDP1Benchmark(std::string name, Command command) {
+    return {
+        .name = "vdp1/" + std::move(name),
+        .unit = "frame",
+        .setup =
+            [command] {
+                std::shared_ptr<Saturn> saturn = MakeSaturn();
+                SetupCommandTable(*saturn, command);
+                return [saturn] {
+                    saturn->RunFrame();
+                    return uint64{1};
+                };
+            },
+    };
+}
+
+} // namespace
+
+void AddVDP1Benchmarks(BenchmarkList &list) {
+    list.push_back(MakeVDP1Benchmark("normal_sprite", Command::NormalSprite));
+    list.push_back(MakeVDP1Benchmark("scaled_sprite", Command::ScaledSprite));
+    list.push_back(MakeVDP1Benchmark("distorted_sprite", Command::DistortedSprite));
+    list.push_back(MakeVDP1Benchmark("polygon", Command::Polygon));
+    list.push_back(MakeVDP1Benchmark("polyline", Command::Polyline));
+    list.push_back(MakeVDP1Benchmark("line", Command::Line));
+}
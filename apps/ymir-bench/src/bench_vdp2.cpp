@@ -0,0 +1,143 @@
+#include "benchmark.hpp"
+
+#include "saturn_fixture.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ymir;
+
+namespace {
+
+constexpr uint32 kVDP2VRAM = 0x05E0'0000;
+constexpr uint32 kVDP2CRAM = 0x05F0'0000;
+constexpr uint32 kVDP2Regs = 0x05F8'0000;
+
+using RegWrites = std::vector<std::pair<uint16, uint16>>;
+
+// Character data and bitmaps live in VRAM bank A, pattern names in bank B.
+// Every background uses 2-word pattern names with 1x1 character patterns on a 1x1 plane, all mapped to the start of
+// bank B.
+const RegWrites kCellCommon = {
+    {0x010, 0x4567}, // CYCA0L: NBG0-3 character pattern reads
+    {0x012, 0x4567}, // CYCA0U
+    {0x018, 0x0123}, // CYCB0L: NBG0-3 pattern name reads
+    {0x01A, 0xFFFF}, // CYCB0U
+    {0x040, 0x1010}, // MPABN0
+    {0x042, 0x1010}, // MPCDN0
+    {0x044, 0x1010}, // MPABN1
+    {0x046, 0x1010}, // MPCDN1
+    {0x048, 0x1010}, // MPABN2
+    {0x04A, 0x1010}, // MPCDN2
+    {0x04C, 0x1010}, // MPABN3
+    {0x04E, 0x1010}, // MPCDN3
+    {0x0F8, 0x0605}, // PRINA
+    {0x0FA, 0x0403}, // PRINB
+};
+
+const RegWrites kBitmapCommon = {
+    {0x010, 0x4444}, // CYCA0L: NBG0 character pattern reads
+    {0x012, 0x4444}, // CYCA0U
+    {0x018, 0x4444}, // CYCB0L
+    {0x01A, 0x4444}, // CYCB0U
+    {0x0F8, 0x0007}, // PRINA
+};
+
+using VRAMWrites = std::vector<std::pair<uint32, uint32>>;
+
+// Identity rotation parameter table at 0x40000
+const VRAMWrites kIdentityRotationTable = [] {
+    VRAMWrites writes;
+    for (uint32 offset = 0; offset < 0x80; offset += sizeof(uint32)) {
+        writes.emplace_back(0x4'0000 + offset, 0);
+    }
+    writes.emplace_back(0x4'0010, 0x0001'0000); // deltaYst = 1.0
+    writes.emplace_back(0x4'0014, 0x0001'0000); // deltaX = 1.0
+    writes.emplace_back(0x4'001C, 0x0001'0000); // A = 1.0
+    writes.emplace_back(0x4'002C, 0x0001'0000); // E = 1.0
+    writes.emplace_back(0x4'004C, 0x0001'0000); // kx = 1.0
+    writes.emplace_back(0x4'0050, 0x0001'0000); // ky = 1.0
+    return writes;
+}();
+
+struct VDP2Case {
+    const char *name;
+    std::vector<RegWrites> writes;
+    VRAMWrites vram = {};
+};
+
+Benchmark MakeVDP2Benchmark(VDP2Case c) {
+    return {
+        .name = std::string("vdp2/") + c.name,
+        .unit = "frame",
+        .setup =
+            [c = std::move(c)] {
+                std::shared_ptr<Saturn> saturn = MakeSaturn();
+                FillRandom(*saturn, kVDP2VRAM, 0x8'0000, 0x1234);
+                FillRandom(*saturn, kVDP2CRAM, 0x1000, 0x5678);
+                for (auto [offset, value] : c.vram) {
+                    saturn->mainBus.Write<uint32>(kVDP2VRAM + offset, value);
+                }
+                for (const RegWrites &writes : c.writes) {
+                    for (auto [offset, value] : writes) {
+                        saturn->mainBus.Write<uint16>(kVDP2Regs + offset, value);
+                    }
+                }
+                saturn->mainBus.Write<uint16>(kVDP2Regs + 0x000, 0x8000); // TVMD: display on, 320x224
+                return [saturn] {
+                    saturn->RunFrame();
+                    return uint64{1};
+                };
+            },
+    };
+}
+
+} // namespace
+
+void AddVDP2Benchmarks(BenchmarkList &list) {
+    list.push_back(MakeVDP2Benchmark({"back_screen", {}}));
+    list.push_back(MakeVDP2Benchmark({"nbg0_cell_pal16",
+                                      {kCellCommon,
+                                       {
+                                           {0x020, 0x0001}, // BGON: NBG0
+                                           {0x028, 0x0000}, // CHCTLA: NBG0 16 colors
+                                       }}}));
+    list.push_back(MakeVDP2Benchmark({"nbg0_cell_pal256",
+                                      {kCellCommon,
+                                       {
+                                           {0x020, 0x0001}, // BGON: NBG0
+                                           {0x028, 0x0010}, // CHCTLA: NBG0 256 colors
+                                       }}}));
+    list.push_back(MakeVDP2Benchmark({"nbg0_bitmap_pal256",
+                                      {kBitmapCommon,
+                                       {
+                                           {0x020, 0x0001}, // BGON: NBG0
+                                           {0x028, 0x0012}, // CHCTLA: NBG0 512x256 bitmap, 256 colors
+                                       }}}));
+    list.push_back(MakeVDP2Benchmark({"nbg0_bitmap_rgb555",
+                                      {kBitmapCommon,
+                                       {
+                                           {0x020, 0x0001}, // BGON: NBG0
+                                           {0x028, 0x0032}, // CHCTLA: NBG0 512x256 bitmap, RGB555
+                                       }}}));
+    list.push_back(MakeVDP2Benchmark({"nbg0123_cell_pal16",
+                                      {kCellCommon,
+                                       {
+                                           {0x020, 0x000F}, // BGON: NBG0-3
+                                           {0x028, 0x0000}, // CHCTLA: NBG0-1 16 colors
+                                           {0x02A, 0x0000}, // CHCTLB: NBG2-3 16 colors
+                                       }}}));
+    list.push_back(MakeVDP2Benchmark({"rbg0_bitmap_pal256",
+                                      {{
+                                          {0x00E, 0x0003}, // RAMCTL: VRAM-A holds RBG0 character patterns
+                                          {0x020, 0x0010}, // BGON: RBG0
+                                          {0x02A, 0x1200}, // CHCTLB: RBG0 512x256 bitmap, 256 colors
+                                          {0x0B0, 0x0000}, // RPMD: rotation parameter A
+                                          {0x0BC, 0x0002}, // RPTAU: rotation parameter table at 0x40000
+                                          {0x0BE, 0x0000}, // RPTAL
+                                          {0x0FC, 0x0007}, // PRIR
+                                      }},
+                                     kIdentityRotationTable}));
+}
@@ -0,0 +1,69 @@
+#include "benchmark.hpp"
+
+#include <alloc_counter/alloc_counter.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+double BenchmarkResult::MedianNsPerOp() const {
+    std::vector<double> sorted = nsPerOp;
+    std::sort(sorted.begin(), sorted.end());
+    const size_t mid = sorted.size() / 2;
+    return sorted.size() % 2 == 0 ? (sorted[mid - 1] + sorted[mid]) * 0.5 : sorted[mid];
+}
+
+double BenchmarkResult::MinNsPerOp() const {
+    return *std::min_element(nsPerOp.begin(), nsPerOp.end());
+}
+
+double BenchmarkResult::MaxNsPerOp() const {
+    return *std::max_element(nsPerOp.begin(), nsPerOp.end());
+}
+
+BenchmarkResult RunBenchmark(const Benchmark &benchmark, const BenchmarkOptions &options) {
+    using clock = std::chrono::steady_clock;
+
+    BenchmarkResult result{};
+    result.name = benchmark.name;
+    result.unit = benchmark.unit;
+
+    Benchmark::Batch batch = benchmark.setup();
+
+    // Warm up and estimate how many batches fit in a sample
+    const auto tWarmup0 = clock::now();
+    batch();
+    // Clamp to 1 us so that a batch faster than the clock resolution doesn't produce an infinite batch count
+    const double warmupMs =
+        std::max(std::chrono::duration<double, std::milli>(clock::now() - tWarmup0).count(), 0.001);
+    const double minSampleMs = std::max(options.minSampleMs, 0.0);
+    const uint64 batchesPerSample = std::max<uint64>(1, static_cast<uint64>(minSampleMs / warmupMs + 1.0));
+
+    const uint32 samples = std::max(options.samples, 1u);
+    result.nsPerOp.reserve(samples);
+
+    uint64 totalOps = 0;
+    uint64 totalAllocations = 0;
+    uint64 totalBytes = 0;
+    for (uint32 sample = 0; sample < samples; ++sample) {
+        uint64 ops = 0;
+        const alloc_counter::Counts alloc0 = alloc_counter::GetTotal();
+        const auto t0 = clock::now();
+        for (uint64 i = 0; i < batchesPerSample; ++i) {
+            ops += batch();
+        }
+        const auto t1 = clock::now();
+        const alloc_counter::Counts alloc1 = alloc_counter::GetTotal();
+
+        ops = std::max<uint64>(ops, 1);
+        const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        result.nsPerOp.push_back(ns / static_cast<double>(ops));
+        result.opsPerSample = ops;
+        totalOps += ops;
+        totalAllocations += alloc1.allocations - alloc0.allocations;
+        totalBytes += alloc1.bytes - alloc0.bytes;
+    }
+    result.allocationsPerOp = static_cast<double>(totalAllocations) / static_cast<double>(totalOps);
+    result.bytesAllocatedPerOp = static_cast<double>(totalBytes) / static_cast<double>(totalOps);
+
+    return result;
+}
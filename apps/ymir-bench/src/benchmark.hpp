@@ -0,0 +1,53 @@
+#pragma once
+
+#include <ymir/core/types.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// A benchmark measures the time and heap allocations taken by a batch of operations on a single component.
+struct Benchmark {
+    // Prepares the component under test and returns the function that runs one batch of operations.
+    // The batch function returns the number of operations it performed.
+    using Batch = std::function<uint64()>;
+    using Setup = std::function<Batch()>;
+
+    std::string name; // <component>/<case>
+    std::string unit; // what a single operation is
+    Setup setup;
+};
+
+using BenchmarkList = std::vector<Benchmark>;
+
+struct BenchmarkOptions {
+    uint32 samples = 5;        // number of timed samples
+    double minSampleMs = 200.0; // minimum duration of each sample
+};
+
+struct BenchmarkResult {
+    std::string name;
+    std::string unit;
+    uint64 opsPerSample;
+    std::vector<double> nsPerOp; // one entry per sample
+    double allocationsPerOp;
+    double bytesAllocatedPerOp;
+
+    double MedianNsPerOp() const;
+    double MinNsPerOp() const;
+    double MaxNsPerOp() const;
+};
+
+BenchmarkResult RunBenchmark(const Benchmark &benchmark, const BenchmarkOptions &options);
+
+// -----------------------------------------------------------------------------
+// Benchmark registration
+
+void AddSH2Benchmarks(BenchmarkList &list);
+void AddBusBenchmarks(BenchmarkList &list);
+void AddVDP1Benchmarks(BenchmarkList &list);
+void AddVDP2Benchmarks(BenchmarkList &list);
+void AddSCSPBenchmarks(BenchmarkList &list);
+void AddSCUDSPBenchmarks(BenchmarkList &list);
+void AddMediaBenchmarks(BenchmarkList &list);
+void AddSaveStateBenchmarks(BenchmarkList &list);
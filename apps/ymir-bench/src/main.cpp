@@ -0,0 +1,160 @@
+#include "benchmark.hpp"
+
+#include <ymir/util/process.hpp>
+
+#include <cxxopts.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+namespace {
+
+BenchmarkList CollectBenchmarks() {
+    BenchmarkList list{};
+    AddSH2Benchmarks(list);
+    AddBusBenchmarks(list);
+    AddVDP1Benchmarks(list);
+    AddVDP2Benchmarks(list);
+    AddSCSPBenchmarks(list);
+    AddSCUDSPBenchmarks(list);
+    AddMediaBenchmarks(list);
+    AddSaveStateBenchmarks(list);
+    return list;
+}
+
+// Matches if any of the comma-separated filters is a substring of the name.
+bool MatchesFilter(const std::string &name, const std::string &filter) {
+    if (filter.empty()) {
+        return true;
+    }
+    size_t start = 0;
+    while (start <= filter.size()) {
+        const size_t end = std::min(filter.find(',', start), filter.size());
+        const std::string term = filter.substr(start, end - start);
+        if (!term.empty() && name.find(term) != std::string::npos) {
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+void PrintText(const BenchmarkResult &result) {
+    fmt::println("{:<36} {:>12.2f} ns/{:<7} (min {:>10.2f}, max {:>10.2f})  {:>8.3f} allocs/op  {:>10.1f} B/op",
+                 result.name, result.MedianNsPerOp(), result.unit, result.MinNsPerOp(), result.MaxNsPerOp(),
+                 result.allocationsPerOp, result.bytesAllocatedPerOp);
+}
+
+void PrintCSVHeader() {
+    fmt::println("name,unit,ops_per_sample,median_ns_per_op,min_ns_per_op,max_ns_per_op,allocs_per_op,bytes_per_op");
+}
+
+void PrintCSV(const BenchmarkResult &result) {
+    fmt::println("{},{},{},{:.3f},{:.3f},{:.3f},{:.6f},{:.3f}", result.name, result.unit, result.opsPerSample,
+                 result.MedianNsPerOp(), result.MinNsPerOp(), result.MaxNsPerOp(), result.allocationsPerOp,
+                 result.bytesAllocatedPerOp);
+}
+
+void PrintJSON(const std::vector<BenchmarkResult> &results) {
+    fmt::println("{{");
+    fmt::println("  \"version\": \"{}\",", Ymir_VERSION);
+    fmt::println("  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult &result = results[i];
+        std::string samples{};
+        for (size_t j = 0; j < result.nsPerOp.size(); ++j) {
+            samples += fmt::format("{}{:.3f}", j > 0 ? ", " : "", result.nsPerOp[j]);
+        }
+        fmt::println("    {{\"name\": \"{}\", \"unit\": \"{}\", \"ops_per_sample\": {}, \"median_ns_per_op\": {:.3f}, "
+                     "\"min_ns_per_op\": {:.3f}, \"max_ns_per_op\": {:.3f}, \"allocs_per_op\": {:.6f}, "
+                     "\"bytes_per_op\": {:.3f}, \"samples_ns_per_op\": [{}]}}{}",
+                     result.name, result.unit, result.opsPerSample, result.MedianNsPerOp(), result.MinNsPerOp(),
+                     result.MaxNsPerOp(), result.allocationsPerOp, result.bytesAllocatedPerOp, samples,
+                     i + 1 < results.size() ? "," : "");
+    }
+    fmt::println("  ]");
+    fmt::println("}}");
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    bool showHelp = false;
+    bool listOnly = false;
+    bool boostPriority = false;
+    std::string filter{};
+    std::string format = "text";
+    BenchmarkOptions benchOptions{};
+
+    cxxopts::Options options("ymir-bench", "Ymir core microbenchmarks\nVersion " Ymir_VERSION);
+    options.add_options()("h,help", "Display this help text.", cxxopts::value(showHelp)->default_value("false"));
+    options.add_options()("l,list", "List available benchmarks and exit.",
+                          cxxopts::value(listOnly)->default_value("false"));
+    options.add_options()("f,filter", "Run only benchmarks whose names contain any of the comma-separated terms.",
+                          cxxopts::value(filter), "terms");
+    options.add_options()("o,format", "Output format: text, csv, json",
+                          cxxopts::value(format)->default_value("text"), "format");
+    options.add_options()("s,samples", "Number of timed samples per benchmark.",
+                          cxxopts::value(benchOptions.samples)->default_value("5"), "count");
+    options.add_options()("t,min-time", "Minimum duration of each sample in milliseconds.",
+                          cxxopts::value(benchOptions.minSampleMs)->default_value("200"), "ms");
+    options.add_options()("p,boost-priority", "Raise the process and thread priority while running.",
+                          cxxopts::value(boostPriority)->default_value("false"));
+
+    try {
+        options.parse(argc, argv);
+    } catch (const cxxopts::exceptions::exception &e) {
+        fmt::println("{}", e.what());
+        fmt::println("");
+        fmt::println("{}", options.help());
+        return 1;
+    }
+
+    if (showHelp) {
+        fmt::println("{}", options.help());
+        return 0;
+    }
+
+    std::transform(format.cbegin(), format.cend(), format.begin(), [](char c) { return std::tolower(c); });
+    if (format != "text" && format != "csv" && format != "json") {
+        fmt::println("Invalid output format: {}", format);
+        return 1;
+    }
+
+    BenchmarkList benchmarks = CollectBenchmarks();
+    std::erase_if(benchmarks, [&](const Benchmark &benchmark) { return !MatchesFilter(benchmark.name, filter); });
+
+    if (listOnly) {
+        for (const Benchmark &benchmark : benchmarks) {
+            fmt::println("{}", benchmark.name);
+        }
+        return 0;
+    }
+
+    if (boostPriority) {
+        util::BoostCurrentProcessPriority(true);
+        util::BoostCurrentThreadPriority(true);
+    }
+
+    if (format == "csv") {
+        PrintCSVHeader();
+    }
+    std::vector<BenchmarkResult> results{};
+    for (const Benchmark &benchmark : benchmarks) {
+        BenchmarkResult result = RunBenchmark(benchmark, benchOptions);
+        if (format == "text") {
+            PrintText(result);
+        } else if (format == "csv") {
+            PrintCSV(result);
+        }
+        results.push_back(std::move(result));
+    }
+    if (format == "json") {
+        PrintJSON(results);
+    }
+
+    return 0;
+}
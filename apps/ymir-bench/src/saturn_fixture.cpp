@@ -0,0 +1,38 @@
+#include "saturn_fixture.hpp"
+
+#include <ymir/util/data_ops.hpp>
+
+#include <array>
+
+using namespace ymir;
+
+std::unique_ptr<Saturn> MakeSaturn() {
+    auto saturn = std::make_unique<Saturn>();
+    saturn->configuration.video.threadedVDP1 = false;
+    saturn->configuration.video.threadedVDP2 = false;
+    saturn->configuration.video.threadedDeinterlacer = false;
+    saturn->configuration.audio.threadedSCSP = false;
+
+    auto ipl = std::make_unique<std::array<uint8, sys::kIPLSize>>();
+    ipl->fill(0);
+    util::WriteBE<uint32>(&(*ipl)[0x0], 0x100);       // PC
+    util::WriteBE<uint32>(&(*ipl)[0x4], 0x0600'4000); // SP
+    util::WriteBE<uint16>(&(*ipl)[0x100], 0x001B);     // sleep
+    util::WriteBE<uint16>(&(*ipl)[0x102], 0xAFFD);     // bra 0x100
+    util::WriteBE<uint16>(&(*ipl)[0x104], 0x0009);     // nop
+    saturn->LoadIPL(*ipl);
+    saturn->Reset(true);
+
+    return saturn;
+}
+
+void FillRandom(Saturn &saturn, uint32 address, uint32 size, uint32 seed) {
+    // xorshift32
+    uint32 state = seed | 1u;
+    for (uint32 offset = 0; offset < size; offset += sizeof(uint32)) {
+        state ^= state << 13u;
+        state ^= state >> 17u;
+        state ^= state << 5u;
+        saturn.mainBus.Write<uint32>(address + offset, state);
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ymir/sys/saturn.hpp>
+
+#include <memory>
+
+// Creates a Saturn that boots a generated IPL ROM which puts the master SH-2 to sleep, so that frame timings are
+// dominated by the components configured by each benchmark.
+// Rendering and audio run on the emulator thread.
+std::unique_ptr<ymir::Saturn> MakeSaturn();
+
+// Fills a region of the main bus with pseudo-random 32-bit words.
+void FillRandom(ymir::Saturn &saturn, uint32 address, uint32 size, uint32 seed);
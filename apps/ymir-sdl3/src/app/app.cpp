@@ -1243,7 +1243,6 @@ void App::RunEmulator() {
 #endif
 
     screen.nextFrameTarget = clk::now();
-    double avgFrameDelay = 0.0;
 
     bool imguiWantedKeyboardInput = false;
     bool imguiWantedMouseInput = false;
@@ -1260,41 +1259,10 @@ void App::RunEmulator() {
         const bool videoSync = fullScreen ? settings.video.syncInFullscreenMode : settings.video.syncInWindowedMode;
         screen.videoSync = videoSync && !m_context.paused && m_context.emuSpeed.limitSpeed;
 
-        const double frameIntervalAdjustFactor = 0.2; // how much adjustment is applied to the frame interval
+        // Video sync paces emulation when enabled; the audio system absorbs any drift by adjusting its playback rate
+        m_context.audioSystem.SetVideoSync(screen.videoSync);
 
         if (m_context.emuSpeed.limitSpeed) {
-            if (m_context.emuSpeed.GetCurrentSpeedFactor() == 1.0) {
-                // Deliver frame early if audio buffer is emptying (video sync is slowing down emulation too much).
-                // Attempt to maintain the audio buffer between 30% and 70%.
-                // Smoothly adjust frame interval up or down if audio buffer exceeds either threshold.
-                const uint32 audioBufferSize = m_context.audioSystem.GetBufferCount();
-                const uint32 audioBufferCap = m_context.audioSystem.GetBufferCapacity();
-                const double audioBufferMinLevel = 0.3;
-                const double audioBufferMaxLevel = 0.7;
-                const double frameIntervalAdjustWeight =
-                    0.8; // how much weight the current value has over the moving avg
-                const double audioBufferPct = (double)audioBufferSize / audioBufferCap;
-                if (audioBufferPct < audioBufferMinLevel) {
-                    // Audio buffer is too low; lower frame interval
-                    const double adjustPct =
-                        std::clamp((audioBufferMinLevel - audioBufferPct) / audioBufferMinLevel, 0.0, 1.0);
-                    avgFrameDelay = avgFrameDelay + (adjustPct - avgFrameDelay) * frameIntervalAdjustWeight;
-
-                } else if (audioBufferPct > audioBufferMaxLevel) {
-                    // Audio buffer is too high; increase frame interval
-                    const double adjustPct =
-                        std::clamp((audioBufferPct - audioBufferMaxLevel) / (1.0 - audioBufferMaxLevel), 0.0, 1.0);
-                    avgFrameDelay = avgFrameDelay - (adjustPct + avgFrameDelay) * frameIntervalAdjustWeight;
-
-                } else {
-                    // Audio buffer is within range; restore frame interval to normal amount
-                    avgFrameDelay *= 1.0 - frameIntervalAdjustWeight;
-                }
-            } else {
-                // Don't bother syncing to audio if not running at 100% speed
-                avgFrameDelay = 0.0;
-            }
-
             auto baseFrameInterval = screen.frameInterval / m_context.emuSpeed.GetCurrentSpeedFactor();
             const double baseFrameRate = 1000000000.0 / baseFrameInterval.count();
 
@@ -1342,9 +1310,6 @@ void App::RunEmulator() {
             // Adjust frame presentation time
             if (m_context.paused) {
                 screen.nextFrameTarget = clk::now();
-            } else {
-                screen.nextFrameTarget -= std::chrono::duration_cast<std::chrono::nanoseconds>(
-                    frameInterval * avgFrameDelay * frameIntervalAdjustFactor);
             }
 
             if (screen.videoSync) {
@@ -1626,6 +1591,10 @@ void App::RunEmulator() {
         // Make emulator thread process next frame
         m_emuProcessEvent.Set();
 
+        // Keep the SH-2 stack models in sync even while no debugger view is showing them
+        m_context.tracers.masterSH2.execAnalyst.ProcessEvents();
+        m_context.tracers.slaveSH2.execAnalyst.ProcessEvents();
+
         // Process GUI events
         const size_t evtCount = m_context.eventQueues.gui.try_dequeue_bulk(evts.begin(), evts.size());
         for (size_t i = 0; i < evtCount; i++) {
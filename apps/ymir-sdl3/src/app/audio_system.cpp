@@ -3,6 +3,8 @@
 #include <SDL3/SDL_hints.h>
 #include <SDL3/SDL_log.h>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 namespace app {
@@ -73,18 +75,31 @@ bool AudioSystem::GetAudioStreamFormat(int *sampleRate, SDL_AudioFormat *format,
     }
 }
 
-void AudioSystem::ReceiveSample(sint16 left, sint16 right) {
-    // If we're doing audio sync, wait until the buffer is no longer full.
-    // Otherwise, simply overrun the buffer.
-    if (m_sync && !m_silent) {
+void AudioSystem::FlushBlock() {
+    // If we're syncing to audio, wait until the audio device drains the buffer down to the target level.
+    // Otherwise, drop the block if it doesn't fit. When running unsynced, the buffer is kept at twice the target level
+    // to limit latency.
+    const bool audioPaced = m_sync && !m_videoSync && !m_silent;
+    if (audioPaced) {
         m_bufferNotFullEvent.Wait();
     }
 
-    m_buffer[m_writePos] = {left, right};
+    const uint32 writePos = m_writePos.load(std::memory_order_relaxed);
+    const uint32 count = writePos - m_readPos.load(std::memory_order_acquire);
+    if (count + m_blockSize <= GetBufferCapacity()) {
+        for (uint32 i = 0; i < m_blockSize; i++) {
+            m_buffer[(writePos + i) & kBufferMask] = m_block[i];
+        }
+        m_writePos.store(writePos + m_blockSize, std::memory_order_release);
+    }
+    m_blockSize = 0;
 
-    m_writePos = (m_writePos + 1) % m_buffer.size();
-    if (m_writePos == m_readPos) {
+    if (audioPaced && GetBufferCount() >= kTargetLevel) {
         m_bufferNotFullEvent.Reset();
+        // The audio device may have drained the buffer in the meantime
+        if (GetBufferCount() < kTargetLevel) {
+            m_bufferNotFullEvent.Set();
+        }
     }
 }
 
@@ -100,14 +115,31 @@ void AudioSystem::ProcessAudioCallback(SDL_AudioStream *stream, int additional_a
             SDL_PutAudioStreamData(stream, &zero, sizeof(zero));
         }
     } else {
-        const uint32 readPos = m_readPos.load(std::memory_order_acquire);
-        int len1 = std::min<int>(sampleCount, m_buffer.size() - readPos);
-        int len2 = std::min<int>(sampleCount - len1, readPos);
-        SDL_PutAudioStreamData(stream, &m_buffer[readPos], len1 * sizeof(Sample));
+        const uint32 readPos = m_readPos.load(std::memory_order_relaxed);
+        const uint32 count = m_writePos.load(std::memory_order_acquire) - readPos;
+
+        // Dynamic rate control: nudge the playback rate towards the target buffer level.
+        // The stream's resampler absorbs the difference; deviations this small are inaudible.
+        m_avgLevel += (static_cast<float>(count) - m_avgLevel) * 0.1f;
+        const float error = std::clamp((m_avgLevel - kTargetLevel) / kTargetLevel, -1.0f, 1.0f);
+        const float ratio = 1.0f + error * kMaxRateDeviation;
+        if (std::abs(ratio - m_rateRatio) >= 0.0001f) {
+            SDL_SetAudioStreamFrequencyRatio(stream, ratio);
+            m_rateRatio = ratio;
+        }
+
+        // Put as many samples as are available; the device plays silence on underruns
+        const uint32 readCount = std::min<uint32>(sampleCount, count);
+        const uint32 readIndex = readPos & kBufferMask;
+        const uint32 len1 = std::min<uint32>(readCount, kBufferSize - readIndex);
+        const uint32 len2 = readCount - len1;
+        SDL_PutAudioStreamData(stream, &m_buffer[readIndex], len1 * sizeof(Sample));
         SDL_PutAudioStreamData(stream, &m_buffer[0], len2 * sizeof(Sample));
 
-        m_readPos.store((readPos + len1 + len2) % m_buffer.size(), std::memory_order_release);
-        m_bufferNotFullEvent.Set();
+        m_readPos.store(readPos + readCount, std::memory_order_release);
+        if (count - readCount < kTargetLevel) {
+            m_bufferNotFullEvent.Set();
+        }
     }
 }
 
@@ -16,8 +16,30 @@ struct Sample {
     sint16 left, right;
 };
 
+// Buffers samples produced by the emulator and feeds them to the audio device.
+//
+// Samples are collected into small blocks on the emulator thread and published to a ring buffer one block at a time.
+// The audio device callback adjusts the playback rate of the audio stream by a fraction of a percent to keep the ring
+// buffer near its target level, absorbing the clock drift between the emulated system and the host audio device
+// without audible pitch changes.
+//
+// When synchronizing to audio, the emulator thread is paced by the audio device: it waits for the buffer to drain
+// below the target level before publishing more samples. When video sync is enabled the GUI thread paces emulation
+// instead, and the emulator thread never waits for audio.
 class AudioSystem {
 public:
+    // Number of stereo samples in the ring buffer. Must be a power of two.
+    static constexpr uint32 kBufferSize = 16384;
+
+    // Number of samples kept in the ring buffer during playback.
+    static constexpr uint32 kTargetLevel = 2048;
+
+    // Number of samples published to the ring buffer at once.
+    static constexpr uint32 kBlockSize = 64;
+
+    // Maximum deviation from the nominal playback rate applied by the rate controller.
+    static constexpr float kMaxRateDeviation = 0.005f;
+
     bool Init(int sampleRate, SDL_AudioFormat format, int channels, uint32 bufferSize);
     void Deinit();
 
@@ -27,12 +49,19 @@ public:
 
     bool GetAudioStreamFormat(int *sampleRate, SDL_AudioFormat *format, int *channels);
 
-    void ReceiveSample(sint16 left, sint16 right);
+    void ReceiveSample(sint16 left, sint16 right) {
+        m_block[m_blockSize++] = {left, right};
+        if (m_blockSize == kBlockSize) {
+            FlushBlock();
+        }
+    }
 
+    // Copies the most recently received samples.
     void Snapshot(std::span<Sample, 2048> out) const {
-        const uint32 readPos = m_readPos;
-        std::copy(m_buffer.begin() + readPos, m_buffer.end(), out.begin());
-        std::copy(m_buffer.begin(), m_buffer.begin() + readPos, out.begin() + out.size() - readPos);
+        const uint32 start = m_writePos.load(std::memory_order_acquire) - out.size();
+        for (uint32 i = 0; i < out.size(); i++) {
+            out[i] = m_buffer[(start + i) & kBufferMask];
+        }
     }
 
     void SetGain(float gain) {
@@ -55,12 +84,23 @@ public:
 
     void SetSync(bool sync) {
         m_sync = sync;
+        if (!sync) {
+            m_bufferNotFullEvent.Set();
+        }
     }
 
     bool IsSync() const {
         return m_sync;
     }
 
+    // Lets the audio system know whether the GUI thread is pacing emulation through video sync.
+    void SetVideoSync(bool videoSync) {
+        m_videoSync = videoSync;
+        if (videoSync) {
+            m_bufferNotFullEvent.Set();
+        }
+    }
+
     void SetSilent(bool silent) {
         m_silent = silent;
         if (silent) {
@@ -73,27 +113,40 @@ public:
     }
 
     uint32 GetBufferCount() const {
-        uint32 total = m_writePos - m_readPos + m_buffer.size();
-        if (total > m_buffer.size()) {
-            total -= m_buffer.size();
-        }
-        return total;
+        return m_writePos.load(std::memory_order_relaxed) - m_readPos.load(std::memory_order_relaxed);
     }
 
+    // Returns the maximum number of samples the ring buffer may hold in the current sync mode.
     uint32 GetBufferCapacity() const {
-        return m_buffer.size();
+        return m_sync ? kBufferSize : kUnsyncedBufferLimit;
     }
 
 private:
+    static constexpr uint32 kBufferMask = kBufferSize - 1;
+    static_assert((kBufferSize & kBufferMask) == 0, "kBufferSize must be a power of two");
+
+    // Buffer level limit when running unsynced, kept low to limit latency.
+    static constexpr uint32 kUnsyncedBufferLimit = kTargetLevel * 2;
+
     SDL_AudioStream *m_audioStream = nullptr;
     bool m_running = false;
 
-    std::array<Sample, 2048> m_buffer{};
+    // Ring buffer. The read and write positions increase monotonically and are masked on access.
+    std::array<Sample, kBufferSize> m_buffer{};
     std::atomic_uint32_t m_readPos = 0;
-    uint32 m_writePos = 0;
+    std::atomic_uint32_t m_writePos = 0;
     util::Event m_bufferNotFullEvent{true};
 
+    // Block being collected on the emulator thread
+    std::array<Sample, kBlockSize> m_block{};
+    uint32 m_blockSize = 0;
+
+    // Rate controller state, only accessed by the audio device callback
+    float m_avgLevel = kTargetLevel;
+    float m_rateRatio = 1.0f;
+
     bool m_sync = true;
+    std::atomic_bool m_videoSync = false; // written by the GUI thread, read by the emulator thread
     bool m_silent = false;
 
     float m_gain = 0.8f;
@@ -101,6 +154,8 @@ private:
 
     void UpdateGain();
 
+    void FlushBlock();
+
     void ProcessAudioCallback(SDL_AudioStream *stream, int additional_amount, int total_amount);
 };
 
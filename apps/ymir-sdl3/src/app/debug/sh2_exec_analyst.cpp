@@ -66,39 +66,159 @@ using namespace ymir;
 
 namespace app {
 
+// -----------------------------------------------------------------------------
+// Emulator thread
+
 void SH2ExecAnalyst::Clear() {
-    std::unique_lock lock{m_mtxStacks};
-    m_stacks.clear();
+    PostEvent(Event::Type::Clear);
 }
 
 void SH2ExecAnalyst::Reset(uint32 pc, uint32 sp) {
-    std::unique_lock lock{m_mtxStacks};
-    m_stacks.clear();
-    m_stacks[sp] = {.baseAddress = sp};
-    m_currStack = sp;
+    PostEvent(Event::Type::Reset, 0, sp);
     // TODO: trace RESET to pc
 }
 
 void SH2ExecAnalyst::ChangeStack(uint32 newSP) {
-    std::unique_lock lock{m_mtxStacks};
-    if (m_stacks.contains(m_currStack) && m_stacks[m_currStack].entries.empty()) {
+    PostEvent(Event::Type::ChangeStack, 0, newSP);
+}
+
+void SH2ExecAnalyst::ResizeStack(uint32 oldSP, uint32 newSP) {
+    PostEvent(Event::Type::ResizeStack, 0, oldSP, newSP);
+}
+
+void SH2ExecAnalyst::PushRegisterToStack(uint8 rn, uint32 oldSP, uint32 newSP) {
+    PostEvent(Event::Type::PushRegister, rn, oldSP, newSP);
+}
+
+void SH2ExecAnalyst::PushToStack(debug::SH2StackValueType type, uint32 newSP) {
+    PostEvent(Event::Type::Push, static_cast<uint8>(type), newSP);
+}
+
+void SH2ExecAnalyst::PopFromStack(uint32 newSP) {
+    PostEvent(Event::Type::Pop, 0, newSP);
+}
+
+void SH2ExecAnalyst::DelaySlot(uint32 pc, uint32 target) {
+    switch (m_delaySlotEvent) {
+    case DelaySlotEvent::None: break;
+    case DelaySlotEvent::Branch:
+        // TODO: trace branch/loop
+        break;
+    case DelaySlotEvent::Call:
+        // TODO: trace call
+        PostEvent(Event::Type::CallStackPush, 0, pc + 2, target);
+        break;
+    case DelaySlotEvent::RTS:
+        // TODO: trace RTS
+        PostEvent(Event::Type::CallStackPop);
+        break;
+    case DelaySlotEvent::RTE:
+        // TODO: trace RTE
+        PostEvent(Event::Type::CallStackPop);
+        break;
+    }
+}
+
+void SH2ExecAnalyst::Branch(uint32 pc, uint32 target) {
+    // TODO: trace branch from pc to target
+}
+
+void SH2ExecAnalyst::BranchDelay(uint32 target) {
+    m_delaySlotEvent = DelaySlotEvent::Branch;
+}
+
+void SH2ExecAnalyst::Call(uint32 target) {
+    m_delaySlotEvent = DelaySlotEvent::Call;
+}
+
+void SH2ExecAnalyst::Return(uint32 target) {
+    m_delaySlotEvent = DelaySlotEvent::RTS;
+}
+
+void SH2ExecAnalyst::ReturnFromException(uint32 target, uint32 newSP) {
+    m_delaySlotEvent = DelaySlotEvent::RTE;
+    PopFromStack(newSP);
+}
+
+void SH2ExecAnalyst::Exception(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
+    PostEvent(Event::Type::Exception, vecNum, oldPC, oldSP, newPC);
+    // TODO: trace XVEC <vecNum>
+}
+
+void SH2ExecAnalyst::Trap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
+    PostEvent(Event::Type::Trap, vecNum, oldPC, oldSP, newPC);
+    // TODO: trace TRAP <vecNum>
+}
+
+FORCE_INLINE void SH2ExecAnalyst::PostEvent(Event::Type type, uint8 arg, uint32 a, uint32 b, uint32 c) {
+    const size_t writePos = m_eventWritePos.load(std::memory_order_relaxed);
+    const size_t readPos = m_eventReadPos.load(std::memory_order_acquire);
+    if (writePos - readPos >= kEventBufferSize) {
+        m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    m_events[writePos & (kEventBufferSize - 1)] = {.type = type, .arg = arg, .a = a, .b = b, .c = c};
+    m_eventWritePos.store(writePos + 1, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+// UI thread
+
+void SH2ExecAnalyst::ProcessEvents() {
+    const size_t writePos = m_eventWritePos.load(std::memory_order_acquire);
+    size_t readPos = m_eventReadPos.load(std::memory_order_relaxed);
+    for (; readPos != writePos; ++readPos) {
+        ApplyEvent(m_events[readPos & (kEventBufferSize - 1)]);
+    }
+    m_eventReadPos.store(readPos, std::memory_order_release);
+}
+
+void SH2ExecAnalyst::ApplyEvent(const Event &event) {
+    switch (event.type) {
+    case Event::Type::Clear: ApplyClear(); break;
+    case Event::Type::Reset: ApplyReset(event.a); break;
+    case Event::Type::ChangeStack: ApplyChangeStack(event.a); break;
+    case Event::Type::ResizeStack: ApplyResizeStack(event.a, event.b); break;
+    case Event::Type::PushRegister: ApplyPushRegister(event.arg, event.a, event.b); break;
+    case Event::Type::Push: ApplyPush(static_cast<debug::SH2StackValueType>(event.arg), event.a); break;
+    case Event::Type::Pop: ApplyPop(event.a); break;
+    case Event::Type::CallStackPush: ApplyCallStackPush(event.a, event.b); break;
+    case Event::Type::CallStackPop: ApplyCallStackPop(); break;
+    case Event::Type::Exception: ApplyException(event.arg, event.a, event.b, event.c); break;
+    case Event::Type::Trap: ApplyTrap(event.arg, event.a, event.b, event.c); break;
+    }
+}
+
+void SH2ExecAnalyst::ApplyClear() {
+    m_stacks.clear();
+    // The model starts over, so previously dropped events no longer affect it
+    m_droppedEventsAtReset = m_droppedEvents.load(std::memory_order_relaxed);
+}
+
+void SH2ExecAnalyst::ApplyReset(uint32 sp) {
+    ApplyClear();
+    CreateStack(sp);
+    m_currStack = sp;
+}
+
+void SH2ExecAnalyst::ApplyChangeStack(uint32 newSP) {
+    if (auto it = Find(m_stacks, m_currStack); it != m_stacks.end() && it->entries.empty()) {
         // Erase current stack if empty to save memory
-        m_stacks.erase(m_currStack);
+        m_stacks.erase(it);
     }
-    auto it = m_stacks.upper_bound(newSP);
-    if (it != m_stacks.end() && it->second.ContainsAddress(newSP)) {
+    auto it = UpperBound(m_stacks, newSP);
+    if (it != m_stacks.end() && it->ContainsAddress(newSP)) {
         // New SP points into an existing stack; switch to it and resize it
-        m_currStack = it->first;
-        it->second.ResizeEntries(newSP);
+        m_currStack = it->baseAddress;
+        it->ResizeEntries(newSP);
         return;
     }
     // New SP points to no known stack; create one
-    m_stacks[newSP] = {.baseAddress = newSP};
+    CreateStack(newSP);
     m_currStack = newSP;
 }
 
-void SH2ExecAnalyst::ResizeStack(uint32 oldSP, uint32 newSP) {
-    std::unique_lock lock{m_mtxStacks};
+void SH2ExecAnalyst::ApplyResizeStack(uint32 oldSP, uint32 newSP) {
     auto &stack = GetOrCreateStack(oldSP);
     const uint32 currSize = stack.entries.size();
     const sint32 stackSize = stack.ResizeEntries(newSP);
@@ -108,16 +228,15 @@ void SH2ExecAnalyst::ResizeStack(uint32 oldSP, uint32 newSP) {
                       SH2StackEntry{.type = SH2StackEntry::Type::Local});
         }
     } else {
-        m_stacks.erase(m_currStack);
+        EraseStack(m_currStack);
         m_currStack = newSP;
     }
 }
 
-void SH2ExecAnalyst::PushRegisterToStack(uint8 rn, uint32 oldSP, uint32 newSP) {
-    std::unique_lock lock{m_mtxStacks};
+void SH2ExecAnalyst::ApplyPushRegister(uint8 rn, uint32 oldSP, uint32 newSP) {
     auto &stack = GetOrCreateStack(oldSP);
     if (stack.ResizeEntries(newSP) < 0) {
-        m_stacks.erase(m_currStack);
+        EraseStack(m_currStack);
         m_currStack = newSP;
         return;
     }
@@ -126,8 +245,7 @@ void SH2ExecAnalyst::PushRegisterToStack(uint8 rn, uint32 oldSP, uint32 newSP) {
     entry.regNum = rn;
 }
 
-void SH2ExecAnalyst::PushToStack(debug::SH2StackValueType type, uint32 newSP) {
-    std::unique_lock lock{m_mtxStacks};
+void SH2ExecAnalyst::ApplyPush(debug::SH2StackValueType type, uint32 newSP) {
     auto &stack = GetOrCreateStack(newSP + 4);
     stack.ResizeEntries(newSP);
     auto &entry = stack.entries.back();
@@ -141,108 +259,84 @@ void SH2ExecAnalyst::PushToStack(debug::SH2StackValueType type, uint32 newSP) {
     }
 }
 
-void SH2ExecAnalyst::PopFromStack(uint32 newSP) {
-    if (!m_stacks.contains(m_currStack)) {
+void SH2ExecAnalyst::ApplyPop(uint32 newSP) {
+    auto it = Find(m_stacks, m_currStack);
+    if (it == m_stacks.end()) {
         return;
     }
 
-    std::unique_lock lock{m_mtxStacks};
-    auto &stack = m_stacks[m_currStack];
-    const sint32 stackSize = stack.ResizeEntries(newSP);
+    const sint32 stackSize = it->ResizeEntries(newSP);
     if (stackSize < 0) {
-        m_stacks.erase(m_currStack);
+        m_stacks.erase(it);
         m_currStack = newSP;
     }
 }
 
-void SH2ExecAnalyst::DelaySlot(uint32 pc, uint32 target) {
-    if (!m_stacks.contains(m_currStack)) {
+void SH2ExecAnalyst::ApplyCallStackPush(uint32 retAddr, uint32 target) {
+    auto it = Find(m_stacks, m_currStack);
+    if (it == m_stacks.end()) {
         return;
     }
-
-    std::unique_lock lock{m_mtxStacks};
-    auto &stack = m_stacks[m_currStack];
-    switch (m_delaySlotEvent) {
-    case DelaySlotEvent::None: break;
-    case DelaySlotEvent::Branch:
-        // TODO: trace branch/loop
-        break;
-    case DelaySlotEvent::Call:
-        // TODO: trace call
-        stack.callStack.push_back(SH2CallStackEntry::Call(pc + 2, target));
-        break;
-    case DelaySlotEvent::RTS:
-        // TODO: trace RTS
-        if (!stack.callStack.empty()) {
-            stack.callStack.pop_back();
-        }
-        break;
-    case DelaySlotEvent::RTE:
-        // TODO: trace RTE
-        if (!stack.callStack.empty()) {
-            stack.callStack.pop_back();
-        }
-        break;
-    }
+    it->callStack.push_back(SH2CallStackEntry::Call(retAddr, target));
 }
 
-void SH2ExecAnalyst::Branch(uint32 pc, uint32 target) {
-    // TODO: trace branch from pc to target
-}
-
-void SH2ExecAnalyst::BranchDelay(uint32 target) {
-    m_delaySlotEvent = DelaySlotEvent::Branch;
-}
-
-void SH2ExecAnalyst::Call(uint32 target) {
-    m_delaySlotEvent = DelaySlotEvent::Call;
-}
-
-void SH2ExecAnalyst::Return(uint32 target) {
-    m_delaySlotEvent = DelaySlotEvent::RTS;
-}
-
-void SH2ExecAnalyst::ReturnFromException(uint32 target, uint32 newSP) {
-    m_delaySlotEvent = DelaySlotEvent::RTE;
-    PopFromStack(newSP);
+void SH2ExecAnalyst::ApplyCallStackPop() {
+    auto it = Find(m_stacks, m_currStack);
+    if (it == m_stacks.end()) {
+        return;
+    }
+    if (!it->callStack.empty()) {
+        it->callStack.pop_back();
+    }
 }
 
-void SH2ExecAnalyst::Exception(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
-    std::unique_lock lock{m_mtxStacks};
+void SH2ExecAnalyst::ApplyException(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
     auto &stack = GetOrCreateStack(oldSP);
     stack.ResizeEntries(oldSP - 8);
     stack.entries[stack.entries.size() - 2].type = SH2StackEntry::Type::ExceptionSR;
     stack.entries[stack.entries.size() - 1].type = SH2StackEntry::Type::ExceptionPC;
     stack.callStack.push_back(SH2CallStackEntry::Exception(oldPC, newPC, vecNum));
-    // TODO: trace XVEC <vecNum>
 }
 
-void SH2ExecAnalyst::Trap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
-    std::unique_lock lock{m_mtxStacks};
+void SH2ExecAnalyst::ApplyTrap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
     auto &stack = GetOrCreateStack(oldSP);
     stack.ResizeEntries(oldSP - 8);
     stack.entries[stack.entries.size() - 2].type = SH2StackEntry::Type::TrapSR;
     stack.entries[stack.entries.size() - 1].type = SH2StackEntry::Type::TrapPC;
     stack.callStack.push_back(SH2CallStackEntry::Trap(oldPC + 2, newPC, vecNum));
-    // TODO: trace TRAP <vecNum>
+}
+
+SH2Stack &SH2ExecAnalyst::CreateStack(uint32 baseAddress) {
+    auto it = std::lower_bound(m_stacks.begin(), m_stacks.end(), baseAddress,
+                               [](const SH2Stack &stack, uint32 address) { return stack.baseAddress < address; });
+    if (it != m_stacks.end() && it->baseAddress == baseAddress) {
+        *it = {.baseAddress = baseAddress};
+        return *it;
+    }
+    return *m_stacks.insert(it, {.baseAddress = baseAddress});
+}
+
+void SH2ExecAnalyst::EraseStack(uint32 baseAddress) {
+    if (auto it = Find(m_stacks, baseAddress); it != m_stacks.end()) {
+        m_stacks.erase(it);
+    }
 }
 
 FORCE_INLINE SH2Stack &SH2ExecAnalyst::GetOrCreateStack(uint32 sp) {
-    auto it = m_stacks.upper_bound(sp);
-    if (it != m_stacks.end() && it->second.ContainsAddress(sp)) {
+    auto it = UpperBound(m_stacks, sp);
+    if (it != m_stacks.end() && it->ContainsAddress(sp)) {
         // SP points into an existing stack; switch to it and resize it
-        it->second.ResizeEntries(sp);
-        m_currStack = it->first;
-    } else {
-        if (m_stacks.contains(m_currStack) && m_stacks[m_currStack].entries.empty()) {
-            // Erase current stack if empty to save memory
-            m_stacks.erase(m_currStack);
-        }
-        // SP points to no known stack; create one
-        m_stacks[sp] = {.baseAddress = sp};
-        m_currStack = sp;
+        it->ResizeEntries(sp);
+        m_currStack = it->baseAddress;
+        return *it;
+    }
+    if (auto curr = Find(m_stacks, m_currStack); curr != m_stacks.end() && curr->entries.empty()) {
+        // Erase current stack if empty to save memory
+        m_stacks.erase(curr);
     }
-    return m_stacks[m_currStack];
+    // SP points to no known stack; create one
+    m_currStack = sp;
+    return CreateStack(sp);
 }
 
 } // namespace app
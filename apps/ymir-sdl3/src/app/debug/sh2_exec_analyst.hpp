@@ -4,10 +4,13 @@
 
 #include <ymir/core/types.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <concepts>
-#include <map>
-#include <mutex>
+#include <memory>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace app {
@@ -99,7 +102,18 @@ struct SH2Stack {
 };
 
 /// @brief Analyzes SH-2 code flow and tracks stack contents.
+///
+/// The tracing functions are invoked from the emulator thread. They only record compact events into a preallocated
+/// single-producer, single-consumer ring buffer and never block or allocate.
+///
+/// The stack model is rebuilt on the UI thread by `ProcessEvents()`, which the application calls once per frame and the
+/// stack views call before reading the model. If the buffer overflows between two calls (for instance, when running
+/// unthrottled or with code that switches stacks in a tight loop), new events are dropped and counted, and the model is
+/// kept as is. Views should report `GetDroppedEventCount()` since the model may no longer match the emulated stacks.
 struct SH2ExecAnalyst {
+    // -------------------------------------------------------------------------
+    // Emulator thread
+
     void Clear();
 
     void Reset(uint32 pc, uint32 sp);
@@ -117,6 +131,18 @@ struct SH2ExecAnalyst {
     void Exception(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC);
     void Trap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC);
 
+    // -------------------------------------------------------------------------
+    // UI thread
+
+    /// @brief Applies all pending stack events to the stack model.
+    void ProcessEvents();
+
+    /// @brief Returns the number of events dropped due to buffer overflows since the model was last reset.
+    /// @return the number of dropped events; if nonzero, the stack model may be inaccurate
+    uint64 GetDroppedEventCount() const {
+        return m_droppedEvents.load(std::memory_order_relaxed) - m_droppedEventsAtReset;
+    }
+
     /// @brief Retrieves stack information for the specified address range.
     ///
     /// `startAddress` must be less than or equal to `endAddress`, and the range is inclusive on both ends.
@@ -136,8 +162,6 @@ struct SH2ExecAnalyst {
         requires std::invocable<TFnStackCallback, uint32 /*entryAddress*/, const SH2StackEntry * /*entry*/,
                                 uint32 /*baseAddress*/>
     void GetStackInfo(uint32 startAddress, uint32 endAddress, TFnStackCallback &&fnStackCallback) const {
-        std::unique_lock lock{m_mtxStacks};
-
         startAddress &= ~3u;
         endAddress &= ~3u;
 
@@ -146,13 +170,13 @@ struct SH2ExecAnalyst {
             return;
         }
 
-        auto it = m_stacks.upper_bound(startAddress);
+        auto it = UpperBound(m_stacks, startAddress);
         for (uint32 address = startAddress; address <= endAddress; address += sizeof(uint32)) {
             if (it == m_stacks.end()) {
                 fnStackCallback(address, nullptr, 0);
                 continue;
             }
-            if (address >= it->second.baseAddress) {
+            if (address >= it->baseAddress) {
                 // Gone past the current stack; find next
                 ++it;
                 if (it == m_stacks.end()) {
@@ -161,46 +185,125 @@ struct SH2ExecAnalyst {
                     continue;
                 }
             }
-            const SH2Stack &stack = it->second;
+            const SH2Stack &stack = *it;
             fnStackCallback(address, stack.GetEntry(address), stack.baseAddress);
         }
     }
 
-    /// @brief Returns a copy of the current call stack.
-    /// @return a copy of the current call stack
-    std::vector<SH2CallStackEntry> GetCurrentCallStack() const {
-        std::unique_lock lock{m_mtxStacks};
-        auto it = m_stacks.find(m_currStack);
+    /// @brief Returns a view of the current call stack.
+    /// The view is valid until the next call to `ProcessEvents()`.
+    /// @return the current call stack
+    std::span<const SH2CallStackEntry> GetCurrentCallStack() const {
+        auto it = Find(m_stacks, m_currStack);
         if (it == m_stacks.end()) {
             return {};
         }
-        // TODO: use atomic shared pointer if this copy gets too expensive
-        return it->second.callStack;
+        return it->callStack;
     }
 
     /// @brief Returns the current data stack base address, if it points to a valid stack.
     /// @return the current data stack base address, or `std::nullopt` if there is no traced data stack.
     std::optional<uint32> GetCurrentDataStackBase() const {
-        std::unique_lock lock{m_mtxStacks};
-        if (m_stacks.contains(m_currStack)) {
+        if (Find(m_stacks, m_currStack) != m_stacks.end()) {
             return m_currStack;
         }
         return std::nullopt;
     }
 
 private:
-    mutable std::mutex m_mtxStacks;
-    std::map<uint32, SH2Stack> m_stacks;
+    // -------------------------------------------------------------------------
+    // Event buffer
+
+    struct Event {
+        enum class Type : uint8 {
+            Clear,         // -
+            Reset,         // a = SP
+            ChangeStack,   // a = new SP
+            ResizeStack,   // a = old SP, b = new SP
+            PushRegister,  // arg = register number, a = old SP, b = new SP
+            Push,          // arg = SH2StackValueType, a = new SP
+            Pop,           // a = new SP
+            CallStackPush, // a = return address, b = target
+            CallStackPop,  // -
+            Exception,     // arg = vector number, a = old PC, b = old SP, c = new PC
+            Trap,          // arg = vector number, a = old PC, b = old SP, c = new PC
+        };
+
+        Type type;
+        uint8 arg;
+        uint32 a;
+        uint32 b;
+        uint32 c;
+    };
+
+    // Only stack and call stack changes post events, which are a small fraction of the instructions executed in a
+    // frame. Events posted while the buffer is full are dropped and counted.
+    static constexpr size_t kEventBufferSize = 64 * 1024;
+    static_assert(std::has_single_bit(kEventBufferSize), "kEventBufferSize must be a power of two");
+    static_assert(sizeof(Event) == 16);
+
+    // 1 MiB per analyst; the contents are written before they are read, so they are left uninitialized
+    std::unique_ptr<Event[]> m_events = std::make_unique_for_overwrite<Event[]>(kEventBufferSize);
+    alignas(64) std::atomic<size_t> m_eventWritePos = 0; // written by the emulator thread
+    alignas(64) std::atomic<size_t> m_eventReadPos = 0;  // written by the UI thread
+    std::atomic<uint64> m_droppedEvents = 0;             // written by the emulator thread
+    uint64 m_droppedEventsAtReset = 0;                   // written by the UI thread
+
+    /// @brief Records an event. Drops and counts it if the buffer is full.
+    void PostEvent(Event::Type type, uint8 arg = 0, uint32 a = 0, uint32 b = 0, uint32 c = 0);
+
+    enum class DelaySlotEvent { None, Branch, Call, RTS, RTE };
+    DelaySlotEvent m_delaySlotEvent = DelaySlotEvent::None;
+
+    // -------------------------------------------------------------------------
+    // Stack model
+
+    /// @brief Traced stacks, sorted by base address.
+    std::vector<SH2Stack> m_stacks;
     uint32 m_currStack = 0;
 
+    /// @brief Finds the first stack whose base address is above the specified address.
+    template <typename TStacks>
+    static auto UpperBound(TStacks &stacks, uint32 address) -> decltype(stacks.begin()) {
+        return std::upper_bound(stacks.begin(), stacks.end(), address,
+                                [](uint32 address, const SH2Stack &stack) { return address < stack.baseAddress; });
+    }
+
+    /// @brief Finds the stack based at the specified address.
+    template <typename TStacks>
+    static auto Find(TStacks &stacks, uint32 baseAddress) -> decltype(stacks.begin()) {
+        auto it = std::lower_bound(stacks.begin(), stacks.end(), baseAddress,
+                                   [](const SH2Stack &stack, uint32 address) { return stack.baseAddress < address; });
+        return it != stacks.end() && it->baseAddress == baseAddress ? it : stacks.end();
+    }
+
+    /// @brief Creates an empty stack based at the specified address, replacing any existing stack at that address.
+    /// @param[in] baseAddress the stack base address
+    /// @return a reference to the new stack
+    SH2Stack &CreateStack(uint32 baseAddress);
+
+    /// @brief Erases the stack based at the specified address, if it exists.
+    /// @param[in] baseAddress the stack base address
+    void EraseStack(uint32 baseAddress);
+
     /// @brief Retrieves the current stack or creates a stack based at the specified address.
-    /// Assumes the mutex is held.
     /// @param[in] sp the base stack pointer
     /// @return a reference to the current stack
     SH2Stack &GetOrCreateStack(uint32 sp);
 
-    enum class DelaySlotEvent { None, Branch, Call, RTS, RTE };
-    DelaySlotEvent m_delaySlotEvent = DelaySlotEvent::None;
+    void ApplyEvent(const Event &event);
+
+    void ApplyClear();
+    void ApplyReset(uint32 sp);
+    void ApplyChangeStack(uint32 newSP);
+    void ApplyResizeStack(uint32 oldSP, uint32 newSP);
+    void ApplyPushRegister(uint8 rn, uint32 oldSP, uint32 newSP);
+    void ApplyPush(ymir::debug::SH2StackValueType type, uint32 newSP);
+    void ApplyPop(uint32 newSP);
+    void ApplyCallStackPush(uint32 retAddr, uint32 target);
+    void ApplyCallStackPop();
+    void ApplyException(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC);
+    void ApplyTrap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC);
 };
 
 } // namespace app
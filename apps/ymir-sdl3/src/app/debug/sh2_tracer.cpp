@@ -214,4 +214,11 @@ void SH2Tracer::DMAXferEnd(uint32 channel, bool irqRaised) {
     }
 }
 
+void SH2Tracer::ProcessRecords(std::span<const debug::SH2TraceRecord> records) {
+    // This class is final, so the records are dispatched to the handlers above without going through the vtable
+    for (const debug::SH2TraceRecord &rec : records) {
+        rec.Dispatch(*this);
+    }
+}
+
 } // namespace app
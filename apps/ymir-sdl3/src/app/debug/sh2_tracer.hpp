@@ -116,6 +116,9 @@ private:
     // -------------------------------------------------------------------------
     // ISH2Tracer implementation
 
+    // Decodes buffered records into calls to the functions below
+    friend struct ymir::debug::SH2TraceRecord;
+
     void Attached() final;
     void Detached() final;
 
@@ -145,6 +148,8 @@ private:
                       sint32 srcInc, sint32 dstInc) final;
     void DMAXferData(uint32 channel, uint32 srcAddress, uint32 dstAddress, uint32 data, uint32 unitSize) final;
     void DMAXferEnd(uint32 channel, bool irqRaised) final;
+
+    void ProcessRecords(std::span<const ymir::debug::SH2TraceRecord> records) final;
 };
 
 } // namespace app
@@ -557,6 +557,10 @@ EmuEvent SetEmulateSH2Cache(bool enable) {
     });
 }
 
+EmuEvent SetSlaveSH2Enabled(bool enable) {
+    return RunFunction([=](SharedContext &ctx) { ctx.saturn.instance->SetSlaveSH2Enabled(enable); });
+}
+
 EmuEvent SetSH2ClockFactor(uint32 factor) {
     return RunFunction(
         [=](SharedContext &ctx) { ctx.saturn.instance->SetSH2ClockFactor(RatioU32::FromPercentage(factor)); });
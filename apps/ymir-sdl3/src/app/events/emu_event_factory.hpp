@@ -117,6 +117,7 @@ EmuEvent FormatBackupMemory(bool external);
 EmuEvent LoadInternalBackupMemory();
 
 EmuEvent SetEmulateSH2Cache(bool enable);
+EmuEvent SetSlaveSH2Enabled(bool enable);
 EmuEvent SetSH2ClockFactor(uint32 factor);
 
 EmuEvent SetCDBlockLLE(bool enable);
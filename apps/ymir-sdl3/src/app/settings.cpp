@@ -1084,6 +1084,7 @@ void Settings::ResetToDefaults() {
     audio.interpolation = config::audio::SampleInterpolationMode::Linear;
 
     audio.threadedSCSP = false;
+    audio.m68kBatching = false;
 
     audio.stepGranularity = 0;
 
@@ -1120,6 +1121,7 @@ void Settings::BindConfiguration(ymir::core::Configuration &config) {
 
     audio.interpolation.Observe([&](auto value) { config.audio.interpolation = value; });
     audio.threadedSCSP.Observe([&](auto value) { config.audio.threadedSCSP = value; });
+    audio.m68kBatching.Observe([&](auto value) { config.audio.m68kBatching = value; });
 
     cdblock.readSpeedFactor.Observe([&](auto value) { config.cdblock.readSpeedFactor = value; });
     cdblock.useLLE.Observe([&](auto value) { m_context.EnqueueEvent(events::emu::SetCDBlockLLE(value)); });
@@ -1619,6 +1621,7 @@ SettingsLoadResult Settings::Load(const std::filesystem::path &path) {
         Parse(tblAudio, "MidiOutputPortType", outputPort.type);
         Parse(tblAudio, "InterpolationMode", audio.interpolation);
         Parse(tblAudio, "ThreadedSCSP", audio.threadedSCSP);
+        Parse(tblAudio, "M68KBatching", audio.m68kBatching);
 
         audio.stepGranularity = std::min(stepGranularity, 5u);
 
@@ -2020,6 +2023,7 @@ SettingsSaveResult Settings::Save() {
             {"MidiOutputPortType", ToTOML(audio.midiOutputPort.Get().type)},
             {"InterpolationMode", ToTOML(audio.interpolation)},
             {"ThreadedSCSP", audio.threadedSCSP.Get()},
+            {"M68KBatching", audio.m68kBatching.Get()},
         }}},
 
         {"Cartridge", toml::table{{
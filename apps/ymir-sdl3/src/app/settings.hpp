@@ -511,6 +511,7 @@ struct Settings {
 
         util::Observable<ymir::core::config::audio::SampleInterpolationMode> interpolation;
         util::Observable<bool> threadedSCSP;
+        util::Observable<bool> m68kBatching;
 
         util::Observable<uint32> stepGranularity;
 
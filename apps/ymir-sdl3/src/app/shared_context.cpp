@@ -154,11 +154,7 @@ ymir::sh1::SH1 &SharedContext::SaturnContainer::GetSH1() {
 }
 
 bool SharedContext::SaturnContainer::IsSlaveSH2Enabled() const {
-    return instance->slaveSH2Enabled;
-}
-
-void SharedContext::SaturnContainer::SetSlaveSH2Enabled(bool enabled) {
-    instance->slaveSH2Enabled = enabled;
+    return instance->IsSlaveSH2Enabled();
 }
 
 bool SharedContext::SaturnContainer::IsDebugTracingEnabled() const {
@@ -177,7 +177,6 @@ struct SharedContext {
         }
 
         bool IsSlaveSH2Enabled() const;
-        void SetSlaveSH2Enabled(bool enabled);
         bool IsDebugTracingEnabled() const;
         bool IsSH2CacheEmulationEnabled() const;
 
@@ -6,6 +6,8 @@
 
 #include <fmt/format.h>
 
+#include <cinttypes>
+
 using namespace ymir;
 
 namespace app::ui {
@@ -40,6 +42,12 @@ void SH2CallStackView::Display() {
     };
 
     ImGui::PushFont(m_context.fonts.monospace.regular, m_context.fontSizes.small);
+    // Apply the stack events posted since the main loop last drained them
+    m_tracer.execAnalyst.ProcessEvents();
+    if (const uint64 dropped = m_tracer.execAnalyst.GetDroppedEventCount(); dropped > 0) {
+        ImGui::TextColored(m_context.colors.warn,
+                           "%" PRIu64 " stack events were dropped. The call stack may be inaccurate.", dropped);
+    }
     const auto callStack = m_tracer.execAnalyst.GetCurrentCallStack();
 
     ImGuiListClipper clipper{};
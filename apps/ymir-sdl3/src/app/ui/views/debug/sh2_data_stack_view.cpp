@@ -6,6 +6,7 @@
 
 #include <fmt/format.h>
 
+#include <cinttypes>
 #include <ranges>
 
 using namespace ymir;
@@ -53,6 +54,12 @@ void SH2DataStackView::Display() {
 
     ImGui::PushFont(m_context.fonts.monospace.regular, m_context.fontSizes.small);
     static constexpr uint32 kMaxStackSize = 0x100000;
+    // Apply the stack events posted since the main loop last drained them
+    m_tracer.execAnalyst.ProcessEvents();
+    if (const uint64 dropped = m_tracer.execAnalyst.GetDroppedEventCount(); dropped > 0) {
+        ImGui::TextColored(m_context.colors.warn, "%" PRIu64 " stack events were dropped. The stack may be inaccurate.",
+                           dropped);
+    }
     const uint32 stackBase = m_tracer.execAnalyst.GetCurrentDataStackBase().value_or(r15 + 64);
     // Sanity check: if the stack is too large, just use R15
     const uint32 stackEnd = stackBase - r15 > kMaxStackSize ? r15 + 64 : stackBase;
@@ -126,7 +126,7 @@ void SH2DebugToolbarView::Display() {
         ImGui::SameLine();
         bool slaveSH2Enabled = m_context.saturn.IsSlaveSH2Enabled();
         if (ImGui::Checkbox("Enabled", &slaveSH2Enabled)) {
-            m_context.saturn.SetSlaveSH2Enabled(slaveSH2Enabled);
+            m_context.EnqueueEvent(events::emu::SetSlaveSH2Enabled(slaveSH2Enabled));
         }
     }
 
@@ -2,6 +2,8 @@
 
 #include <ymir/hw/sh2/sh2.hpp>
 
+#include <app/events/emu_event_factory.hpp>
+
 #include <app/ui/widgets/common_widgets.hpp>
 
 using namespace ymir;
@@ -86,7 +88,7 @@ void SH2PowerView::Display() {
     if (!master) {
         bool slaveSH2Enabled = m_context.saturn.IsSlaveSH2Enabled();
         if (ImGui::Checkbox("Enabled", &slaveSH2Enabled)) {
-            m_context.saturn.SetSlaveSH2Enabled(slaveSH2Enabled);
+            m_context.EnqueueEvent(events::emu::SetSlaveSH2Enabled(slaveSH2Enabled));
         }
     }
 
@@ -147,6 +147,7 @@ void AudioSettingsView::Display() {
     ImGui::PopFont();
 
     widgets::settings::audio::ThreadedSCSP(m_context);
+    widgets::settings::audio::M68KBatching(m_context);
 }
 
 } // namespace app::ui
@@ -101,6 +101,7 @@ void TweaksSettingsView::Display() {
 
         fmt::format_to(inserter, "### Audio\n");
         fmt::format_to(inserter, "- {}\n", checkbox("Threaded SCSP and sound CPU", settings.audio.threadedSCSP.Get()));
+        fmt::format_to(inserter, "- {}\n", checkbox("Run sound CPU in batches", settings.audio.m68kBatching.Get()));
 
         // =============================================================================================================
 
@@ -282,6 +283,7 @@ void TweaksSettingsView::DisplayPerformanceOptions() {
         m_context.EnqueueEvent(events::emu::EnableThreadedVDP2(true));
         m_context.EnqueueEvent(events::emu::EnableThreadedDeinterlacer(true));
         m_context.EnqueueEvent(events::emu::EnableThreadedSCSP(false));
+        settings.audio.m68kBatching = false;
     }
     if (ImGui::BeginItemTooltip()) {
         ImGui::TextUnformatted("Strikes a good balance between compatibility and performance.");
@@ -294,6 +296,7 @@ void TweaksSettingsView::DisplayPerformanceOptions() {
         m_context.EnqueueEvent(events::emu::EnableThreadedVDP2(true));
         m_context.EnqueueEvent(events::emu::EnableThreadedDeinterlacer(true));
         m_context.EnqueueEvent(events::emu::EnableThreadedSCSP(false));
+        settings.audio.m68kBatching = false;
     }
     if (ImGui::BeginItemTooltip()) {
         ImGui::TextUnformatted("Maximizes compatibility with no regard for performance.");
@@ -306,6 +309,7 @@ void TweaksSettingsView::DisplayPerformanceOptions() {
         m_context.EnqueueEvent(events::emu::EnableThreadedVDP2(true));
         m_context.EnqueueEvent(events::emu::EnableThreadedDeinterlacer(true));
         m_context.EnqueueEvent(events::emu::EnableThreadedSCSP(true));
+        settings.audio.m68kBatching = true;
     }
     if (ImGui::BeginItemTooltip()) {
         ImGui::TextUnformatted("Maximizes performance with no regard for accuracy.\n"
@@ -334,6 +338,7 @@ void TweaksSettingsView::DisplayPerformanceOptions() {
     ImGui::PopFont();
 
     widgets::settings::audio::ThreadedSCSP(m_context);
+    widgets::settings::audio::M68KBatching(m_context);
 }
 
 } // namespace app::ui
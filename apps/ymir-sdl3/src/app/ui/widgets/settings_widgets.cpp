@@ -359,6 +359,20 @@ namespace settings::audio {
                                     ctx.displayScale);
     }
 
+    void M68KBatching(SharedContext &ctx) {
+        auto &settings = ctx.serviceLocator.GetRequired<Settings>();
+        bool m68kBatching = settings.audio.m68kBatching;
+        if (settings.MakeDirty(ImGui::Checkbox("Run sound CPU in batches", &m68kBatching))) {
+            settings.audio.m68kBatching = m68kBatching;
+        }
+        widgets::ExplanationTooltip("Runs the MC68EC000 up to 16 samples ahead of the SCSP when the emulation step\n"
+                                    "granularity is set to one sample.\n"
+                                    "Improves performance at the cost of accuracy.\n"
+                                    "Games that synchronize the SH-2 with the sound CPU may break when this option is\n"
+                                    "enabled.",
+                                    ctx.displayScale);
+    }
+
 } // namespace settings::audio
 
 namespace settings::cdblock {
@@ -36,6 +36,7 @@ namespace settings::audio {
     void InterpolationMode(SharedContext &ctx);
     void StepGranularity(SharedContext &ctx);
     void ThreadedSCSP(SharedContext &ctx);
+    void M68KBatching(SharedContext &ctx);
 
     std::string StepGranularityToString(uint32 stepGranularity);
 
@@ -29,7 +29,8 @@ namespace ymir::savestate {
 //  11 = 0.2.1
 //  12 = 0.3.0
 //  13 = 0.3.2
-inline constexpr uint32 kVersion = 13;
+//  14 = 0.4.0
+inline constexpr uint32 kVersion = 14;
 
 } // namespace ymir::savestate
 
@@ -891,6 +892,11 @@ void serialize(Archive &ar, M68KSaveState &s) {
 
 template <class Archive>
 void serialize(Archive &ar, SCSPSaveState &s, const uint32 version) {
+    // v14:
+    // - New fields
+    //   - m68kBatchLength = 0
+    //   - m68kBatchTicks = 0
+    //   - m68kBatchProcessed = 0
     // v6:
     // - New fields
     //   - SCILV = {0,0,0}
@@ -982,6 +988,13 @@ void serialize(Archive &ar, SCSPSaveState &s, const uint32 version) {
         }
     }
     ar(s.m68k, s.m68kSpilloverCycles, s.m68kEnabled);
+    if (version >= 14) {
+        ar(s.m68kBatchLength, s.m68kBatchTicks, s.m68kBatchProcessed);
+    } else {
+        s.m68kBatchLength = 0;
+        s.m68kBatchTicks = 0;
+        s.m68kBatchProcessed = 0;
+    }
     for (auto &slot : s.slots) {
         serialize(ar, slot, version);
     }
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ymir/core/types.hpp>
+
+// Counts heap allocations made through the global operator new.
+// The counters are maintained by the replacement allocation functions in alloc_counter.cpp, which replace the global
+// allocation functions of every program linked with this library. Process-wide totals are always counted. Per-thread
+// counts are only updated while a Scope is active on the thread, so allocations made by the test framework or by other
+// threads are not counted in it.
+namespace alloc_counter {
+
+struct Counts {
+    uint64 allocations = 0;
+    uint64 bytes = 0;
+};
+
+// Counts allocations made by the current thread during the lifetime of the object.
+class Scope {
+public:
+    Scope();
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    // Returns the number of allocations and bytes allocated so far in this scope.
+    Counts Get() const;
+
+private:
+    Counts m_start;
+    bool m_prevActive;
+};
+
+// Returns the total number of allocations and bytes allocated by all threads since the process started.
+Counts GetTotal();
+
+} // namespace alloc_counter
@@ -0,0 +1,165 @@
+#include <alloc_counter/alloc_counter.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace alloc_counter {
+
+namespace {
+
+    std::atomic<uint64> g_allocations{0};
+    std::atomic<uint64> g_bytes{0};
+
+    thread_local bool t_active = false;
+    thread_local Counts t_counts{};
+
+    void Count(std::size_t size) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(size, std::memory_order_relaxed);
+        if (t_active) {
+            ++t_counts.allocations;
+            t_counts.bytes += size;
+        }
+    }
+
+    void *Allocate(std::size_t size) {
+        Count(size);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+    void *AllocateAligned(std::size_t size, std::align_val_t alignment) {
+        Count(size);
+        const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        // aligned_alloc requires the size to be a multiple of the alignment
+        return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    }
+
+    void FreeAligned(void *ptr) {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+} // namespace
+
+Scope::Scope()
+    : m_start(t_counts)
+    , m_prevActive(t_active) {
+    t_active = true;
+}
+
+Scope::~Scope() {
+    t_active = m_prevActive;
+}
+
+Counts Scope::Get() const {
+    return {
+        .allocations = t_counts.allocations - m_start.allocations,
+        .bytes = t_counts.bytes - m_start.bytes,
+    };
+}
+
+Counts GetTotal() {
+    return {
+        .allocations = g_allocations.load(std::memory_order_relaxed),
+        .bytes = g_bytes.load(std::memory_order_relaxed),
+    };
+}
+
+} // namespace alloc_counter
+
+// -----------------------------------------------------------------------------
+// Replacement allocation functions
+
+void *operator new(std::size_t size) {
+    if (void *ptr = alloc_counter::Allocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return alloc_counter::Allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return alloc_counter::Allocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    if (void *ptr = alloc_counter::AllocateAligned(size, alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return alloc_counter::AllocateAligned(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return alloc_counter::AllocateAligned(size, alignment);
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+    alloc_counter::FreeAligned(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+    alloc_counter::FreeAligned(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+    alloc_counter::FreeAligned(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+    alloc_counter::FreeAligned(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+    alloc_counter::FreeAligned(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+    alloc_counter::FreeAligned(ptr);
+}
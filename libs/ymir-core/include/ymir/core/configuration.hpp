@@ -64,6 +64,13 @@ struct Configuration {
         /// Enabling this option incurs a small performance penalty and purges all SH-2 caches.
         util::Observable<bool> emulateSH2Cache = false;
 
+        /// @brief Enables fast memory access for the SH-2 bus.
+        ///
+        /// Mirrors Work RAM into a reserved host address window so that SH-2 accesses to it skip the bus page table.
+        /// Requires the `Ymir_FF_FAST_MEMORY` feature flag. Has no effect without it, on Windows, or on hosts that cannot
+        /// reserve the window.
+        util::Observable<bool> fastMemory = false;
+
         /// @brief SH-2 clock factor ratio.
         ///
         /// Adjusts the cycle rate of the SH-2 CPUs, which may reduce internal slowdowns and lag in CPU-heavy games.
@@ -120,6 +127,16 @@ struct Configuration {
         ///
         /// Currently unimplemented.
         util::Observable<bool> threadedSCSP = false;
+
+        /// @brief Runs the MC68EC000 ahead of the SCSP slots in batches of up to 16 samples when stepping one sample at
+        /// a time.
+        ///
+        /// The MC68EC000 still observes the slots, the DSP and its interrupts at the exact same sample, but the SH-2 may
+        /// see sound RAM and SCSP state up to one batch early, and its writes reach the MC68EC000 up to one batch late.
+        /// This trades accuracy for performance and may break games that synchronize the SH-2 with the sound CPU.
+        ///
+        /// This value is thread-safe.
+        util::Observable<bool> m68kBatching = false;
     } audio;
 
     /// @brief CD Block configuration.
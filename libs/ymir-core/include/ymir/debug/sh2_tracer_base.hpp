@@ -11,14 +11,182 @@
 
 #include "sh2_debug_defs.hpp"
 
+#include <array>
+#include <span>
+
 namespace ymir::debug {
 
+/// @brief A compact record of an SH2 tracer event.
+///
+/// The SH2 buffers these records while executing in debug tracing mode and delivers them to the tracer in bulk through
+/// `ISH2Tracer::ProcessRecords(std::span<const SH2TraceRecord>)`.
+struct SH2TraceRecord {
+    /// @brief The tracer event type. Each value corresponds to the `ISH2Tracer` function of the same name.
+    enum class Type : uint8 {
+        ExecuteInstruction,
+        DelaySlot,
+        Branch,
+        BranchDelay,
+        Call,
+        Return,
+        ReturnFromException,
+        Interrupt,
+        Exception,
+        Trap,
+        ChangeStack,
+        ResizeStack,
+        PushRegisterToStack,
+        PushToStack,
+        PopFromStack,
+        Begin32x32Division,
+        Begin64x32Division,
+        EndDivision,
+        DMAXferBegin,
+        DMAXferData,
+        DMAXferEnd,
+    };
+
+    Type type;                  ///< The event type
+    uint8 arg8;                 ///< Flag, register, vector or channel number argument
+    uint16 arg16;               ///< Opcode, interrupt level and source, transfer unit size or flag argument
+    std::array<uint32, 5> args; ///< Remaining arguments, in the order of the `ISH2Tracer` function parameters
+
+    static SH2TraceRecord ExecuteInstruction(uint32 pc, uint16 opcode, bool delaySlot) {
+        return {Type::ExecuteInstruction, delaySlot, opcode, {pc}};
+    }
+    static SH2TraceRecord DelaySlot(uint32 pc, uint32 target) {
+        return {Type::DelaySlot, 0, 0, {pc, target}};
+    }
+    static SH2TraceRecord Branch(uint32 pc, uint32 target) {
+        return {Type::Branch, 0, 0, {pc, target}};
+    }
+    static SH2TraceRecord BranchDelay(uint32 target) {
+        return {Type::BranchDelay, 0, 0, {target}};
+    }
+    static SH2TraceRecord Call(uint32 target) {
+        return {Type::Call, 0, 0, {target}};
+    }
+    static SH2TraceRecord Return(uint32 target) {
+        return {Type::Return, 0, 0, {target}};
+    }
+    static SH2TraceRecord ReturnFromException(uint32 target, uint32 newSP) {
+        return {Type::ReturnFromException, 0, 0, {target, newSP}};
+    }
+    static SH2TraceRecord Interrupt(uint8 vecNum, uint8 level, sh2::InterruptSource source, uint32 pc) {
+        return {Type::Interrupt, vecNum, static_cast<uint16>(level | (static_cast<uint16>(source) << 8u)), {pc}};
+    }
+    static SH2TraceRecord Exception(uint8 vecNum, uint32 oldPC, uint32 oldSR, uint32 oldSP, uint32 newPC) {
+        return {Type::Exception, vecNum, 0, {oldPC, oldSR, oldSP, newPC}};
+    }
+    static SH2TraceRecord Trap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
+        return {Type::Trap, vecNum, 0, {oldPC, oldSP, newPC}};
+    }
+    static SH2TraceRecord ChangeStack(uint32 newSP) {
+        return {Type::ChangeStack, 0, 0, {newSP}};
+    }
+    static SH2TraceRecord ResizeStack(uint32 oldSP, uint32 newSP) {
+        return {Type::ResizeStack, 0, 0, {oldSP, newSP}};
+    }
+    static SH2TraceRecord PushRegisterToStack(uint8 rn, uint32 oldSP, uint32 newSP) {
+        return {Type::PushRegisterToStack, rn, 0, {oldSP, newSP}};
+    }
+    static SH2TraceRecord PushToStack(SH2StackValueType type, uint32 newSP) {
+        return {Type::PushToStack, static_cast<uint8>(type), 0, {newSP}};
+    }
+    static SH2TraceRecord PopFromStack(uint32 newSP) {
+        return {Type::PopFromStack, 0, 0, {newSP}};
+    }
+    static SH2TraceRecord Begin32x32Division(sint32 dividend, sint32 divisor, bool overflowIntrEnable) {
+        return {Type::Begin32x32Division,
+                overflowIntrEnable,
+                0,
+                {static_cast<uint32>(dividend), static_cast<uint32>(divisor)}};
+    }
+    static SH2TraceRecord Begin64x32Division(sint64 dividend, sint32 divisor, bool overflowIntrEnable) {
+        return {Type::Begin64x32Division,
+                overflowIntrEnable,
+                0,
+                {static_cast<uint32>(dividend), static_cast<uint32>(static_cast<uint64>(dividend) >> 32u),
+                 static_cast<uint32>(divisor)}};
+    }
+    static SH2TraceRecord EndDivision(sint32 quotient, sint32 remainder, bool overflow) {
+        return {Type::EndDivision, overflow, 0, {static_cast<uint32>(quotient), static_cast<uint32>(remainder)}};
+    }
+    static SH2TraceRecord DMAXferBegin(uint32 channel, uint32 srcAddress, uint32 dstAddress, uint32 count,
+                                       uint32 unitSize, sint32 srcInc, sint32 dstInc) {
+        return {Type::DMAXferBegin,
+                static_cast<uint8>(channel),
+                static_cast<uint16>(unitSize),
+                {srcAddress, dstAddress, count, static_cast<uint32>(srcInc), static_cast<uint32>(dstInc)}};
+    }
+    static SH2TraceRecord DMAXferData(uint32 channel, uint32 srcAddress, uint32 dstAddress, uint32 data,
+                                      uint32 unitSize) {
+        return {Type::DMAXferData,
+                static_cast<uint8>(channel),
+                static_cast<uint16>(unitSize),
+                {srcAddress, dstAddress, data}};
+    }
+    static SH2TraceRecord DMAXferEnd(uint32 channel, bool irqRaised) {
+        return {Type::DMAXferEnd, static_cast<uint8>(channel), irqRaised, {}};
+    }
+
+    /// @brief Decodes this record and invokes the function of the same name on the handler with the original arguments.
+    ///
+    /// The handler must implement every event function with the same signature as in `ISH2Tracer`. Passing a final
+    /// tracer class lets the compiler call its functions directly instead of through the vtable.
+    ///
+    /// @tparam THandler the handler type
+    /// @param[in] handler the handler to invoke
+    template <typename THandler>
+    void Dispatch(THandler &handler) const {
+        switch (type) {
+        case Type::ExecuteInstruction: handler.ExecuteInstruction(args[0], arg16, arg8 != 0); break;
+        case Type::DelaySlot: handler.DelaySlot(args[0], args[1]); break;
+        case Type::Branch: handler.Branch(args[0], args[1]); break;
+        case Type::BranchDelay: handler.BranchDelay(args[0]); break;
+        case Type::Call: handler.Call(args[0]); break;
+        case Type::Return: handler.Return(args[0]); break;
+        case Type::ReturnFromException: handler.ReturnFromException(args[0], args[1]); break;
+        case Type::Interrupt:
+            handler.Interrupt(arg8, arg16 & 0xFF, static_cast<sh2::InterruptSource>(arg16 >> 8u), args[0]);
+            break;
+        case Type::Exception: handler.Exception(arg8, args[0], args[1], args[2], args[3]); break;
+        case Type::Trap: handler.Trap(arg8, args[0], args[1], args[2]); break;
+        case Type::ChangeStack: handler.ChangeStack(args[0]); break;
+        case Type::ResizeStack: handler.ResizeStack(args[0], args[1]); break;
+        case Type::PushRegisterToStack: handler.PushRegisterToStack(arg8, args[0], args[1]); break;
+        case Type::PushToStack: handler.PushToStack(static_cast<SH2StackValueType>(arg8), args[0]); break;
+        case Type::PopFromStack: handler.PopFromStack(args[0]); break;
+        case Type::Begin32x32Division:
+            handler.Begin32x32Division(static_cast<sint32>(args[0]), static_cast<sint32>(args[1]), arg8 != 0);
+            break;
+        case Type::Begin64x32Division:
+            handler.Begin64x32Division(static_cast<sint64>((static_cast<uint64>(args[1]) << 32u) | args[0]),
+                                       static_cast<sint32>(args[2]), arg8 != 0);
+            break;
+        case Type::EndDivision:
+            handler.EndDivision(static_cast<sint32>(args[0]), static_cast<sint32>(args[1]), arg8 != 0);
+            break;
+        case Type::DMAXferBegin:
+            handler.DMAXferBegin(arg8, args[0], args[1], args[2], arg16, static_cast<sint32>(args[3]),
+                                 static_cast<sint32>(args[4]));
+            break;
+        case Type::DMAXferData: handler.DMAXferData(arg8, args[0], args[1], args[2], arg16); break;
+        case Type::DMAXferEnd: handler.DMAXferEnd(arg8, arg16 != 0); break;
+        }
+    }
+};
+
 /// @brief Interface for SH2 tracers.
 ///
 /// Must be implemented by users of the core library.
 ///
 /// Attach to an instance of `ymir::sh2::SH2` with its `UseTracer(ISH2Tracer *)` method.
 ///
+/// Events other than `Attached()`, `Detached()` and `Reset()` are buffered by the SH2 as `SH2TraceRecord`s and
+/// delivered in bulk through `ProcessRecords()` at the end of every `Advance` or `Step`, or sooner if the buffer fills
+/// up. Breakpoints and watchpoints are not affected by this and still suspend execution immediately.
+///
 /// @note This tracer requires the emulator to execute in debug tracing mode.
 struct ISH2Tracer {
     /// @brief Default virtual destructor. Required for inheritance.
@@ -163,6 +331,19 @@ struct ISH2Tracer {
     /// @param[in] channel the DMAC channel number, either 0 or 1
     /// @param[in] irqRaised indicates if the channel's transfer end interrupt signal was raised
     virtual void DMAXferEnd(uint32 channel, bool irqRaised) {}
+
+    /// @brief Invoked with a batch of buffered events, in the order in which they occurred.
+    ///
+    /// The default implementation invokes the corresponding event function for each record, which still costs one
+    /// virtual call per record. Tracers that handle many events should override this in a final class and call
+    /// `SH2TraceRecord::Dispatch` on themselves so that the event functions are called directly.
+    ///
+    /// @param[in] records the buffered event records
+    virtual void ProcessRecords(std::span<const SH2TraceRecord> records) {
+        for (const SH2TraceRecord &rec : records) {
+            rec.Dispatch(*this);
+        }
+    }
 };
 
 } // namespace ymir::debug
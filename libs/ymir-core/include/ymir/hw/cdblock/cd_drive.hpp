@@ -222,8 +222,8 @@ private:
 
     uint8 m_readSpeed;
 
-    bool SerialRead();
-    void SerialWrite(bool bit);
+    uint8 SerialRead();
+    void SerialWrite(uint8 value);
 
     uint64 ProcessTxState();
     uint64 ProcessCommand();
@@ -27,6 +27,7 @@
 
 #include <array>
 #include <deque>
+#include <span>
 
 namespace ymir::cdblock {
 
@@ -90,6 +91,9 @@ private:
     template <mem_primitive T>
     void WriteReg(uint32 address, T value);
 
+    // Equivalent to count 32-bit reads from address; data port bursts are copied straight from the transfer buffer
+    void ReadRegBurst(uint32 address, uint32 *out, uint32 count);
+
     template <mem_primitive T>
     T PeekReg(uint32 address);
 
@@ -219,6 +223,7 @@ private:
     void ReadSector();
 
     uint16 DoReadTransfer();
+    void DoReadTransfer(std::span<uint16> out);
     void DoWriteTransfer(uint16 value);
 
     void AdvanceTransfer();
@@ -305,11 +310,26 @@ private:
         void OnTracerAttached();
 
     private:
-        std::array<std::deque<Buffer>, kNumPartitions> m_partitions;
+        // Sector buffers live in a fixed pool so that inserting and removing sectors never touches the heap.
+        // Partitions hold indices into the pool, ordered from tail (oldest) to head (newest).
+        struct Partition {
+            std::array<uint8, kNumBuffers> slots;
+            uint8 count;
+        };
+        static_assert(kNumBuffers <= 256, "buffer slot indices must fit in a uint8");
+
+        std::array<Buffer, kNumBuffers> m_buffers;
+        std::array<Partition, kNumPartitions> m_partitions;
+
+        // Stack of unused pool slots; the top m_freeBuffers entries are valid.
+        std::array<uint8, kNumBuffers> m_freeSlots;
 
         uint32 m_freeBuffers;
         uint32 m_reservedBuffers;
 
+        uint8 AllocateSlot();
+        void ReleaseSlots(Partition &partition, uint32 start, uint32 count);
+
         debug::ICDBlockTracer *&m_tracer;
     };
 
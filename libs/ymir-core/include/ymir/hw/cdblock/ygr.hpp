@@ -51,6 +51,10 @@ struct YGR {
     uint8 CDBPeekByte(uint32 address) const;
     void CDBPokeByte(uint32 address, uint8 value);
 
+    // DMA bursts through the FIFO. Stop right after the transfer that deasserts DREQ1#.
+    uint32 CDBReadBurst(uint32 address, uint16 *out, uint32 count) const;
+    uint32 CDBWriteBurst(uint32 address, const uint16 *in, uint32 count);
+
     // -------------------------------------------------------------------------
     // Host bus
 
@@ -271,6 +275,7 @@ private:
     } m_regs;
 
     void UpdateInterrupts();
+    bool IsFIFODREQBlocked() const;
     void UpdateFIFODREQ() const;
 
     void SectorTransferDone();
@@ -36,6 +36,14 @@ public:
 
     void SetExternalInterruptLevel(uint8 level);
 
+    [[nodiscard]] uint8 GetExternalInterruptLevel() const {
+        return m_externalInterruptLevel;
+    }
+
+    [[nodiscard]] uint32 GetPC() const {
+        return PC;
+    }
+
     // -------------------------------------------------------------------------
     // Save states
 
@@ -13,6 +13,7 @@
 #include <ymir/core/scheduler.hpp>
 #include <ymir/sys/bus.hpp>
 #include <ymir/sys/clocks.hpp>
+#include <ymir/sys/memory_layout.hpp>
 
 #include <ymir/savestate/savestate_scsp.hpp>
 
@@ -210,11 +211,89 @@ private:
     // set to false when the CDDA buffer is empty
     bool m_cddaReady;
 
+    // Sound driver idle loop detection.
+    //
+    // Sound drivers spend most of their time spinning in short loops, waiting for a timer interrupt or for the host to
+    // drop a command into sound RAM. When the MC68EC000 takes a short backward branch, one iteration of the loop is
+    // observed. If that iteration only reads from sound RAM, writes nothing and ends in exactly the state it started
+    // from, every following iteration will be identical for as long as the values it read and the interrupt level stay
+    // the same. Neither can change while RunM68K is executing, so each call checks them once and then skips over whole
+    // iterations of the loop by adding up their cycles instead of executing them.
+    struct M68KIdleLoop {
+        static constexpr uint32 kMaxLoopSize = 64;     // maximum backward branch distance in bytes
+        static constexpr uint32 kMaxInstructions = 16; // maximum instructions in an iteration
+        static constexpr uint32 kMaxReads = 32;        // maximum memory reads in an iteration
+        static constexpr uint32 kRetryDelay = 64;      // backward branches to ignore after a failed observation
+
+        struct Read {
+            uint32 address;
+            uint16 value;
+            bool word;
+        };
+
+        bool observing = false;    // recording an iteration of a candidate loop
+        bool disqualified = false; // the observed iteration accessed something other than sound RAM reads
+        bool idle = false;         // the MC68EC000 is spinning in the loop
+        uint32 retryDelay = 0;
+        uint32 numInstructions = 0;
+        uint64 cycles = 0; // cycles taken by one iteration
+
+        std::array<Read, kMaxReads> reads;
+        uint32 numReads = 0;
+
+        savestate::M68KSaveState startState; // MC68EC000 state at the top of the loop
+
+        void Reset() {
+            observing = false;
+            idle = false;
+            retryDelay = 0;
+        }
+    } m_m68kIdleLoop;
+
     m68k::MC68EC000 m_m68k;
     uint64 m_m68kSpilloverCycles;
     std::atomic<uint64> m_m68kClockShift = 0ull;
     std::atomic<bool> m_m68kEnabled = false;
 
+    // MC68EC000 batch execution.
+    //
+    // When batching is enabled and stepping one sample at a time, the MC68EC000 runs ahead of the slots for several
+    // samples in one go instead of being interleaved with them on every sample. The slots catch up lazily: right before
+    // the MC68EC000 touches anything the slots or the DSP can observe or modify (SCSP registers, sound RAM writes and
+    // sound RAM reads within reach of the DSP), every sample preceding the one the current instruction belongs to is
+    // processed. Batches end on the first sample that may raise a timer or sample interrupt enabled for either the
+    // MC68EC000 or the SCU, so interrupts are still raised at the exact same sample as before, and the MC68EC000 sees
+    // everything it shares with the slots at the exact same sample as well.
+    //
+    // The rest of the system only interacts with the SCSP between sample ticks, so it may observe the slots up to one
+    // batch ahead of the scheduler, and its writes take effect up to one batch late from the MC68EC000's point of view.
+    // The MC68EC000 has already run through the batch by then, so this cannot be corrected and batching is opt-in.
+    // When disabled, every batch spans a single sample, which matches the original lockstep execution.
+    struct M68KBatch {
+        static constexpr uint32 kMaxSamples = 16; // maximum samples per batch
+        static constexpr uint64 kNoSync = ~0ull;  // syncCycle value while the MC68EC000 is not running a batch
+
+        uint32 length = 0;    // samples in the current batch
+        uint32 ticks = 0;     // sample ticks elapsed since the start of the batch
+        uint32 processed = 0; // samples processed by the slots since the start of the batch
+
+        uint64 budget = 0;          // MC68EC000 cycles per sample
+        uint64 instrCycle = 0;      // cycle at which the current MC68EC000 instruction started, relative to the batch
+        uint64 syncCycle = kNoSync; // instructions starting at this cycle or later need the slots to catch up
+
+        void (SCSP::*fnProcessSample)() = nullptr; // processes the next sample of the batch
+
+        void Reset() {
+            length = 0;
+            ticks = 0;
+            processed = 0;
+            syncCycle = kNoSync;
+        }
+    } m_m68kBatch;
+
+    // Whether MC68EC000 batching is enabled. Takes effect on the next batch.
+    std::atomic<bool> m_m68kBatching = false;
+
     core::Scheduler &m_scheduler;
     core::EventID m_sampleTickEvent;
 
@@ -251,6 +330,9 @@ private:
         return m_debugTracing ? OnSampleTickEvent<true, threaded> : OnSampleTickEvent<false, threaded>;
     }
 
+    // Retrieves the tick event processing function for switching from larger steps to the given smaller step size.
+    core::Scheduler::EventCallback GetSmallerStepTickEvent(uint32 granularity);
+
     // Updates the step function for processing samples.
     // Takes into account the current granularity step size and the debug tracing flag.
     void UpdateStepFunction();
@@ -261,6 +343,14 @@ private:
     //   0 = step 1 slot at a time (most granular)
     uint32 m_stepGranularity = 5u;
 
+    // Step granularity to switch to once the current MC68EC000 batch is complete.
+    // Switching away from sample steps is deferred while a batch is in progress since the slots may be ahead of the
+    // scheduler. 5u when no switch is pending.
+    uint32 m_pendingStepGranularity = 5u;
+
+    // Applies the pending step granularity from within the sample tick event.
+    void ApplyPendingStepGranularity(core::EventContext &eventContext);
+
     // Whether debug tracing is enabled
     bool m_debugTracing = false;
 
@@ -293,14 +383,14 @@ private:
     FLATTEN T ReadWRAM(uint32 address) {
         static_assert(!std::is_same_v<T, uint32>, "Invalid SCSP WRAM read size");
         // TODO: handle memory size bit
-        return util::ReadBE<T>(&m_WRAM[address & 0x7FFFF]);
+        return sys::ReadMemory<T>(m_WRAM.data(), address & 0x7FFFF & ~(sizeof(T) - 1));
     }
 
     template <mem_primitive T>
     FLATTEN void WriteWRAM(uint32 address, T value) {
         static_assert(!std::is_same_v<T, uint32>, "Invalid SCSP WRAM write size");
         // TODO: handle memory size bit
-        util::WriteBE<T>(&m_WRAM[address & 0x7FFFF], value);
+        sys::WriteMemory<T>(m_WRAM.data(), address & 0x7FFFF & ~(sizeof(T) - 1), value);
     }
 
     template <mem_primitive T>
@@ -325,8 +415,19 @@ private:
 
         if (util::AddressInRange<0x000000, 0x07FFFF>(address)) {
             // TODO: handle memory size bit
-            return ReadWRAM<T>(address);
+            if (m_m68kBatch.instrCycle >= m_m68kBatch.syncCycle && m_dsp.MayWriteWRAM(address)) {
+                SyncM68KBatch();
+            }
+            const T value = ReadWRAM<T>(address);
+            if (m_m68kIdleLoop.observing) [[unlikely]] {
+                RecordM68KIdleLoopRead<T>(address, value);
+            }
+            return value;
         } else if (util::AddressInRange<0x100000, 0x1FFFFF>(address)) {
+            m_m68kIdleLoop.disqualified = true;
+            if (m_m68kBatch.instrCycle >= m_m68kBatch.syncCycle) {
+                SyncM68KBatch();
+            }
             return ReadReg<T, accessType>(address & 0xFFF);
         } else {
             return 0;
@@ -335,11 +436,35 @@ private:
 
     template <mem_primitive T>
     void Write(uint32 address, T value) {
+        m_m68kIdleLoop.disqualified = true;
+        if (m_m68kBatch.instrCycle >= m_m68kBatch.syncCycle) {
+            SyncM68KBatch();
+        }
         if (util::AddressInRange<0x000000, 0x07FFFF>(address)) {
             WriteWRAM<T>(address, value);
         } else if (util::AddressInRange<0x100000, 0x1FFFFF>(address)) {
             WriteReg<T, SCSPAccessType::M68kData>(address & 0xFFF, value);
+            if (m_m68kBatch.syncCycle != M68KBatch::kNoSync) {
+                // The write may have enabled an interrupt or changed a timer
+                ShortenM68KBatch();
+            }
+        }
+    }
+
+    // Records a sound RAM read made by the MC68EC000 while observing a candidate idle loop.
+    // Reads within reach of the DSP disqualify the loop since the DSP may change the values while it is being skipped.
+    template <mem_primitive T>
+    void RecordM68KIdleLoopRead(uint32 address, T value) {
+        auto &loop = m_m68kIdleLoop;
+        if (loop.numReads == loop.reads.size() || m_dsp.MayWriteWRAM(address)) {
+            loop.disqualified = true;
+            return;
         }
+        loop.reads[loop.numReads++] = {
+            .address = address & 0x7FFFF,
+            .value = value,
+            .word = std::is_same_v<T, uint16>,
+        };
     }
 
     // -------------------------------------------------------------------------
@@ -916,6 +1041,7 @@ private:
     template <bool lowerByte, bool upperByte, bool poke>
     void WriteMCIEB(uint16 value) {
         util::SplitWriteWord<lowerByte, upperByte, 0, 10>(m_scuEnabledInterrupts, value);
+        m_scuInterruptsEnabled.store(m_scuEnabledInterrupts != 0, std::memory_order_relaxed);
         if constexpr (!poke) {
             UpdateSCUInterrupts();
         }
@@ -1153,9 +1279,33 @@ private:
     template <bool debug, bool threaded>
     void TickSample(); // Processes a full sample (512 SCSP cycles)
 
+    template <bool batched>
     void RunM68K(uint64 cycles);
     void UpdateTimers();
 
+    // Runs the MC68EC000 through a new batch of samples.
+    void RunM68KBatch();
+
+    // Processes the next sample of the current MC68EC000 batch.
+    template <bool debug, bool threaded>
+    void ProcessM68KBatchSample();
+
+    // Processes every sample of the current batch that precedes the current MC68EC000 instruction.
+    void SyncM68KBatch();
+
+    // Cuts the current batch short if an interrupt may now be raised earlier than its last sample.
+    void ShortenM68KBatch();
+
+    // Calculates how many samples the MC68EC000 can run ahead of the slots, starting from the current sample.
+    [[nodiscard]] uint32 CalcM68KBatchLength() const;
+
+    // Skips whole iterations of the idle loop that fit in the cycle budget, starting from cy cycles.
+    // Returns the updated cycle count. Leaves idle mode if anything read by the loop has changed.
+    uint64 RunM68KIdle(uint64 cy, uint64 cycles);
+
+    // Starts or continues observing a candidate idle loop after an instruction that started at prevPC.
+    void ObserveM68KIdleLoop(uint32 prevPC, uint64 stepCycles);
+
     // Emulates one slot's worth of cycles.
     // This executes the 7 slot operations once, and 4 DSP program steps.
     template <uint32 stepShift, bool debug>
@@ -1315,22 +1465,24 @@ private:
     };
 
     struct ThreadEvent {
-        enum class Type { Write, Sample, Quit };
+        enum class Type { Write, Advance, Quit };
 
         Type type;
         WriteEvent write;
+        uint32 samples; // number of samples to process for Advance events
 
         static ThreadEvent Write(uint32 address, uint32 value, uint8 size) {
             return ThreadEvent{.type = Type::Write,
-                               .write = WriteEvent{.address = address, .value = value, .size = size}};
+                               .write = WriteEvent{.address = address, .value = value, .size = size},
+                               .samples = 0};
         }
 
-        static ThreadEvent Sample() {
-            return ThreadEvent{.type = Type::Sample};
+        static ThreadEvent Advance(uint32 samples) {
+            return ThreadEvent{.type = Type::Advance, .write = {}, .samples = samples};
         }
 
         static ThreadEvent Quit() {
-            return ThreadEvent{.type = Type::Quit};
+            return ThreadEvent{.type = Type::Quit, .write = {}, .samples = 0};
         }
     };
 
@@ -1341,6 +1493,18 @@ private:
     std::atomic<uint64> m_eventsProcessed = 0;
     uint64 m_eventsEnqueued = 0;
 
+    // Set while SyncSCSPThread() waits for the SCSP thread, which only notifies m_eventsProcessed when this is set
+    std::atomic<bool> m_syncWaiting = false;
+
+    // Events are collected here by the emulator thread and submitted to the queue in bulk.
+    // Consecutive samples are merged into a single Advance event, and writes are ordered between them by the sample in
+    // which they happened. The batch is submitted once it spans kMaxPendingSamples samples, when the buffer fills up or
+    // when the emulator thread needs to synchronize with the SCSP thread.
+    static constexpr uint32 kMaxPendingSamples = 16;
+    std::array<ThreadEvent, 64> m_pendingEvents;
+    size_t m_numPendingEvents = 0;
+    uint32 m_numPendingSamples = 0;
+
     moodycamel::BlockingConcurrentQueue<ThreadEvent, ConcQueueTraits> m_threadEventQueue;
     moodycamel::ProducerToken m_ptokThreadEventQueue{m_threadEventQueue};
     moodycamel::ConsumerToken m_ctokThreadEventQueue{m_threadEventQueue};
@@ -1351,6 +1515,10 @@ private:
     std::atomic<bool> m_scspInterruptLevel{false};
     bool m_lastSCSPInterruptLevel = false;
 
+    // Whether any sound request interrupt is enabled in MCIEB. While set, samples are submitted to the SCSP thread as
+    // soon as they are ticked so that the interrupts reach the SCU without waiting for a full batch.
+    std::atomic<bool> m_scuInterruptsEnabled{false};
+
     sys::SH2Bus *m_bus = nullptr;
 
     // Thread running the SCSP DSP and M68K CPU.
@@ -1372,6 +1540,9 @@ private:
     // Queues an event to be processed by the SCSP thread.
     void EnqueueEvent(ThreadEvent &&event);
 
+    // Submits all pending events to the SCSP thread.
+    void FlushEvents();
+
     void MapMemoryDirect(sys::SH2Bus &bus);
     void MapMemoryThreaded(sys::SH2Bus &bus);
 
@@ -4,6 +4,8 @@
 
 #include "scsp_dsp_instr.hpp"
 
+#include <ymir/sys/memory_layout.hpp>
+
 #include <ymir/core/types.hpp>
 
 #include <ymir/util/bit_ops.hpp>
@@ -234,6 +236,15 @@ public:
         m_RBL = (0x2000u << static_cast<uint32>(ringBufferLength)) - 1u;
     }
 
+    // Determines if the DSP may write to the given sound RAM byte address.
+    // Writes reach up to 64 Ki words past the ring buffer lead address when bypassing the ring buffer length mask.
+    [[nodiscard]] FORCE_INLINE bool MayWriteWRAM(uint32 address) const noexcept {
+        if (m_programLength == 0 && !m_writePending) {
+            return false;
+        }
+        return ((address & 0x7FFFF) - m_RBP * sizeof(uint16)) < 0x10000 * sizeof(uint16);
+    }
+
     // -------------------------------------------------------------------------
     // Save states
 
@@ -285,7 +296,7 @@ private:
     [[nodiscard]] FORCE_INLINE uint16 ReadWRAM() const {
         const uint32 address = m_readWriteAddr * sizeof(uint16);
         if (address < 0x80000) {
-            return util::ReadBE<uint16>(&m_WRAM[address]);
+            return sys::ReadMemory<uint16>(m_WRAM, address);
         } else {
             return 0;
         }
@@ -294,7 +305,7 @@ private:
     FORCE_INLINE void WriteWRAM() const {
         const uint32 address = m_readWriteAddr * sizeof(uint16);
         if (address < 0x80000) {
-            util::WriteBE<uint16>(&m_WRAM[address], m_writeValue);
+            sys::WriteMemory<uint16>(m_WRAM, address, m_writeValue);
         }
     }
 };
@@ -31,6 +31,12 @@ struct Timer {
         return counter == 0xFF;
     }
 
+    // Returns the number of ticks until Tick() returns true, from 1 to 256.
+    [[nodiscard]] uint32 TicksUntilTrigger() const noexcept {
+        const uint8 prevCounter = doReload ? reload - 1u : counter;
+        return ((0xFEu - prevCounter) & 0xFFu) + 1u;
+    }
+
     [[nodiscard]] uint8 ReadTIMx() const noexcept {
         return reload;
     }
@@ -248,7 +248,16 @@ private:
     // Total number of cycles executed since the latest hard reset
     uint64 m_totalCycles;
 
+    // Value of m_totalCycles at the start of the current Advance or Step invocation.
+    // The ITU counters run on this time base. They are only brought up to date when the next compare match or overflow
+    // is due or when ITU registers are accessed.
+    uint64 m_sliceStartCycles;
+
+    // Cycle count at which the next ITU compare match or overflow happens
+    uint64 m_nextITUEventCycles;
+
     void AdvanceITU();
+    void UpdateNextITUEvent();
     void AdvanceSCI();
     void AdvanceDMA(uint64 cycles);
 
@@ -344,14 +353,22 @@ private:
     RegSBYCR SBYCR; // 1BC  R/W  8,16,32  1F        SBYCR   Standby Control Register
     bool m_sleep;
 
-    bool StepDMAC(uint32 channel);
+    // Transfers up to maxUnits units on the channel, stopping early if the transfer ends or the request is withdrawn.
+    // Returns the number of units transferred.
+    uint32 StepDMAC(uint32 channel, uint32 maxUnits);
+    uint32 BurstDMAC(uint32 channel, uint32 maxUnits, sint32 srcInc, sint32 dstInc);
+    void EndDMATransfer(uint32 channel);
     bool IsDMATransferActive(const DMAController::DMAChannel &ch) const;
     void DMAC0DREQTransfer(std::span<uint8> data);
 
     void StepDMAC1(uint32 size) {
-        const uint32 count = DMAC.channels[1].xferSize == DMATransferSize::Word ? (size + 1u) / sizeof(uint16) : size;
-        for (uint32 i = 0; i < count; ++i) {
-            StepDMAC(1);
+        uint32 count = DMAC.channels[1].xferSize == DMATransferSize::Word ? (size + 1u) / sizeof(uint16) : size;
+        while (count > 0) {
+            const uint32 units = StepDMAC(1, count);
+            if (units == 0) {
+                break;
+            }
+            count -= units;
         }
     }
 
@@ -11,11 +11,13 @@
 
 namespace ymir::sh1 {
 
-/// @brief Receive a bit from one of the SH-1's SCI channels.
-using CbSerialRx = util::RequiredCallback<bool()>;
+/// @brief Receive a byte from one of the SH-1's SCI channels.
+/// Invoked once per frame at the time its last bit is clocked.
+using CbSerialRx = util::RequiredCallback<uint8()>;
 
-/// @brief Send a bit to one of the SH-1's SCI channels.
-using CbSerialTx = util::RequiredCallback<void(bool bit)>;
+/// @brief Send a byte to one of the SH-1's SCI channels.
+/// Invoked once per frame at the time its last bit is clocked, after receiving the byte shifted in during the frame.
+using CbSerialTx = util::RequiredCallback<void(uint8 value)>;
 
 /// @brief Invoked to raise an IRQ signal on the SH-1.
 using CBAssertIRQ = util::RequiredCallback<void()>;
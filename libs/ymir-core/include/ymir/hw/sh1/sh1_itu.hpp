@@ -7,7 +7,9 @@
 #include <ymir/util/bit_ops.hpp>
 #include <ymir/util/inline.hpp>
 
+#include <algorithm>
 #include <array>
+#include <limits>
 
 namespace ymir::sh1 {
 
@@ -283,6 +285,44 @@ struct IntegratedTimerPulseUnit {
             currCycles = 0;
         }
 
+        // Returns the cycle count at which the counter reaches the next compare match or overflows.
+        // Returns the maximum cycle count if the timer is stopped or clocked by an external signal.
+        FORCE_INLINE uint64 NextEventCycles() const {
+            if (!started || prescaler > Prescaler::Phi8) {
+                return std::numeric_limits<uint64>::max();
+            }
+            const uint64 shift = static_cast<uint64>(prescaler);
+            const uint64 stepsToGRA = static_cast<uint16>(GRA - counter) + 1ull;
+            const uint64 stepsToGRB = static_cast<uint16>(GRB - counter) + 1ull;
+            const uint64 stepsToOVF = 0x10000ull - counter;
+            const uint64 steps = std::min({stepsToGRA, stepsToGRB, stepsToOVF});
+            return ((currCycles >> shift) + steps) << shift;
+        }
+
+        // Returns the number of counter steps elapsed between the last advance and the specified cycle count.
+        // Returns 0 if the timer is clocked by an external signal.
+        FORCE_INLINE uint64 StepsUntil(uint64 cycles) const {
+            if (prescaler > Prescaler::Phi8) {
+                return 0; // TCLKA to TCLKD, not implemented
+            }
+            const uint64 shift = static_cast<uint64>(prescaler);
+            return (cycles >> shift) - (currCycles >> shift);
+        }
+
+        // Computes the counter value the timer would have if advanced to the specified cycle count, without modifying
+        // its state.
+        [[nodiscard]] uint16 CounterAt(uint64 cycles) const {
+            if (!started) {
+                return counter;
+            }
+            const uint64 steps = StepsUntil(cycles);
+            if ((clearMode == ClearMode::GRA && static_cast<uint16>(GRA - counter) < steps) ||
+                (clearMode == ClearMode::GRB && static_cast<uint16>(GRB - counter) < steps)) {
+                return 0;
+            }
+            return counter + steps;
+        }
+
         // 104  R/W  8        80/00     TCR0    Timer control register 0
         // 10E  R/W  8        80/00     TCR1    Timer control register 1
         // 118  R/W  8        80/00     TCR2    Timer control register 2
@@ -457,8 +497,13 @@ struct IntegratedTimerPulseUnit {
         //                            Channel 3: Increment/decrement in complementary PWM mode, increment otherwise
         //                            Channel 4: Increment/decrement in complementary PWM mode, increment otherwise
 
-        FORCE_INLINE uint16 ReadTCNT() const {
-            return counter;
+        template <bool peek>
+        FORCE_INLINE uint16 ReadTCNT(uint64 cycles) const {
+            if constexpr (peek) {
+                return CounterAt(cycles);
+            } else {
+                return counter;
+            }
         }
 
         FORCE_INLINE void WriteTCNT(uint16 value) {
@@ -659,7 +704,7 @@ struct IntegratedTimerPulseUnit {
         // Only valid for channels 3 and 4.
         uint16 BRA, BRB;
 
-        // Current cycles count.
+        // Cycle count up to which the counter has been advanced.
         uint64 currCycles;
     };
 
@@ -8,6 +8,7 @@
 #include <ymir/util/inline.hpp>
 
 #include <array>
+#include <bit>
 
 namespace ymir::sh1 {
 
@@ -133,36 +134,37 @@ struct SerialCommunicationInterface {
             parityErrorMask = false;
         }
 
-        // Transmits a bit. Returns the value of the bit to be transmitted.
-        bool TransmitBit() {
-            const bool value = TSR & TSRbit;
-            TSRbit <<= 1u;
-            if (TSRbit == 0u) {
-                // TODO: should probably check txEmpty instead
-                if (TDRvalid) {
-                    TSRbit = 1u;
-                    TSR = TDR;
-                    TDRvalid = false;
-                    txEmpty = true;
-                } else {
-                    txEnd = true;
-                }
-            }
-            return value;
+        // Returns the number of bits left to shift until the current frame ends.
+        // Frames follow the transmitter if enabled, otherwise the receiver. An idle transmitter takes a single bit to
+        // pick up the next byte from TDR.
+        FORCE_INLINE uint32 FrameBitsLeft() const {
+            const uint8 shiftBit = txEnable ? TSRbit : RSRbit;
+            return shiftBit == 0u ? 1u : 8u - std::countr_zero(shiftBit);
         }
 
-        // Receives the specified bit.
-        void ReceiveBit(bool value) {
-            if (value) {
-                RSR |= RSRbit;
-            }
-            RSRbit <<= 1u;
-            if (RSRbit == 0u) {
-                RSRbit = 1u;
-                RDR = RSR;
-                RSR = 0u;
-                rxFull = true;
+        // Finishes transmitting the byte in TSR, then reloads TSR from TDR if a new value was written to it.
+        // Returns true if a byte was shifted out or false if the transmitter was idle.
+        FORCE_INLINE bool TransmitByte() {
+            const bool shifted = TSRbit != 0u;
+            // TODO: should probably check txEmpty instead
+            if (TDRvalid) {
+                TSRbit = 1u;
+                TSR = TDR;
+                TDRvalid = false;
+                txEmpty = true;
+            } else {
+                TSRbit = 0u;
+                txEnd = true;
             }
+            return shifted;
+        }
+
+        // Finishes receiving a byte and transfers it to RDR.
+        FORCE_INLINE void ReceiveByte(uint8 value) {
+            RSRbit = 1u;
+            RDR = value;
+            RSR = 0u;
+            rxFull = true;
         }
 
         // Current absolute cycle count.
@@ -376,19 +378,21 @@ struct SerialCommunicationInterface {
         }
 
         // Receive Shift Register.
-        // Receives data bit by bit in LSB to MSB order.
-        // Once a full byte is received, it is transferred to RDR.
+        // Receives data in LSB to MSB order.
+        // The whole byte is received from the peer at the end of the frame and transferred to RDR.
         uint8 RSR;
 
         // Current bit to be written to RSR.
+        // Frames are exchanged whole, so this is only past the first bit when resuming an older save state.
         uint8 RSRbit;
 
         // Transmit Shift Register.
-        // Used to transmit data bit by bit in LSB to MSB order.
-        // Once a full byte is sent, a new byte transferred from TDR.
+        // Used to transmit data in LSB to MSB order.
+        // The whole byte is sent to the peer at the end of the frame, then a new byte is transferred from TDR.
         uint8 TSR;
 
-        // Current bit to be written to RSR.
+        // Current bit to be read from TSR, or zero if the transmitter is idle.
+        // Frames are exchanged whole, so this is only past the first bit when resuming an older save state.
         uint8 TSRbit;
 
         // Whether to use synchronous (true) or asynchronous (false) communication mode.
@@ -123,6 +123,7 @@ public:
     // Pass nullptr to disable tracing.
     void UseTracer(debug::ISH2Tracer *tracer) {
         if (m_tracer != nullptr) {
+            FlushTraceRecords();
             m_tracer->Detached();
         }
         m_tracer = tracer;
@@ -995,6 +996,62 @@ private:
 
     std::array<bool, 2> m_dmacTraced; // whether each DMA channel has had a transfer traced
 
+    // Tracer records buffered in debug tracing mode.
+    // Delivered to the tracer in bulk at the end of Advance and Step, or as soon as the buffer fills up.
+    std::array<debug::SH2TraceRecord, 512> m_traceRecords;
+    size_t m_traceRecordCount = 0;
+
+    // Buffers a tracer record. Must only be invoked while a tracer is attached.
+    void PushTraceRecord(const debug::SH2TraceRecord &record);
+
+    // Delivers all buffered tracer records to the tracer.
+    void FlushTraceRecords();
+
+    void TraceReset(uint32 pc, uint32 sp, bool watchdogInitiated);
+    template <bool debug>
+    void TraceExecuteInstruction(uint32 pc, uint16 opcode, bool delaySlot);
+    template <bool debug>
+    void TraceDelaySlot(uint32 pc, uint32 target);
+    template <bool debug>
+    void TraceBranch(uint32 pc, uint32 target);
+    template <bool debug>
+    void TraceBranchDelay(uint32 target);
+    template <bool debug>
+    void TraceCall(uint32 target);
+    template <bool debug>
+    void TraceReturn(uint32 target);
+    template <bool debug>
+    void TraceReturnFromException(uint32 target, uint32 newSP);
+    template <bool debug>
+    void TraceInterrupt(uint8 vecNum, uint8 level, InterruptSource source, uint32 pc);
+    template <bool debug>
+    void TraceException(uint8 vecNum, uint32 oldPC, uint32 oldSR, uint32 oldSP, uint32 newPC);
+    template <bool debug>
+    void TraceTrap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC);
+    template <bool debug>
+    void TraceChangeStack(uint8 reg, uint32 newSP);
+    template <bool debug>
+    void TraceResizeStack(uint8 reg, uint32 oldSP, uint32 newSP);
+    template <bool debug>
+    void TracePushRegisterToStack(uint8 reg, uint8 rn, uint32 oldSP, uint32 newSP);
+    template <bool debug>
+    void TracePushToStack(uint8 reg, debug::SH2StackValueType type, uint32 newSP);
+    template <bool debug>
+    void TracePopFromStack(uint8 reg, uint32 newSP);
+    template <bool debug>
+    void TraceBegin32x32Division(sint32 dividend, sint32 divisor, bool overflowIntrEnable);
+    template <bool debug>
+    void TraceBegin64x32Division(sint64 dividend, sint32 divisor, bool overflowIntrEnable);
+    template <bool debug>
+    void TraceEndDivision(sint32 quotient, sint32 remainder, bool overflow);
+    template <bool debug>
+    void TraceDMAXferBegin(uint32 channel, uint32 srcAddress, uint32 dstAddress, uint32 count, uint32 unitSize,
+                           sint32 srcInc, sint32 dstInc);
+    template <bool debug>
+    void TraceDMAXferData(uint32 channel, uint32 srcAddress, uint32 dstAddress, uint32 data, uint32 unitSize);
+    template <bool debug>
+    void TraceDMAXferEnd(uint32 channel, bool irqRaised);
+
     static constexpr size_t kBitsPerByte = 8ull; // asserted in ymir.cpp
     static constexpr size_t kAddressSpaceSize = 1ull << 32ull;
     static constexpr size_t kInstructionSize = sizeof(uint16); // breakpoints must be instruction-aligned
@@ -53,12 +53,16 @@ public:
     /// @brief Applies the enhancements configuration to this renderer.
     /// @param[in] enhancements the enhancements configuration to apply
     void ConfigureEnhancements(const config::Enhancements &enhancements) {
+        PreUpdateEnhancementsSync();
         m_enhancements = enhancements;
         m_hasEnhancements = enhancements.AnyEnabled();
         UpdateEnhancements();
     }
 
 protected:
+    /// @brief Performs any necessary synchronization before the enhancement configurations are changed.
+    virtual void PreUpdateEnhancementsSync() {}
+
     /// @brief Updates enhancement configurations.
     virtual void UpdateEnhancements() {}
 
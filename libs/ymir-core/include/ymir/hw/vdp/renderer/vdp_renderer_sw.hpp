@@ -26,9 +26,12 @@
 
 #include <array>
 #include <atomic>
+#include <bitset>
+#include <memory>
 #include <span>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace ymir::vdp {
 
@@ -68,6 +71,7 @@ public:
     // -------------------------------------------------------------------------
     // Configuration
 
+    void PreUpdateEnhancementsSync() override;
     void UpdateEnhancements() override;
 
     /// @brief Software renderer callbacks.
@@ -175,12 +179,17 @@ private:
     // field lines complementary to the standard VDP1 framebuffer memory (e.g. while displaying odd lines, this buffer
     // contains even lines).
     // VDP2 rendering will combine both buffers to draw a full-resolution progressive image in one go.
-    alignas(16) std::array<SpriteFB, 2> m_altSpriteFB;
+    // Only allocated while deinterlacing is enabled.
+    std::unique_ptr<std::array<SpriteFB, 2>> m_altSpriteFB;
 
     // Transparent mesh sprite framebuffer.
-    // Used when transparent meshes are enabled.
+    // Only allocated while transparent meshes are enabled.
     // Indexing: [altFB][drawFB]
-    alignas(16) std::array<std::array<SpriteFB, 2>, 2> m_meshFB;
+    std::unique_ptr<std::array<std::array<SpriteFB, 2>, 2>> m_meshFB;
+
+    // Allocates the buffers used by enabled enhancements and releases those of disabled enhancements.
+    // Must be called while the render threads are idle.
+    void UpdateEnhancementBuffers();
 
     // -------------------------------------------------------------------------
     // Threading
@@ -198,6 +207,7 @@ private:
 
             EraseFramebuffer,
             SwapBuffers,
+            BeginDraw,
             EndDraw,
             Command,
 
@@ -231,7 +241,7 @@ private:
         };
 
         static VDP1RenderEvent Reset() {
-            return {Type::Reset};
+            return {Type::Reset, {}};
         }
 
         static VDP1RenderEvent EraseFramebuffer(uint64 cycles) {
@@ -239,11 +249,15 @@ private:
         }
 
         static VDP1RenderEvent SwapBuffers() {
-            return {Type::SwapBuffers};
+            return {Type::SwapBuffers, {}};
+        }
+
+        static VDP1RenderEvent BeginDraw() {
+            return {Type::BeginDraw, {}};
         }
 
         static VDP1RenderEvent EndDraw() {
-            return {Type::EndDraw};
+            return {Type::EndDraw, {}};
         }
 
         static VDP1RenderEvent Command(uint32 address, VDP1Command::Control control) {
@@ -291,15 +305,15 @@ private:
         }
 
         static VDP1RenderEvent PreSaveStateSync() {
-            return {Type::PreSaveStateSync};
+            return {Type::PreSaveStateSync, {}};
         }
 
         static VDP1RenderEvent PostLoadStateSync() {
-            return {Type::PostLoadStateSync};
+            return {Type::PostLoadStateSync, {}};
         }
 
         static VDP1RenderEvent Shutdown() {
-            return {Type::Shutdown};
+            return {Type::Shutdown, {}};
         }
     };
 
@@ -333,12 +347,15 @@ private:
 
         void EnqueueEvent(VDP1RenderEvent &&event) {
             switch (event.type) {
+            case VDP1RenderEvent::Type::Command:
             case VDP1RenderEvent::Type::VRAMWriteByte:
             case VDP1RenderEvent::Type::VRAMWriteWord:
             case VDP1RenderEvent::Type::FBRAMWriteByte:
             case VDP1RenderEvent::Type::FBRAMWriteWord:
             case VDP1RenderEvent::Type::RegWrite:
-                // Batch these writes to send in bulk
+                // Batch commands and writes to send in bulk.
+                // Commands stay interleaved with the writes around them, so the render thread sees VRAM and registers
+                // exactly as they were when the emulator thread executed each command.
                 pendingEvents[pendingEventsCount++] = event;
                 if (pendingEventsCount == pendingEvents.size()) {
                     FlushPendingEvents();
@@ -635,6 +652,160 @@ private:
         Color555 gouraudRight;
     };
 
+    // Cache of decoded VDP1 character patterns.
+    //
+    // Textured commands look up an entry keyed by character address, size, color mode and color bank. Texel rows are
+    // decoded on first use, packing the 16-bit color value with the transparent and end code flags, and reused by all
+    // subsequent draws of the same pattern. Entries are invalidated when any VRAM page covering their character data
+    // or color lookup table is written to.
+    //
+    // Decoded texels are carved out of a shared arena sized for a typical frame's worth of patterns rather than
+    // reserving room for the largest pattern in every entry. The arena is allocated on first use, and the whole cache is
+    // cleared when it runs out of space.
+    //
+    // The cache mirrors the VRAM used by the renderer, so it must only be accessed by the thread that processes VDP1
+    // commands: the VDP1 render thread if threaded rendering is enabled, or the emulator thread otherwise.
+    struct VDP1TextureCache {
+        static constexpr uint32 kPageShift = 12; // 4 KiB pages
+        static constexpr uint32 kNumPages = kVDP1VRAMSize >> kPageShift;
+        static constexpr uint32 kNumEntries = 256;       // must be a power of two
+        static constexpr uint32 kMaxTexels = 64 * 64;     // larger patterns bypass the cache
+        static constexpr uint32 kArenaTexels = 64 * 1024; // 256 KiB
+
+        static constexpr uint32 kTexelTransparent = 1u << 16u;
+        static constexpr uint32 kTexelEndCode = 1u << 17u;
+
+        using PageMask = std::array<uint64, kNumPages / 64>;
+
+        struct Key {
+            uint32 charAddr;
+            uint32 colorBank;
+            uint16 charSizeH;
+            uint8 charSizeV;
+            uint8 colorMode;
+
+            bool operator==(const Key &) const = default;
+        };
+
+        struct Entry {
+            Key key;
+            bool valid = false;
+            PageMask pages;
+            std::bitset<256> rowValid;
+            uint32 texelOffset; // offset of the decoded texels in the arena
+        };
+
+        std::array<Entry, kNumEntries> entries;
+        PageMask watchedPages{};
+
+        std::vector<uint32> arena;
+        uint32 arenaUsed = 0;
+
+        void Clear() {
+            for (auto &entry : entries) {
+                entry.valid = false;
+            }
+            watchedPages.fill(0);
+            arenaUsed = 0;
+        }
+
+        // Reserves space for count texels in the arena, clearing the cache if it is full.
+        // count must not exceed kMaxTexels.
+        uint32 AllocateTexels(uint32 count) {
+            if (arena.empty()) {
+                arena.resize(kArenaTexels);
+            }
+            if (arenaUsed + count > kArenaTexels) {
+                Clear();
+            }
+            const uint32 offset = arenaUsed;
+            arenaUsed += count;
+            return offset;
+        }
+
+        // Invalidates all entries that use the VRAM page containing the given address.
+        FORCE_INLINE void InvalidatePage(uint32 address) {
+            const uint32 page = (address & (kVDP1VRAMSize - 1)) >> kPageShift;
+            const uint64 bit = 1ull << (page & 63u);
+            uint64 &watched = watchedPages[page >> 6u];
+            if ((watched & bit) == 0) {
+                return;
+            }
+            watched &= ~bit;
+            for (auto &entry : entries) {
+                if (entry.pages[page >> 6u] & bit) {
+                    entry.valid = false;
+                }
+            }
+        }
+    } m_VDP1TexCache;
+
+    // Reuse of VDP1 frames drawn from unchanged command lists.
+    //
+    // Every executed command is fingerprinted together with the VRAM it references (command table entry, character
+    // pattern, color lookup table and gouraud table) and the registers that affect drawing. The fingerprint chain starts
+    // from the contents of the draw framebuffer and the clipping/local coordinate state at the beginning of the frame.
+    // While the fingerprints match those of the last completed frame, commands are deferred instead of drawn. If the
+    // whole list matches, the output of that frame is copied into the draw framebuffer and the deferred commands are
+    // dropped.
+    //
+    // Deferred commands are drawn as soon as anything else could affect or observe their output: a mismatching command,
+    // a write to a VRAM page they reference, a register or framebuffer write, a framebuffer swap or a save state.
+    //
+    // Only used with threaded VDP1 rendering, where all of these events arrive in order on the VDP1 render thread, and
+    // when no enhancements are enabled, since those draw to additional framebuffers.
+    struct VDP1FrameReuse {
+        struct DeferredCommand {
+            uint32 address;
+            VDP1Command::Control control;
+        };
+
+        // Current frame
+        bool drawing = false;  // true between BeginDraw and EndDraw if frame reuse is enabled
+        bool matching = false; // true while all commands of the frame matched the last completed frame
+        uint64 startHash = 0;
+        std::vector<uint64> cmdHashes;
+        std::vector<DeferredCommand> deferred;
+        VDP1TextureCache::PageMask deferredPages{};
+
+        // Last completed frame
+        bool prevValid = false;
+        uint64 prevStartHash = 0;
+        std::vector<uint64> prevCmdHashes;
+        VDP1State prevEndState;
+        alignas(16) SpriteFB prevFB;
+
+        void Reset() {
+            drawing = false;
+            matching = false;
+            cmdHashes.clear();
+            deferred.clear();
+            deferredPages.fill(0);
+            prevValid = false;
+            prevCmdHashes.clear();
+        }
+    } m_VDP1FrameReuse;
+
+    // Starts fingerprinting a new VDP1 frame. Must be called from the VDP1 render thread.
+    void VDP1ReuseBeginDraw();
+
+    // Fingerprints and either defers or draws a VDP1 command. Must be called from the VDP1 render thread.
+    void VDP1ReuseExecuteCommand(uint32 cmdAddress, VDP1Command::Control control);
+
+    // Finishes the current VDP1 frame, reusing the output of the last completed frame if possible.
+    void VDP1ReuseEndDraw();
+
+    // Draws all deferred commands.
+    void VDP1ReuseFlush();
+
+    // Draws all deferred commands and stops matching the current frame.
+    void VDP1ReuseAbort();
+
+    // Computes the fingerprint of a command and everything it reads from VRAM, chained from the given seed.
+    // Marks the VRAM pages read by the command in the given page mask.
+    uint64 VDP1CalcCommandFingerprint(uint32 cmdAddress, VDP1Command::Control control, uint64 seed,
+                                      VDP1TextureCache::PageMask &pages);
+
     struct VDP1TexturedLineParams {
         VDP1Command::Control control;
         VDP1Command::DrawMode mode;
@@ -645,8 +816,21 @@ private:
         TextureStepper texVStepper;
         const GouraudStepper *gouraudLeft;
         const GouraudStepper *gouraudRight;
+        VDP1TextureCache::Entry *texture; // null if the pattern is not cached
     };
 
+    // Finds or creates the texture cache entry for the pattern used by a textured command.
+    // Returns nullptr if the pattern cannot be cached.
+    VDP1TextureCache::Entry *VDP1LookupTexture(const VDP1TexturedLineParams &lineParams);
+
+    // Retrieves a row of decoded texels from a texture cache entry, decoding it if necessary.
+    const uint32 *VDP1GetTextureRow(VDP1TextureCache::Entry &entry, const VDP1TexturedLineParams &lineParams,
+                                    uint32 v);
+
+    // Reads and decodes a single texel of a textured command.
+    // Returns the 16-bit color value combined with the VDP1TextureCache::kTexel* flags.
+    uint32 VDP1DecodeTexel(const VDP1TexturedLineParams &lineParams, uint32 u, uint32 charIndex);
+
     // Retrieves the current set of VDP1 registers.
     VDP1Regs &VDP1GetRegs();
 
@@ -775,23 +959,38 @@ private:
 
         void Reset() {
             colorCalcRatio.fill(0);
-            shadowOrWindow.fill(false);
-            specialType.fill(SpriteData::Special::Normal);
-            window.fill(false);
+            shadowOrWindow.Fill(false);
+            specialShadow.Fill(false);
+            specialTransparent.Fill(false);
+            window.Fill(false);
         }
 
         void CopyAttrs(size_t src, size_t dst) {
             colorCalcRatio[dst] = colorCalcRatio[src];
-            shadowOrWindow[dst] = shadowOrWindow[src];
-            specialType[dst] = specialType[src];
+            shadowOrWindow.Set(dst, shadowOrWindow[src]);
+            specialShadow.Set(dst, specialShadow[src]);
+            specialTransparent.Set(dst, specialTransparent[src]);
             // window is computed separately
         }
 
+        FORCE_INLINE void SetSpecialType(size_t x, SpriteData::Special type) {
+            specialShadow.Set(x, type == SpriteData::Special::Shadow);
+            specialTransparent.Set(x, type == SpriteData::Special::Transparent);
+        }
+
+        // Returns a word of the mask of pixels with the SpriteData::Special::Normal type.
+        FORCE_INLINE uint64 NormalWord(uint32 index) const {
+            return ~(specialShadow.words[index] | specialTransparent.words[index]);
+        }
+
         alignas(16) std::array<uint8, kMaxResH> colorCalcRatio;
-        alignas(16) std::array<bool, kMaxResH> shadowOrWindow;
-        alignas(16) std::array<SpriteData::Special, kMaxResH> specialType;
+        LineMask shadowOrWindow;
 
-        alignas(16) std::array<bool, kMaxResH> window;
+        // Special sprite pixel types. Pixels that are neither shadow nor transparent are normal.
+        LineMask specialShadow;
+        LineMask specialTransparent;
+
+        LineMask window;
     };
 
     // Scanline output for Rotation Parameters A and B.
@@ -854,7 +1053,6 @@ private:
     std::array<std::array<VRAMFetcher, 6>, 2> m_vramFetchers;
 
     // Common layer outputs.
-    // Entry [0] is primary and [1] is alternate field for deinterlacing.
     //     RBG0+RBG1   RBG0        RBG1        no RBGs
     // [0] Sprite      Sprite      Sprite      Sprite
     // [1] RBG0        RBG0        -           -
@@ -862,7 +1060,18 @@ private:
     // [3] EXBG        NBG1/EXBG   NBG1/EXBG   NBG1/EXBG
     // [4] -           NBG2        NBG2        NBG2
     // [5] -           NBG3        NBG3        NBG3
-    std::array<std::array<LayerOutput, 6>, 2> m_layerOutputs;
+    using LayerOutputs = std::array<LayerOutput, 6>;
+
+    // Layer outputs for the primary field.
+    LayerOutputs m_layerOutputs;
+
+    // Layer outputs for the alternate field. Only allocated while deinterlacing is enabled.
+    std::unique_ptr<LayerOutputs> m_altLayerOutputs;
+
+    // Retrieves the layer outputs for the primary or alternate field.
+    FORCE_INLINE LayerOutputs &VDP2GetLayerOutputs(bool altField) {
+        return altField ? *m_altLayerOutputs : m_layerOutputs;
+    }
 
     // Sprite layer attributes.
     // Entry [0] is primary and [1] is alternate field for deinterlacing.
@@ -870,7 +1079,8 @@ private:
 
     // Transparent mesh layer outputs.
     // Entry [0] is primary and [1] is alternate field for deinterlacing.
-    std::array<LayerOutput, 2> m_meshLayerOutput;
+    // Only allocated while transparent meshes are enabled.
+    std::unique_ptr<std::array<LayerOutput, 2>> m_meshLayerOutput;
 
     // Transparent mesh sprite layer attributes.
     // Entry [0] is primary and [1] is alternate field for deinterlacing.
@@ -889,15 +1099,15 @@ private:
     // [2] NBG1/EXBG
     // [3] NBG2
     // [4] NBG3
-    alignas(16) std::array<std::array<std::array<bool, kMaxResH>, 5>, 2> m_bgWindows;
+    std::array<std::array<LineMask, 5>, 2> m_bgWindows;
 
     // Window state for rotation parameters.
     // Entry [0] is primary and [1] is alternate field for deinterlacing.
-    alignas(16) std::array<std::array<bool, kMaxResH>, 2> m_rotParamsWindow;
+    std::array<LineMask, 2> m_rotParamsWindow;
 
     // Window state for color calculation.
     // Entry [0] is primary and [1] is alternate field for deinterlacing.
-    alignas(16) std::array<std::array<bool, kMaxResH>, 2> m_colorCalcWindow;
+    std::array<LineMask, 2> m_colorCalcWindow;
 
     // Pre-allocated buffers for VDP2ComposeLine.
     // NOTE: These are stored as member variables to avoid stack overflow on threads with limited stack space
@@ -929,6 +1139,17 @@ private:
     // Indexing: [altField]
     std::array<ComposeLineBuffers, 2> m_composeLineBuffers;
 
+    // Pre-allocated buffers for VDP2DrawNormalBitmapLine.
+    // NOTE: Stored as member variables for the same reason as ComposeLineBuffers.
+    struct BitmapLineBuffers {
+        alignas(16) std::array<uint8, kMaxResH * sizeof(uint32) + 16> lineData; // raw dots staged in 8-byte chunks
+        alignas(16) std::array<Color888, kMaxResH> rgbColors;
+    };
+
+    // Pre-allocated buffers for VDP2DrawNormalBitmapLine for primary and alternate fields.
+    // Indexing: [altField]
+    std::array<BitmapLineBuffers, 2> m_bitmapLineBuffers;
+
     // Current display framebuffer.
     std::array<uint32, kMaxResH * kMaxResV> m_framebuffer;
 
@@ -994,7 +1215,7 @@ private:
     // altField selects the complementary field when rendering deinterlaced frames
     template <bool altField, bool hasSpriteWindow>
     void VDP2CalcWindow(uint32 y, const VDP2Regs &regs2, const WindowSet<hasSpriteWindow> &windowSet,
-                        std::span<bool> windowState);
+                        LineMask &windowState);
 
     // Precalculates window state for a given set of parameters using AND or OR logic.
     //
@@ -1007,7 +1228,7 @@ private:
     // logicOR determines if the windows should be combined with OR logic (true) or AND logic (false)
     template <bool altField, bool logicOR, bool hasSpriteWindow>
     void VDP2CalcWindowLogic(uint32 y, const VDP2Regs &regs2, const WindowSet<hasSpriteWindow> &windowSet,
-                             std::span<bool> windowState);
+                             LineMask &windowState);
 
     // Prepares the specified VDP2 scanline for rendering.
     //
@@ -1116,7 +1337,7 @@ private:
               bool deinterlace>
     void VDP2DrawNormalScrollBG(const VDP2Regs &regs2, const BGParams &bgParams, LayerOutput &layerOut,
                                 const NBGLayerState &bgState, VRAMFetcher &vramFetcher,
-                                std::span<const bool> windowState, bool altField);
+                                const LineMask &windowState, bool altField);
 
     // Draws a normal bitmap BG scanline.
     //
@@ -1135,7 +1356,27 @@ private:
     template <ColorFormat colorFormat, uint32 colorMode, bool useVCellScroll, bool deinterlace>
     void VDP2DrawNormalBitmapBG(const VDP2Regs &regs2, const BGParams &bgParams, LayerOutput &layerOut,
                                 const NBGLayerState &bgState, VRAMFetcher &vramFetcher,
-                                std::span<const bool> windowState, bool altField);
+                                const LineMask &windowState, bool altField);
+
+    // Draws a normal bitmap BG scanline with no mosaic, vertical cell scrolling or horizontal zoom.
+    // Fetches contiguous spans of VRAM and expands them into the layer output in bulk. The output and the final state
+    // of the VRAM fetcher match those of the per-pixel path in VDP2DrawNormalBitmapBG.
+    //
+    // regs2 is a reference to the set of VDP2 registers to use
+    // bgParams contains the parameters for the BG to draw.
+    // layerOut is a reference to the layer output for the background.
+    // vramFetcher is the corresponding background layer's VRAM fetcher.
+    // windowState is a reference to the window state for the layer.
+    // scrollX is the integer horizontal scroll coordinate of the first pixel of the line.
+    // scrollY is the integer vertical scroll coordinate of the line.
+    // altField selects the complementary field when rendering deinterlaced frames
+    //
+    // colorFormat is the color format for bitmap data.
+    // colorMode is the CRAM color mode.
+    template <ColorFormat colorFormat, uint32 colorMode>
+    void VDP2DrawNormalBitmapLine(const VDP2Regs &regs2, const BGParams &bgParams, LayerOutput &layerOut,
+                                  VRAMFetcher &vramFetcher, const LineMask &windowState, uint32 scrollX,
+                                  uint32 scrollY, bool altField);
 
     // Draws a rotation scroll BG scanline.
     //
@@ -1153,7 +1394,7 @@ private:
     // colorMode is the CRAM color mode.
     template <uint32 bgIndex, CharacterMode charMode, bool fourCellChar, ColorFormat colorFormat, uint32 colorMode>
     void VDP2DrawRotationScrollBG(const VDP2Regs &regs2, const BGParams &bgParams, LayerOutput &layerOut,
-                                  VRAMFetcher &vramFetcher, std::span<const bool> windowState, bool altField);
+                                  VRAMFetcher &vramFetcher, const LineMask &windowState, bool altField);
 
     // Draws a rotation bitmap BG scanline.
     //
@@ -1168,7 +1409,7 @@ private:
     // colorMode is the CRAM color mode.
     template <uint32 bgIndex, ColorFormat colorFormat, uint32 colorMode>
     void VDP2DrawRotationBitmapBG(const VDP2Regs &regs2, const BGParams &bgParams, LayerOutput &layerOut,
-                                  std::span<const bool> windowState, bool altField);
+                                  const LineMask &windowState, bool altField);
 
     // Stores the line color for the specified pixel of the RBG.
     //
@@ -15,6 +15,7 @@
 #include <ymir/util/size_ops.hpp>
 #include <ymir/util/unreachable.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 
@@ -35,6 +36,72 @@ inline constexpr uint32 kMaxNormalResV = 256; // Maximum vertical resolution in
 inline constexpr uint32 kMaxResH = 704; // Maximum horizontal resolution
 inline constexpr uint32 kMaxResV = 512; // Maximum vertical resolution
 
+// -----------------------------------------------------------------------------
+// Line masks
+
+// A packed set of per-pixel flags covering a full scanline.
+// The flag for pixel X is stored in bit X%64 of word X/64, so that masks can be filled and combined 64 pixels at a time.
+struct LineMask {
+    static constexpr uint32 kNumWords = (kMaxResH + 63) / 64;
+
+    alignas(16) std::array<uint64, kNumWords> words;
+
+    FORCE_INLINE bool operator[](uint32 x) const {
+        return (words[x >> 6u] >> (x & 63u)) & 1u;
+    }
+
+    FORCE_INLINE void Set(uint32 x, bool value) {
+        uint64 &word = words[x >> 6u];
+        word = (word & ~(1ull << (x & 63u))) | (static_cast<uint64>(value) << (x & 63u));
+    }
+
+    FORCE_INLINE void Fill(bool value) {
+        words.fill(value ? ~0ull : 0ull);
+    }
+
+    // Fills the pixels in the range [start, end) with the given value.
+    // The range is clamped to the maximum horizontal resolution.
+    FORCE_INLINE void FillRange(uint32 start, uint32 end, bool value) {
+        end = std::min(end, kMaxResH);
+        if (start >= end) {
+            return;
+        }
+
+        const uint32 firstWord = start >> 6u;
+        const uint32 lastWord = (end - 1) >> 6u;
+        const uint64 firstMask = ~0ull << (start & 63u);
+        const uint64 lastMask = ~0ull >> (63u - ((end - 1) & 63u));
+        const uint64 fill = value ? ~0ull : 0ull;
+
+        if (firstWord == lastWord) {
+            const uint64 mask = firstMask & lastMask;
+            words[firstWord] = (words[firstWord] & ~mask) | (fill & mask);
+            return;
+        }
+        words[firstWord] = (words[firstWord] & ~firstMask) | (fill & firstMask);
+        for (uint32 i = firstWord + 1; i < lastWord; i++) {
+            words[i] = fill;
+        }
+        words[lastWord] = (words[lastWord] & ~lastMask) | (fill & lastMask);
+    }
+
+    // Combines this mask with another mask using the OR operator, optionally inverting the other mask.
+    FORCE_INLINE void Or(const LineMask &mask, bool invert) {
+        const uint64 inv = invert ? ~0ull : 0ull;
+        for (uint32 i = 0; i < kNumWords; i++) {
+            words[i] |= mask.words[i] ^ inv;
+        }
+    }
+
+    // Combines this mask with another mask using the AND operator, optionally inverting the other mask.
+    FORCE_INLINE void And(const LineMask &mask, bool invert) {
+        const uint64 inv = invert ? ~0ull : 0ull;
+        for (uint32 i = 0; i < kNumWords; i++) {
+            words[i] &= mask.words[i] ^ inv;
+        }
+    }
+};
+
 // -----------------------------------------------------------------------------
 // Memory
 
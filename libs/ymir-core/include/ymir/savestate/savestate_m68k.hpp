@@ -14,6 +14,8 @@ struct M68KSaveState {
 
     std::array<uint16, 2> prefetchQueue;
     uint8 extIntrLevel;
+
+    bool operator==(const M68KSaveState &) const = default;
 };
 
 } // namespace ymir::savestate
@@ -25,6 +25,9 @@ struct SCSPSaveState {
     M68KSaveState m68k;
     uint64 m68kSpilloverCycles;
     bool m68kEnabled;
+    uint32 m68kBatchLength;
+    uint32 m68kBatchTicks;
+    uint32 m68kBatchProcessed;
 
     alignas(16) std::array<SCSPSlotSaveState, 32> slots;
 
@@ -5,6 +5,8 @@
 @brief Defines `ymir::sys::Bus`, a memory bus interconnecting various components in the system.
 */
 
+#include "memory_layout.hpp"
+
 #include <ymir/core/types.hpp>
 
 #include <ymir/hw/hw_defs.hpp>
@@ -15,7 +17,10 @@
 #include <ymir/util/inline.hpp>
 #include <ymir/util/type_traits_ex.hpp>
 #include <ymir/util/unreachable.hpp>
+#include <ymir/util/virtual_memory.hpp>
 
+#include <array>
+#include <cassert>
 #include <concepts>
 #include <type_traits>
 
@@ -32,13 +37,29 @@ using FnWrite32 = void (*)(uint32 address, uint32 value, void *ctx); ///< Functi
 /// @brief Function signature for bus wait checks.
 using FnBusWait = bool (*)(uint32 address, uint32 size, bool write, void *ctx);
 
+/// @brief Function signature for bursts of 32-bit reads from a single address.
+using FnReadBurst32 = void (*)(uint32 address, uint32 *out, uint32 count, void *ctx);
+
+/// @brief Function signature for DMA bursts of 16-bit reads from a single address.
+///
+/// Reads up to `count` values into `out` and returns how many were read. The handler ends the burst early right after
+/// the read that makes the region withdraw its DMA request, or returns zero if the address does not stream data.
+using FnReadBurst16 = uint32 (*)(uint32 address, uint16 *out, uint32 count, void *ctx);
+
+/// @brief Function signature for DMA bursts of 16-bit writes to a single address.
+///
+/// Writes up to `count` values from `in` and returns how many were written. The handler ends the burst early right
+/// after the write that makes the region withdraw its DMA request, or returns zero if the address does not stream data.
+using FnWriteBurst16 = uint32 (*)(uint32 address, const uint16 *in, uint32 count, void *ctx);
+
 /// @brief Specifies valid bus handler function types.
 /// @tparam T the type to check
 template <typename T>
 concept bus_handler_fn =
     fninfo::IsAssignable<FnRead8, T> || fninfo::IsAssignable<FnRead16, T> || fninfo::IsAssignable<FnRead32, T> ||
     fninfo::IsAssignable<FnWrite8, T> || fninfo::IsAssignable<FnWrite16, T> || fninfo::IsAssignable<FnWrite32, T> ||
-    fninfo::IsAssignable<FnBusWait, T>;
+    fninfo::IsAssignable<FnBusWait, T> || fninfo::IsAssignable<FnReadBurst32, T> ||
+    fninfo::IsAssignable<FnReadBurst16, T> || fninfo::IsAssignable<FnWriteBurst16, T>;
 
 /// @brief Represents a memory bus interconnecting various components in the system.
 ///
@@ -48,6 +69,18 @@ concept bus_handler_fn =
 /// `Map` methods assign read/write functions to a range of addresses. `MapNormal` refers to the regular `Read`/`Write`
 /// functions and `MapSideEffectFree` refers to the `Peek`/`Poke` variants. `Unmap` clears the assignments.
 ///
+/// Pages backed by `util::VirtualMemory` blocks (see `MapVirtualMemory`) can be mirrored into a host address window
+/// that spans the entire bus address space when fast memory is enabled with `EnableFastMemory`. `Read` and `Write`
+/// accesses to those pages become a plain load or store at the window's base address plus the bus address; every
+/// other page still goes through the page table. Fast memory is only compiled in with the `Ymir_FF_FAST_MEMORY` feature
+/// flag, which is unavailable on Windows; without it, `Read` and `Write` always use the page table.
+///
+/// Regions that behave like a data port (repeated reads from the same address return a stream of data) may also provide
+/// a burst read handler, which `ReadBurst` uses to transfer many values in one call. Data ports driven by DMA request
+/// lines may provide 16-bit burst read and write handlers for `ReadBurst16` and `WriteBurst16`, which stop as soon as
+/// the request is withdrawn. Mapping normal handlers to a region always clears its burst handlers unless new ones are
+/// included in the same call.
+///
 /// @tparam addressBits number of valid address bits
 template <uint32 addressBits, uint32 pageGranularityBits>
 class Bus {
@@ -126,6 +159,7 @@ public:
         const uint32 endIndex = end >> pageGranularityBits;
         for (uint32 i = startIndex; i <= endIndex; i++) {
             m_pages[i] = {};
+            UpdateFastMemoryPage(i);
         }
     }
 
@@ -142,9 +176,10 @@ public:
     /// @param[in] end the upper bound of the address range to map the handlers into
     /// @param array a reference to the array to be mapped
     /// @param writable indicates if the array is meant to be writable or read-only
+    /// @param hostOrder indicates if the array is stored in the host-endian layout (see `memory_layout.hpp`)
     template <size_t N>
         requires(bit::is_power_of_two(N) && N >= kPageSize)
-    void MapArray(uint32 start, uint32 end, std::array<uint8, N> &array, bool writable) {
+    void MapArray(uint32 start, uint32 end, std::array<uint8, N> &array, bool writable, bool hostOrder = false) {
         static constexpr uint32 kMask = N - 1;
 
         const uint32 startIndex = start >> pageGranularityBits;
@@ -154,10 +189,85 @@ public:
             m_pages[i] = {}; // clear all handlers
             m_pages[i].array = &array[offset & kMask];
             m_pages[i].arrayWritable = writable;
+            m_pages[i].arrayHostOrder = hostOrder && kHostEndianMemory;
+            UpdateFastMemoryPage(i);
             offset += kPageSize;
         }
     }
 
+    /// @brief Maps a block of virtual memory to the specified range.
+    ///
+    /// Behaves exactly like `MapArray`, but also allows the pages to be mirrored into the fast memory window.
+    ///
+    /// @param[in] start the lower bound of the address range to map the handlers into
+    /// @param[in] end the upper bound of the address range to map the handlers into
+    /// @param memory the block of virtual memory to be mapped. Its size must be a power of two and at least as large as
+    /// the bus's page size
+    /// @param writable indicates if the memory is meant to be writable or read-only
+    /// @param hostOrder indicates if the memory is stored in the host-endian layout (see `memory_layout.hpp`)
+    void MapVirtualMemory(uint32 start, uint32 end, const util::VirtualMemory &memory, bool writable,
+                          bool hostOrder = false) {
+        const size_t size = memory.GetAllocatedSize();
+        assert(bit::is_power_of_two(size) && size >= kPageSize);
+        const uint32 mask = size - 1;
+
+        uint8 *base = static_cast<uint8 *>(memory.GetMemory());
+        const uint32 startIndex = start >> pageGranularityBits;
+        const uint32 endIndex = end >> pageGranularityBits;
+        uint32 offset = 0;
+        for (uint32 i = startIndex; i <= endIndex; i++) {
+            m_pages[i] = {}; // clear all handlers
+            m_pages[i].array = &base[offset & mask];
+            m_pages[i].arrayWritable = writable;
+            m_pages[i].arrayHostOrder = hostOrder && kHostEndianMemory;
+            m_pages[i].memory = &memory;
+            m_pages[i].memoryOffset = offset & mask;
+            UpdateFastMemoryPage(i);
+            offset += kPageSize;
+        }
+    }
+
+    /// @brief Enables or disables the fast memory window.
+    ///
+    /// When enabled, a host address window covering the whole bus address space is reserved and every page mapped with
+    /// `MapVirtualMemory` is aliased into it. Pages that could not be aliased keep using the page table.
+    ///
+    /// @param[in] enable whether to enable or disable fast memory
+    /// @return `true` if fast memory is in the requested state, `false` if the host failed to reserve the window
+    bool EnableFastMemory(bool enable) {
+#if Ymir_FF_FAST_MEMORY
+        if (enable == m_fastMemory.IsReserved()) {
+            return true;
+        }
+
+        m_fastReadPages.fill(0);
+        m_fastWritePages.fill(0);
+        if (!enable) {
+            m_fastMemory.Release();
+            return true;
+        }
+        if (!m_fastMemory.Reserve(size_t(1) << addressBits)) {
+            return false;
+        }
+        for (uint32 i = 0; i < kPageCount; i++) {
+            UpdateFastMemoryPage(i);
+        }
+        return true;
+#else
+        return !enable;
+#endif
+    }
+
+    /// @brief Determines if the fast memory window is enabled.
+    /// @return `true` if fast memory is enabled
+    [[nodiscard]] bool IsFastMemoryEnabled() const {
+#if Ymir_FF_FAST_MEMORY
+        return m_fastMemory.IsReserved();
+#else
+        return false;
+#endif
+    }
+
     // -----------------------------------------------------------------------------------------------------------------
     // Accessors
 
@@ -169,10 +279,16 @@ public:
     FLATTEN FORCE_INLINE T Read(uint32 address) const {
         address &= kAddressMask & ~(sizeof(T) - 1);
 
+#if Ymir_FF_FAST_MEMORY
+        if (IsFastPage(m_fastReadPages, address)) {
+            return ReadMemory<T>(m_fastMemory.GetBase(), address);
+        }
+#endif
+
         const MemoryPage &entry = m_pages[address >> pageGranularityBits];
 
         if (entry.array) {
-            return util::ReadBE<T>(&entry.array[address & kPageMask]);
+            return ReadArray<T>(entry, address);
         }
         if constexpr (std::is_same_v<T, uint8>) {
             return entry.read8(address, entry.ctx);
@@ -194,11 +310,18 @@ public:
     FLATTEN FORCE_INLINE void Write(uint32 address, T value) {
         address &= kAddressMask & ~(sizeof(T) - 1);
 
+#if Ymir_FF_FAST_MEMORY
+        if (IsFastPage(m_fastWritePages, address)) {
+            WriteMemory<T>(m_fastMemory.GetBase(), address, value);
+            return;
+        }
+#endif
+
         const MemoryPage &entry = m_pages[address >> pageGranularityBits];
 
         if (entry.array) {
             if (entry.arrayWritable) {
-                util::WriteBE<T>(&entry.array[address & kPageMask], value);
+                WriteArray<T>(entry, address, value);
             }
             return;
         }
@@ -225,7 +348,7 @@ public:
         const MemoryPage &entry = m_pages[address >> pageGranularityBits];
 
         if (entry.array) {
-            return util::ReadBE<T>(&entry.array[address & kPageMask]);
+            return ReadArray<T>(entry, address);
         }
         if constexpr (std::is_same_v<T, uint8>) {
             return entry.peek8(address, entry.ctx);
@@ -251,7 +374,7 @@ public:
 
         if (entry.array) {
             if (entry.arrayWritable) {
-                util::WriteBE<T>(&entry.array[address & kPageMask], value);
+                WriteArray<T>(entry, address, value);
             }
             return;
         }
@@ -267,6 +390,115 @@ public:
         }
     }
 
+    /// @brief Performs a burst of 32-bit reads from the same address.
+    ///
+    /// The result is the same as calling `Read<uint32>(address)` `count` times. Regions with a burst read handler
+    /// service the whole burst in a single call.
+    ///
+    /// @param[in] address the address to read
+    /// @param[out] out the buffer that receives the values read. Must hold at least `count` values
+    /// @param[in] count the number of reads to perform
+    void ReadBurst(uint32 address, uint32 *out, uint32 count) const {
+        address &= kAddressMask & ~3u;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+
+        if (!entry.array && entry.readBurst32 != nullptr) {
+            entry.readBurst32(address, out, count, entry.ctx);
+            return;
+        }
+        for (uint32 i = 0; i < count; ++i) {
+            out[i] = Read<uint32>(address);
+        }
+    }
+
+    /// @brief Determines if the region at the specified address services burst reads with a dedicated handler.
+    /// @param[in] address the address to check
+    /// @return `true` if `ReadBurst` is faster than individual reads from the address
+    [[nodiscard]] FORCE_INLINE bool HasBurstRead(uint32 address) const {
+        address &= kAddressMask;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+        return !entry.array && entry.readBurst32 != nullptr;
+    }
+
+    /// @brief Performs a DMA burst of 16-bit reads from the same address.
+    ///
+    /// Regions with a 16-bit burst read handler may end the burst early (see `FnReadBurst16`); the others perform
+    /// `count` individual reads.
+    ///
+    /// @param[in] address the address to read
+    /// @param[out] out the buffer that receives the values read. Must hold at least `count` values
+    /// @param[in] count the maximum number of reads to perform
+    /// @return the number of values read
+    uint32 ReadBurst16(uint32 address, uint16 *out, uint32 count) const {
+        address &= kAddressMask & ~1u;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+
+        if (!entry.array && entry.readBurst16 != nullptr) {
+            return entry.readBurst16(address, out, count, entry.ctx);
+        }
+        for (uint32 i = 0; i < count; ++i) {
+            out[i] = Read<uint16>(address);
+        }
+        return count;
+    }
+
+    /// @brief Performs a DMA burst of 16-bit writes to the same address.
+    ///
+    /// Regions with a 16-bit burst write handler may end the burst early (see `FnWriteBurst16`); the others perform
+    /// `count` individual writes.
+    ///
+    /// @param[in] address the address to write
+    /// @param[in] in the values to write. Must hold at least `count` values
+    /// @param[in] count the maximum number of writes to perform
+    /// @return the number of values written
+    uint32 WriteBurst16(uint32 address, const uint16 *in, uint32 count) {
+        address &= kAddressMask & ~1u;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+
+        if (!entry.array && entry.writeBurst16 != nullptr) {
+            return entry.writeBurst16(address, in, count, entry.ctx);
+        }
+        for (uint32 i = 0; i < count; ++i) {
+            Write<uint16>(address, in[i]);
+        }
+        return count;
+    }
+
+    /// @brief Determines if the region at the specified address services DMA bursts of 16-bit reads with a dedicated
+    /// handler.
+    /// @param[in] address the address to check
+    /// @return `true` if the region has a 16-bit burst read handler
+    [[nodiscard]] FORCE_INLINE bool HasBurstRead16(uint32 address) const {
+        address &= kAddressMask;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+        return !entry.array && entry.readBurst16 != nullptr;
+    }
+
+    /// @brief Determines if the region at the specified address services DMA bursts of 16-bit writes with a dedicated
+    /// handler.
+    /// @param[in] address the address to check
+    /// @return `true` if the region has a 16-bit burst write handler
+    [[nodiscard]] FORCE_INLINE bool HasBurstWrite16(uint32 address) const {
+        address &= kAddressMask;
+
+        const MemoryPage &entry = m_pages[address >> pageGranularityBits];
+        return !entry.array && entry.writeBurst16 != nullptr;
+    }
+
+    /// @brief Determines if the specified address is backed by plain memory, where accesses have no side-effects.
+    /// @param[in] address the address to check
+    /// @return `true` if the address is mapped to an array or virtual memory block
+    [[nodiscard]] FORCE_INLINE bool IsMemory(uint32 address) const {
+        address &= kAddressMask;
+
+        return m_pages[address >> pageGranularityBits].array != nullptr;
+    }
+
     /// @brief Determines if the given access is blocked.
     /// @param[in] address the address to check
     /// @param[in] size the number of bytes to be accessed
@@ -334,6 +566,12 @@ private:
 
         uint8 *array = nullptr;
         bool arrayWritable = false;
+        bool arrayHostOrder = false; // array is stored in the host-endian layout
+
+        // Virtual memory block backing the array, if any; allows the page to be aliased into the fast memory window
+
+        const util::VirtualMemory *memory = nullptr;
+        uint32 memoryOffset = 0;
 
         // Slow path for MMIO and other regions
 
@@ -357,6 +595,10 @@ private:
 
         FnBusWait busWait = [](uint32, uint32, bool, void *) -> bool { return false; };
 
+        FnReadBurst32 readBurst32 = nullptr; // optional; Bus::ReadBurst falls back to individual reads if missing
+        FnReadBurst16 readBurst16 = nullptr;   // optional; Bus::ReadBurst16 falls back to individual reads if missing
+        FnWriteBurst16 writeBurst16 = nullptr; // optional; Bus::WriteBurst16 falls back to individual writes if missing
+
         uint64 readCycles8 = 1;
         uint64 readCycles16 = 1;
         uint64 readCycles32 = 1;
@@ -368,6 +610,72 @@ private:
 
     std::array<MemoryPage, kPageCount> m_pages;
 
+    template <mem_primitive T>
+    FORCE_INLINE static T ReadArray(const MemoryPage &entry, uint32 address) {
+        if constexpr (kHostEndianMemory) {
+            if (entry.arrayHostOrder) {
+                return ReadMemory<T>(entry.array, address & kPageMask);
+            }
+        }
+        return util::ReadBE<T>(&entry.array[address & kPageMask]);
+    }
+
+    template <mem_primitive T>
+    FORCE_INLINE static void WriteArray(const MemoryPage &entry, uint32 address, T value) {
+        if constexpr (kHostEndianMemory) {
+            if (entry.arrayHostOrder) {
+                WriteMemory<T>(entry.array, address & kPageMask, value);
+                return;
+            }
+        }
+        util::WriteBE<T>(&entry.array[address & kPageMask], value);
+    }
+
+    // -------------------------------------------------------------------------
+    // Fast memory
+
+#if Ymir_FF_FAST_MEMORY
+    static constexpr uint32 kFastPageWords = (kPageCount + 63) / 64;
+
+    util::VirtualAddressWindow m_fastMemory; // mirrors the bus address space when fast memory is enabled
+
+    // One bit per page indicating if reads/writes can be served directly from the fast memory window.
+    // Small enough to stay in the cache, unlike the page table.
+    std::array<uint64, kFastPageWords> m_fastReadPages{};
+    std::array<uint64, kFastPageWords> m_fastWritePages{};
+
+    [[nodiscard]] FORCE_INLINE static bool IsFastPage(const std::array<uint64, kFastPageWords> &pages, uint32 address) {
+        const uint32 index = address >> pageGranularityBits;
+        return (pages[index >> 6u] >> (index & 63u)) & 1u;
+    }
+#endif
+
+    // Updates the fast memory window and bitmaps to reflect the current mapping of the given page.
+    void UpdateFastMemoryPage([[maybe_unused]] uint32 index) {
+#if Ymir_FF_FAST_MEMORY
+        const uint64 bit = 1ull << (index & 63u);
+        const bool wasMapped = (m_fastReadPages[index >> 6u] & bit) != 0;
+        m_fastReadPages[index >> 6u] &= ~bit;
+        m_fastWritePages[index >> 6u] &= ~bit;
+        if (!m_fastMemory.IsReserved()) {
+            return;
+        }
+
+        const MemoryPage &page = m_pages[index];
+        const size_t windowOffset = static_cast<size_t>(index) << pageGranularityBits;
+        // The fast path assumes every page in the window uses the layout selected by kHostEndianMemory
+        if (page.memory != nullptr && page.arrayHostOrder == kHostEndianMemory &&
+            m_fastMemory.MapView(windowOffset, *page.memory, page.memoryOffset, kPageSize, page.arrayWritable)) {
+            m_fastReadPages[index >> 6u] |= bit;
+            if (page.arrayWritable) {
+                m_fastWritePages[index >> 6u] |= bit;
+            }
+        } else if (wasMapped) {
+            m_fastMemory.UnmapView(windowOffset, kPageSize);
+        }
+#endif
+    }
+
     template <bool normal, bool sideEffectFree, bus_handler_fn... THandlers>
         requires util::unique_types<THandlers...>
     void Map(uint32 start, uint32 end, void *context, THandlers &&...handlers) {
@@ -376,9 +684,17 @@ private:
         for (uint32 i = startIndex; i <= endIndex; i++) {
             m_pages[i].array = nullptr;
             m_pages[i].arrayWritable = false;
+            m_pages[i].arrayHostOrder = false;
+            m_pages[i].memory = nullptr;
+            m_pages[i].memoryOffset = 0;
+            UpdateFastMemoryPage(i);
 
             m_pages[i].ctx = context;
             if constexpr (normal) {
+                // Burst handlers are specific to the component mapped to the page and must be provided on every mapping
+                m_pages[i].readBurst32 = nullptr;
+                m_pages[i].readBurst16 = nullptr;
+                m_pages[i].writeBurst16 = nullptr;
                 (AssignHandler<false>(m_pages[i], std::forward<THandlers>(handlers)), ...);
             }
             if constexpr (sideEffectFree) {
@@ -391,6 +707,18 @@ private:
     static void AssignHandler(MemoryPage &page, THandler &&handler) {
         if constexpr (fninfo::IsAssignable<FnBusWait, THandler>) {
             page.busWait = handler;
+        } else if constexpr (fninfo::IsAssignable<FnReadBurst32, THandler>) {
+            if constexpr (!peekpoke) {
+                page.readBurst32 = handler;
+            }
+        } else if constexpr (fninfo::IsAssignable<FnReadBurst16, THandler>) {
+            if constexpr (!peekpoke) {
+                page.readBurst16 = handler;
+            }
+        } else if constexpr (fninfo::IsAssignable<FnWriteBurst16, THandler>) {
+            if constexpr (!peekpoke) {
+                page.writeBurst16 = handler;
+            }
         } else if constexpr (peekpoke) {
             if constexpr (fninfo::IsAssignable<FnRead8, THandler>) {
                 page.peek8 = handler;
@@ -9,6 +9,7 @@ comprising the main system memory and 32 KiB of internal backup memory for stori
 */
 
 #include "memory_defs.hpp"
+#include "memory_layout.hpp"
 
 #include <ymir/sys/backup_ram.hpp>
 #include <ymir/sys/bus.hpp>
@@ -18,8 +19,11 @@ comprising the main system memory and 32 KiB of internal backup memory for stori
 #include <ymir/core/hash.hpp>
 #include <ymir/core/types.hpp>
 
+#include <ymir/util/virtual_memory.hpp>
+
 #include <array>
 #include <iosfwd>
+#include <memory>
 #include <span>
 
 namespace ymir::sys {
@@ -116,10 +120,41 @@ struct SystemMemory {
 
     alignas(16) std::array<uint8, kIPLSize> IPL; ///< 512 KiB IPL ROM (aka BIOS ROM)
 
-    alignas(16) std::array<uint8, kWRAMLowSize> WRAMLow;   ///< 1 MiB Low Work RAM (slow)
-    alignas(16) std::array<uint8, kWRAMHighSize> WRAMHigh; ///< 1 MiB High Work RAM (fast)
+    /// @brief Retrieves the 1 MiB Low Work RAM (slow).
+    /// @return the contents of Low Work RAM, stored in the layout selected by `kHostEndianMemory`
+    std::array<uint8, kWRAMLowSize> &WRAMLow() {
+        return *m_WRAMLow;
+    }
+
+    /// @brief Retrieves the 1 MiB Low Work RAM (slow).
+    /// @return the contents of Low Work RAM, stored in the layout selected by `kHostEndianMemory`
+    const std::array<uint8, kWRAMLowSize> &WRAMLow() const {
+        return *m_WRAMLow;
+    }
+
+    /// @brief Retrieves the 1 MiB High Work RAM (fast).
+    /// @return the contents of High Work RAM, stored in the layout selected by `kHostEndianMemory`
+    std::array<uint8, kWRAMHighSize> &WRAMHigh() {
+        return *m_WRAMHigh;
+    }
+
+    /// @brief Retrieves the 1 MiB High Work RAM (fast).
+    /// @return the contents of High Work RAM, stored in the layout selected by `kHostEndianMemory`
+    const std::array<uint8, kWRAMHighSize> &WRAMHigh() const {
+        return *m_WRAMHigh;
+    }
 
 private:
+    // Work RAM is allocated from virtual memory blocks so that the bus can alias it into its fast memory window.
+    // If the host fails to allocate a block, that Work RAM falls back to a regular heap array.
+    util::VirtualMemory m_WRAMLowMemory{kWRAMLowSize};
+    util::VirtualMemory m_WRAMHighMemory{kWRAMHighSize};
+    std::unique_ptr<std::array<uint8, kWRAMLowSize>> m_WRAMLowFallback;
+    std::unique_ptr<std::array<uint8, kWRAMHighSize>> m_WRAMHighFallback;
+
+    std::array<uint8, kWRAMLowSize> *m_WRAMLow;   // points to either the virtual memory block or the fallback array
+    std::array<uint8, kWRAMHighSize> *m_WRAMHigh; // points to either the virtual memory block or the fallback array
+
     bup::BackupMemory m_internalBackupRAM; ///< Internal backup memory
 
     XXH128Hash m_iplHash{}; ///< Cached IPL ROM hash
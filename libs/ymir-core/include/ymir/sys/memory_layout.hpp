@@ -0,0 +1,98 @@
+#pragma once
+
+/**
+@file
+@brief Storage layout of large guest memories.
+
+By default, guest memories are stored in guest (big-endian) byte order and every 16-bit and 32-bit access performs a
+byte swap on little-endian hosts.
+
+When built with the `Ymir_FF_HOST_ENDIAN_MEMORY` feature flag, memories that opt into it are stored as 32-bit words in
+host byte order instead. 32-bit accesses become plain loads and stores, while 8-bit and 16-bit accesses XOR the address
+to locate the bytes within the word. All accesses must be naturally aligned.
+
+Data exchanged with the outside world (save states, memory dumps, ROM images) is always in guest byte order; use
+`CopyToGuestOrder` and `CopyFromGuestOrder` to convert between the two layouts.
+*/
+
+#include <ymir/hw/hw_defs.hpp>
+
+#include <ymir/core/types.hpp>
+
+#include <ymir/util/bit_ops.hpp>
+#include <ymir/util/data_ops.hpp>
+#include <ymir/util/inline.hpp>
+
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <span>
+
+namespace ymir::sys {
+
+/// @brief Whether memories that opt into the host-endian layout are stored in host byte order.
+inline constexpr bool kHostEndianMemory = Ymir_FF_HOST_ENDIAN_MEMORY;
+
+namespace detail {
+
+    /// @brief Address adjustment for accesses of type `T` into host-endian memory.
+    template <mem_primitive T>
+    inline constexpr uint32 kHostEndianAddressXor =
+        std::endian::native == std::endian::little ? sizeof(uint32) - sizeof(T) : 0u;
+
+} // namespace detail
+
+/// @brief Reads a value from a memory block stored in the layout selected by `kHostEndianMemory`.
+/// @tparam T the data type of the access
+/// @param[in] base a pointer to the start of the memory block. Must be aligned to 32 bits
+/// @param[in] address the offset into the memory block. Must be aligned to the size of `T`
+/// @return the value at the specified address
+template <mem_primitive T>
+[[nodiscard]] FORCE_INLINE T ReadMemory(const uint8 *base, uint32 address) {
+    if constexpr (kHostEndianMemory) {
+        assert((address & (sizeof(T) - 1)) == 0);
+        return util::ReadNE<T>(&base[address ^ detail::kHostEndianAddressXor<T>]);
+    } else {
+        return util::ReadBE<T>(&base[address]);
+    }
+}
+
+/// @brief Writes a value to a memory block stored in the layout selected by `kHostEndianMemory`.
+/// @tparam T the data type of the access
+/// @param[in] base a pointer to the start of the memory block. Must be aligned to 32 bits
+/// @param[in] address the offset into the memory block. Must be aligned to the size of `T`
+/// @param[in] value the value to write
+template <mem_primitive T>
+FORCE_INLINE void WriteMemory(uint8 *base, uint32 address, T value) {
+    if constexpr (kHostEndianMemory) {
+        assert((address & (sizeof(T) - 1)) == 0);
+        util::WriteNE<T>(&base[address ^ detail::kHostEndianAddressXor<T>], value);
+    } else {
+        util::WriteBE<T>(&base[address], value);
+    }
+}
+
+/// @brief Copies a memory block stored in the layout selected by `kHostEndianMemory` into a buffer in guest byte order.
+/// @param[out] dst the destination buffer
+/// @param[in] src the source memory block. Must be as large as `dst` and a multiple of 32 bits in size
+inline void CopyToGuestOrder(std::span<uint8> dst, std::span<const uint8> src) {
+    assert(dst.size() == src.size());
+    if constexpr (kHostEndianMemory && std::endian::native == std::endian::little) {
+        assert(src.size() % sizeof(uint32) == 0);
+        for (size_t i = 0; i < src.size(); i += sizeof(uint32)) {
+            util::WriteBE<uint32>(&dst[i], util::ReadNE<uint32>(&src[i]));
+        }
+    } else {
+        std::memcpy(dst.data(), src.data(), src.size());
+    }
+}
+
+/// @brief Copies a buffer in guest byte order into a memory block stored in the layout selected by `kHostEndianMemory`.
+/// @param[out] dst the destination memory block. Must be a multiple of 32 bits in size
+/// @param[in] src the source buffer. Must be as large as `dst`
+inline void CopyFromGuestOrder(std::span<uint8> dst, std::span<const uint8> src) {
+    // The conversion is symmetric
+    CopyToGuestOrder(dst, src);
+}
+
+} // namespace ymir::sys
@@ -197,6 +197,20 @@ struct Saturn {
         return m_emulateSH2Caches;
     }
 
+    /// @brief Enables or disables the slave SH-2.
+    ///
+    /// The execution functions are specialized for the slave SH-2 state and are switched over immediately, even in the
+    /// middle of a frame.
+    ///
+    /// @param[in] enable whether to enable or disable the slave SH-2
+    void SetSlaveSH2Enabled(bool enable);
+
+    /// @brief Determines if the slave SH-2 is enabled.
+    /// @return the slave SH-2 enable state
+    [[nodiscard]] bool IsSlaveSH2Enabled() const noexcept {
+        return m_slaveSH2Enabled;
+    }
+
     /// @brief Sets the SH-2 clock factor.
     /// @param[in] factor the clock factor ratio
     void SetSH2ClockFactor(RatioU32 factor) {
@@ -208,8 +222,13 @@ struct Saturn {
     /// The implementation of the function depends on the following parameters:
     /// - **Debug tracing**: configured with `EnableDebugTracing(bool)`
     /// - **SH-2 cache emulation**: configured with `EnableSH2CacheEmulation(bool)`
+    /// - **Slave SH-2 state**: configured with `SetSlaveSH2Enabled(bool)` or by the SMPC
+    ///
+    /// If any of these change while the frame is running, the rest of the frame is run with the new implementation.
     void RunFrame() {
-        (this->*m_runFrameFn)();
+        do {
+            m_functionPointersChanged = false;
+        } while (!(this->*m_runFrameFn)());
     }
 
     /// @brief Runs a single master SH-2 instruction using the current settings.
@@ -217,6 +236,7 @@ struct Saturn {
     /// The implementation of the function depends on the following parameters:
     /// - **Debug tracing**: configured with `EnableDebugTracing(bool)`
     /// - **SH-2 cache emulation**: configured with `EnableSH2CacheEmulation(bool)`
+    /// - **Slave SH-2 state**: configured with `SetSlaveSH2Enabled(bool)` or by the SMPC
     /// @return the number of cycles executed
     uint64 StepMasterSH2() {
         return (this->*m_stepMSH2Fn)();
@@ -227,6 +247,7 @@ struct Saturn {
     /// The implementation of the function depends on the following parameters:
     /// - **Debug tracing**: configured with `EnableDebugTracing(bool)`
     /// - **SH-2 cache emulation**: configured with `EnableSH2CacheEmulation(bool)`
+    /// - **Slave SH-2 state**: configured with `SetSlaveSH2Enabled(bool)` or by the SMPC
     /// @return the number of cycles executed, zero if the slave SH-2 is disabled
     uint64 StepSlaveSH2() {
         return (this->*m_stepSSH2Fn)();
@@ -287,39 +308,45 @@ private:
     /// @tparam debug whether to use debug tracing
     /// @tparam enableSH2Cache whether to emulate SH-2 caches
     /// @tparam cdblockLLE whether to use low-level CD block emulation
-    template <bool debug, bool enableSH2Cache, bool cdblockLLE>
-    void RunFrameImpl();
+    /// @tparam slaveSH2Enabled whether the slave SH-2 is enabled
+    /// @return `true` if the frame was completed or execution was suspended, `false` if the execution functions were
+    /// changed and the frame must be resumed with the new implementation
+    template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
+    bool RunFrameImpl();
 
     /// @brief Runs the emulator until the next scheduled event.
     /// @tparam debug whether to use debug tracing
     /// @tparam enableSH2Cache whether to emulate SH-2 caches
     /// @tparam cdblockLLE whether to use low-level CD block emulation
+    /// @tparam slaveSH2Enabled whether the slave SH-2 is enabled
     /// @return true if execution should continue, false to suspend
-    template <bool debug, bool enableSH2Cache, bool cdblockLLE>
+    template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
     bool Run();
 
     /// @brief Runs a single master SH-2 instruction.
     /// @tparam debug whether to use debug tracing
     /// @tparam enableSH2Cache whether to emulate SH-2 caches
     /// @tparam cdblockLLE whether to use low-level CD block emulation
+    /// @tparam slaveSH2Enabled whether the slave SH-2 is enabled
     /// @return the number of cycles executed
-    template <bool debug, bool enableSH2Cache, bool cdblockLLE>
+    template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
     uint64 StepMasterSH2Impl();
 
     /// @brief Runs a single slave SH-2 instruction if the CPU is enabled.
     /// @tparam debug whether to use debug tracing
     /// @tparam enableSH2Cache whether to emulate SH-2 caches
     /// @tparam cdblockLLE whether to use low-level CD block emulation
+    /// @tparam slaveSH2Enabled whether the slave SH-2 is enabled
     /// @return the number of cycles executed, zero if the slave SH-2 is disabled
-    template <bool debug, bool enableSH2Cache, bool cdblockLLE>
+    template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
     uint64 StepSlaveSH2Impl();
 
     /// @brief The type of the `RunFrameImpl()` implementation to use from `RunFrame()`.
-    using RunFrameFn = void (Saturn::*)();
+    using RunFrameFn = bool (Saturn::*)();
 
     /// @brief The current `RunFrameImpl()` implementation in use.
     ///
-    /// Depends on debug tracing and SH-2 cache emulation settings.
+    /// Depends on debug tracing, SH-2 cache emulation, low-level CD block emulation and slave SH-2 state.
     RunFrameFn m_runFrameFn;
 
     /// @brief The type of the `StepMasterSH2Impl()` implementation to use from `StepMasterSH2()`.
@@ -327,18 +354,22 @@ private:
 
     /// @brief The current `StepMasterSH2Impl()` implementation in use.
     ///
-    /// Depends on debug tracing and SH-2 cache emulation settings.
+    /// Depends on debug tracing, SH-2 cache emulation, low-level CD block emulation and slave SH-2 state.
     StepSH2Fn m_stepMSH2Fn;
 
     /// @brief The current `StepSlaveSH2Impl()` implementation in use.
     ///
-    /// Depends on debug tracing and SH-2 cache emulation settings.
+    /// Depends on debug tracing, SH-2 cache emulation, low-level CD block emulation and slave SH-2 state.
     StepSH2Fn m_stepSSH2Fn;
 
-    /// @brief Updates pointers to the execution functions based on the current debug tracing, SH-2 cache emulation and
-    /// low-level CD Block emulation settings.
+    /// @brief Updates pointers to the execution functions based on the current debug tracing, SH-2 cache emulation,
+    /// low-level CD Block emulation settings and slave SH-2 state.
     void UpdateFunctionPointers();
 
+    /// @brief Set when the execution functions are changed, signaling `RunFrameImpl()` to return so that `RunFrame()`
+    /// can resume the frame with the new implementation.
+    bool m_functionPointersChanged = false;
+
     /// @brief Helper template to convert runtime parameters into compile-time constants for building function pointers.
     template <bool... t_features>
     void UpdateFunctionPointersTemplate(bool feature, auto... features);
@@ -423,6 +454,9 @@ private:
     /// @brief Whether to emulate SH2 caches.
     bool m_emulateSH2Caches = false;
 
+    /// @brief Whether the slave SH-2 is enabled.
+    bool m_slaveSH2Enabled = false;
+
 public:
     // -------------------------------------------------------------------------
     // Components
@@ -431,7 +465,6 @@ public:
     sys::SH2Bus mainBus;      ///< Primary system bus connecting SH-2s, SCU, IPL ROM and WRAMs
     sh2::SH2 masterSH2;       ///< Master SH-2
     sh2::SH2 slaveSH2;        ///< Slave SH-2
-    bool slaveSH2Enabled;     ///< Slave SH-2 enable flag
     scu::SCU SCU;             ///< SCU and its DSP, and the cartridge slot
     vdp::VDP VDP;             ///< VDP1 and VDP2
     smpc::SMPC SMPC;          ///< SMPC and input devices
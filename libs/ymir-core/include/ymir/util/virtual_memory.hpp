@@ -5,6 +5,8 @@
 @brief Virtual memory management.
 */
 
+#include <ymir/core/types.hpp>
+
 #include <ymir/util/inline.hpp>
 
 #include <memory>
@@ -13,6 +15,9 @@
 namespace util {
 
 /// @brief Holds a block of virtual memory.
+///
+/// The block is backed by a shared memory object whenever the host supports it, which allows `VirtualAddressWindow` to
+/// map additional views of it.
 class VirtualMemory {
 public:
     /// @brief Constructs an unallocated block of virtual memory.
@@ -29,6 +34,7 @@ public:
     VirtualMemory &operator=(const VirtualMemory &) = delete;
     VirtualMemory &operator=(VirtualMemory &&rhs) {
         std::swap(m_mem, rhs.m_mem);
+        std::swap(m_size, rhs.m_size);
         std::swap(m_internal, rhs.m_internal);
         return *this;
     }
@@ -68,6 +74,71 @@ private:
 
     struct Internal;
     std::unique_ptr<Internal> m_internal;
+
+#if !defined(_WIN32)
+    friend class VirtualAddressWindow;
+#endif
+};
+
+#if !defined(_WIN32)
+
+/// @brief Reserves a range of virtual addresses into which views of `VirtualMemory` blocks can be mapped.
+///
+/// Multiple views of the same block may be mapped at different offsets, in which case all of them alias the same
+/// memory. Addresses not covered by any view are inaccessible.
+///
+/// Only available on POSIX hosts.
+class VirtualAddressWindow {
+public:
+    /// @brief Constructs an unreserved window.
+    VirtualAddressWindow() = default;
+
+    VirtualAddressWindow(const VirtualAddressWindow &) = delete;
+    VirtualAddressWindow(VirtualAddressWindow &&rhs) = delete;
+    ~VirtualAddressWindow();
+
+    VirtualAddressWindow &operator=(const VirtualAddressWindow &) = delete;
+    VirtualAddressWindow &operator=(VirtualAddressWindow &&rhs) = delete;
+
+    /// @brief Reserves a window of the specified size, releasing the previous window if there was one.
+    /// @param[in] size the size of the window in bytes. Must be a multiple of the host page size.
+    /// @return `true` if the window was reserved, `false` if the reservation failed
+    bool Reserve(size_t size);
+
+    /// @brief Releases the window along with all views mapped into it.
+    void Release();
+
+    /// @brief Determines if the window is reserved.
+    /// @return `true` if the window is reserved
+    bool IsReserved() const {
+        return m_base != nullptr;
+    }
+
+    /// @brief Maps a view of a block of virtual memory into the window, replacing anything previously mapped there.
+    /// @param[in] offset the offset into the window where the view begins
+    /// @param[in] memory the block of virtual memory to map
+    /// @param[in] memOffset the offset into the block of virtual memory where the view begins
+    /// @param[in] size the size of the view in bytes
+    /// @param[in] writable whether the view is writable or read-only
+    /// @return `true` if the view was mapped, `false` if the block cannot be aliased or the mapping failed
+    bool MapView(size_t offset, const VirtualMemory &memory, size_t memOffset, size_t size, bool writable);
+
+    /// @brief Unmaps views from the specified range of the window, making it inaccessible.
+    /// @param[in] offset the offset into the window where the range begins
+    /// @param[in] size the size of the range in bytes
+    void UnmapView(size_t offset, size_t size);
+
+    /// @brief Retrieves a pointer to the start of the window.
+    /// @return a pointer to the first byte of the window. `nullptr` if not reserved.
+    FORCE_INLINE uint8 *GetBase() const {
+        return m_base;
+    }
+
+private:
+    uint8 *m_base = nullptr;
+    size_t m_size = 0;
 };
 
+#endif
+
 } // namespace util
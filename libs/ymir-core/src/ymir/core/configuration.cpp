@@ -16,6 +16,7 @@ void Configuration::NotifyObservers() {
 
     audio.interpolation.Notify();
     audio.threadedSCSP.Notify();
+    audio.m68kBatching.Notify();
 
     cdblock.readSpeedFactor.Notify();
     cdblock.useLLE.Notify();
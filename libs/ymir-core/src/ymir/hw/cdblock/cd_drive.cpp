@@ -236,44 +236,41 @@ FORCE_INLINE void CDDrive::OpenTray(bool autoClose) {
     m_autoCloseTray = autoClose;
 }
 
-bool CDDrive::SerialRead() {
-    const uint8 byteIndex = m_commandPos >> 3u;
-    const uint8 bitIndex = m_commandPos & 7u;
-    const bool bit = (m_statusData.data[byteIndex] >> bitIndex) & 1;
-    if (++m_statusPos == (m_statusData.data.size() << 3u)) {
+uint8 CDDrive::SerialRead() {
+    // Status bytes are shifted out in lockstep with the command bytes shifted in
+    // Like the command position, a save state may resume in the middle of a byte
+    const uint8 value = m_statusData.data[m_commandPos >> 3u];
+    m_statusPos = (m_statusPos & ~7u) + 8u;
+    if (m_statusPos == (m_statusData.data.size() << 3u)) {
         m_statusPos = 0;
     }
-    return bit;
-}
-
-void CDDrive::SerialWrite(bool bit) {
-    const uint8 byteIndex = m_commandPos >> 3u;
-    const uint8 bitIndex = m_commandPos & 7u;
-    m_command.data[byteIndex] &= ~(1u << bitIndex);
-    m_command.data[byteIndex] |= bit << bitIndex;
-    if ((++m_commandPos & 7u) == 0u) {
-        if (m_commandPos == (m_command.data.size() << 3u)) {
-            m_commandPos = 0;
-            m_state = TxState::TxEnd;
-
-            if constexpr (devlog::trace_enabled<grp::lle_cd_status>) {
-                fmt::memory_buffer buf{};
-                auto out = std::back_inserter(buf);
-                fmt::format_to(out, "CD stat ");
-                for (uint8 b : m_statusData.data) {
-                    fmt::format_to(out, " {:02X}", b);
-                }
-                devlog::trace<grp::lle_cd_status>("{}", fmt::to_string(buf));
+    return value;
+}
+
+void CDDrive::SerialWrite(uint8 value) {
+    m_command.data[m_commandPos >> 3u] = value;
+    m_commandPos = (m_commandPos & ~7u) + 8u;
+    if (m_commandPos == (m_command.data.size() << 3u)) {
+        m_commandPos = 0;
+        m_state = TxState::TxEnd;
+
+        if constexpr (devlog::trace_enabled<grp::lle_cd_status>) {
+            fmt::memory_buffer buf{};
+            auto out = std::back_inserter(buf);
+            fmt::format_to(out, "CD stat ");
+            for (uint8 b : m_statusData.data) {
+                fmt::format_to(out, " {:02X}", b);
             }
-            TraceRxCommandTxStatus(m_tracer, m_command.data, m_statusData.data);
-        } else if (m_commandPos == (1 << 3u)) {
-            m_state = TxState::TxInter1;
-        } else {
-            m_state = TxState::TxInterN;
+            devlog::trace<grp::lle_cd_status>("{}", fmt::to_string(buf));
         }
-        m_cbSetCOMREQn(true);
-        m_cbSetCOMSYNCn(true);
+        TraceRxCommandTxStatus(m_tracer, m_command.data, m_statusData.data);
+    } else if (m_commandPos == (1 << 3u)) {
+        m_state = TxState::TxInter1;
+    } else {
+        m_state = TxState::TxInterN;
     }
+    m_cbSetCOMREQn(true);
+    m_cbSetCOMSYNCn(true);
 }
 
 uint64 CDDrive::ProcessTxState() {
@@ -187,6 +187,7 @@ void CDBlock::MapMemory(sys::SH2Bus &bus) {
                 cast(ctx).WriteReg<uint16>(address + 0, value >> 16u);
                 cast(ctx).WriteReg<uint16>(address + 2, value >> 0u);
             },
+            [](uint32 address, uint32 *out, uint32 count, void *ctx) { cast(ctx).ReadRegBurst(address, out, count); },
             // Bus wait handler
             [](uint32, uint32, bool, void *) -> bool { return false; });
 
@@ -577,6 +578,28 @@ T CDBlock::ReadReg(uint32 address) {
     }
 }
 
+void CDBlock::ReadRegBurst(uint32 address, uint32 *out, uint32 count) {
+    if ((address & 0x3F) != 0x00) {
+        for (uint32 i = 0; i < count; ++i) {
+            out[i] = ReadReg<uint16>(address + 0) << 16u;
+            out[i] |= ReadReg<uint16>(address + 2) << 0u;
+        }
+        return;
+    }
+
+    // 32-bit reads from the data transfer register read two words from the transfer
+    std::array<uint16, 128> words;
+    while (count > 0) {
+        const uint32 chunk = std::min<uint32>(count, words.size() / 2);
+        DoReadTransfer(std::span{words}.first(chunk * 2));
+        for (uint32 i = 0; i < chunk; ++i) {
+            out[i] = (words[i * 2 + 0] << 16u) | words[i * 2 + 1];
+        }
+        out += chunk;
+        count -= chunk;
+    }
+}
+
 template <mem_primitive T>
 void CDBlock::WriteReg(uint32 address, T value) {
     if constexpr (std::is_same_v<T, uint8>) {
@@ -1545,6 +1568,40 @@ uint16 CDBlock::DoReadTransfer() {
     return value;
 }
 
+void CDBlock::DoReadTransfer(std::span<uint16> out) {
+    size_t pos = 0;
+    while (pos < out.size()) {
+        // Copy runs of words straight out of the transfer buffer.
+        // The last word of each sector and of the whole transfer go through the regular path, which handles sector
+        // changes and the end of the transfer.
+        uint32 runEnd = 0;
+        switch (m_xferType) {
+        case TransferType::GetSector: [[fallthrough]];
+        case TransferType::GetThenDeleteSector:
+            runEnd = std::min<uint32>(m_xferBuffer.size(), m_xferGetLength / sizeof(uint16));
+            break;
+        case TransferType::TOC: [[fallthrough]];
+        case TransferType::FileInfo: [[fallthrough]];
+        case TransferType::Subcode: runEnd = m_xferBuffer.size(); break;
+        default: break;
+        }
+
+        if (m_xferBufferPos + 1 < runEnd && m_xferPos + 1 < m_xferLength) {
+            const uint32 count = std::min<uint32>({runEnd - m_xferBufferPos - 1, m_xferLength - m_xferPos - 1,
+                                                   static_cast<uint32>(out.size() - pos)});
+            std::copy_n(&m_xferBuffer[m_xferBufferPos], count, &out[pos]);
+            m_xferBufferPos += count;
+            m_xferPos += count;
+            m_xferCount += count;
+            pos += count;
+        }
+
+        if (pos < out.size()) {
+            out[pos++] = DoReadTransfer();
+        }
+    }
+}
+
 void CDBlock::DoWriteTransfer(uint16 value) {
     if (m_xferPos >= m_xferLength) {
         return;
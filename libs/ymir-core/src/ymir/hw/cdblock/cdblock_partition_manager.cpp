@@ -2,7 +2,9 @@
 
 #include "cdblock_devlog.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <deque>
 #include <numeric>
 #include <utility>
 
@@ -46,7 +48,12 @@ CDBlock::PartitionManager::PartitionManager(debug::ICDBlockTracer *&tracer)
 }
 
 void CDBlock::PartitionManager::Reset() {
-    m_partitions.fill({});
+    for (auto &partition : m_partitions) {
+        partition.count = 0;
+    }
+    for (uint32 i = 0; i < kNumBuffers; i++) {
+        m_freeSlots[i] = kNumBuffers - 1 - i;
+    }
     m_freeBuffers = kNumBuffers;
     m_reservedBuffers = 0;
     devlog::trace<grp::part_mgr>("Cleared partitions; free buffers = {}", m_freeBuffers);
@@ -54,8 +61,8 @@ void CDBlock::PartitionManager::Reset() {
 
 uint8 CDBlock::PartitionManager::GetBufferCount(uint8 partitionIndex) const {
     assert(partitionIndex < m_partitions.size());
-    devlog::trace<grp::part_mgr>("Partition {} has {} buffers", partitionIndex, m_partitions[partitionIndex].size());
-    return m_partitions[partitionIndex].size();
+    devlog::trace<grp::part_mgr>("Partition {} has {} buffers", partitionIndex, m_partitions[partitionIndex].count);
+    return m_partitions[partitionIndex].count;
 }
 
 uint32 CDBlock::PartitionManager::GetFreeBufferCount() const {
@@ -88,18 +95,19 @@ void CDBlock::PartitionManager::InsertHead(uint8 partitionIndex, const Buffer &b
     assert(partitionIndex < m_partitions.size());
     assert(m_freeBuffers > 0);
     auto &partition = m_partitions[partitionIndex];
-    partition.push_back(buffer);
-    m_freeBuffers--;
+    const uint8 slot = AllocateSlot();
+    m_buffers[slot] = buffer;
+    partition.slots[partition.count++] = slot;
     devlog::trace<grp::part_mgr>("Inserted buffer into partition {} -> {} buffers; free buffers = {}", partitionIndex,
-                                 partition.size(), m_freeBuffers);
+                                 partition.count, m_freeBuffers);
     TracePartitionInsertHead(m_tracer, partitionIndex, buffer);
 }
 
 Buffer *CDBlock::PartitionManager::GetTail(uint8 partitionIndex, uint8 offset) {
     assert(partitionIndex < m_partitions.size());
     auto &partition = m_partitions[partitionIndex];
-    if (offset < partition.size()) {
-        return &*(partition.begin() + offset);
+    if (offset < partition.count) {
+        return &m_buffers[partition.slots[offset]];
     } else {
         return nullptr;
     }
@@ -108,11 +116,10 @@ Buffer *CDBlock::PartitionManager::GetTail(uint8 partitionIndex, uint8 offset) {
 bool CDBlock::PartitionManager::RemoveTail(uint8 partitionIndex, uint8 offset) {
     assert(partitionIndex < m_partitions.size());
     auto &partition = m_partitions[partitionIndex];
-    if (offset < partition.size()) {
-        partition.erase(partition.begin() + offset);
-        m_freeBuffers++;
+    if (offset < partition.count) {
+        ReleaseSlots(partition, offset, 1);
         devlog::trace<grp::part_mgr>("Removed buffer from partition {} -> {} buffers; free buffers = {}",
-                                     partitionIndex, partition.size(), m_freeBuffers);
+                                     partitionIndex, partition.count, m_freeBuffers);
         TracePartitionRemoveTail(m_tracer, partitionIndex, offset);
         return true;
     }
@@ -123,7 +130,7 @@ uint32 CDBlock::PartitionManager::DeleteSectors(uint8 partitionIndex, uint16 sec
     assert(partitionIndex < m_partitions.size());
 
     auto &partition = m_partitions[partitionIndex];
-    const uint32 totalSectors = partition.size();
+    const uint32 totalSectors = partition.count;
     uint16 start, end;
     if (sectorPos == 0xFFFF) {
         start = totalSectors - 1;
@@ -137,10 +144,9 @@ uint32 CDBlock::PartitionManager::DeleteSectors(uint8 partitionIndex, uint16 sec
     }
     start = std::min<uint16>(start, totalSectors - 1);
     end = std::min<uint16>(end, totalSectors - 1);
-    partition.erase(partition.begin() + start, partition.begin() + end + 1);
-    m_freeBuffers += end - start + 1;
+    ReleaseSlots(partition, start, end - start + 1);
     devlog::trace<grp::part_mgr>("Removed {} buffers from partition {} -> {} buffers; free buffers = {}",
-                                 end - start + 1, partitionIndex, partition.size(), m_freeBuffers);
+                                 end - start + 1, partitionIndex, partition.count, m_freeBuffers);
     TracePartitionDeleteSectors(m_tracer, partitionIndex, start, end);
     return end - start + 1;
 }
@@ -148,20 +154,21 @@ uint32 CDBlock::PartitionManager::DeleteSectors(uint8 partitionIndex, uint16 sec
 void CDBlock::PartitionManager::Clear(uint8 partitionIndex) {
     assert(partitionIndex < m_partitions.size());
     auto &partition = m_partitions[partitionIndex];
-    m_freeBuffers += partition.size();
-    devlog::trace<grp::part_mgr>("Cleared all {} buffers from partition {}; free buffers = {}", partition.size(),
-                                 partitionIndex, m_freeBuffers);
-    partition.clear();
+    const uint32 count = partition.count;
+    ReleaseSlots(partition, 0, count);
+    devlog::trace<grp::part_mgr>("Cleared all {} buffers from partition {}; free buffers = {}", count, partitionIndex,
+                                 m_freeBuffers);
     TracePartitionClear(m_tracer, partitionIndex);
 }
 
 uint32 CDBlock::PartitionManager::CalculateSize(uint8 partitionIndex, uint32 start, uint32 end) const {
     assert(partitionIndex < m_partitions.size());
     auto &partition = m_partitions[partitionIndex];
-    start = std::min<uint32>(start, partition.size() - 1);
-    end = std::min<uint32>(end, partition.size() - 1);
-    const uint32 size = std::accumulate(partition.begin() + start, partition.begin() + end + 1, 0u,
-                                        [](const uint32 lhs, const Buffer &rhs) { return lhs + rhs.size; });
+    start = std::min<uint32>(start, partition.count - 1);
+    end = std::min<uint32>(end, partition.count - 1);
+    const uint32 size =
+        std::accumulate(partition.slots.begin() + start, partition.slots.begin() + end + 1, 0u,
+                        [&](const uint32 lhs, const uint8 slot) { return lhs + m_buffers[slot].size; });
     devlog::trace<grp::part_mgr>("Calculated partition {} size from {} to {} = {} bytes", partitionIndex, start, end,
                                  size);
     return size;
@@ -170,7 +177,9 @@ uint32 CDBlock::PartitionManager::CalculateSize(uint8 partitionIndex, uint32 sta
 void CDBlock::PartitionManager::SaveState(savestate::CDBlockSaveState &state) const {
     size_t bufferIndex = 0;
     for (size_t i = 0; i < m_partitions.size(); i++) {
-        for (const auto &buffer : m_partitions[i]) {
+        const auto &partition = m_partitions[i];
+        for (uint32 j = 0; j < partition.count; j++) {
+            const Buffer &buffer = m_buffers[partition.slots[j]];
             state.buffers[bufferIndex].data = buffer.data;
             state.buffers[bufferIndex].size = buffer.size;
             state.buffers[bufferIndex].frameAddress = buffer.frameAddress;
@@ -201,14 +210,14 @@ bool CDBlock::PartitionManager::ValidateState(const savestate::CDBlockSaveState
 }
 
 void CDBlock::PartitionManager::LoadState(const savestate::CDBlockSaveState &state) {
-    for (auto &partition : m_partitions) {
-        partition.clear();
-    }
-    m_freeBuffers = kNumBuffers;
+    Reset();
 
     for (const auto &buffer : state.buffers) {
         if (buffer.partitionIndex < kNumPartitions) {
-            auto &partBuffer = m_partitions[buffer.partitionIndex].emplace_back();
+            auto &partition = m_partitions[buffer.partitionIndex];
+            const uint8 slot = AllocateSlot();
+            partition.slots[partition.count++] = slot;
+            auto &partBuffer = m_buffers[slot];
             partBuffer.data = buffer.data;
             partBuffer.size = buffer.size;
             partBuffer.frameAddress = buffer.frameAddress;
@@ -216,7 +225,6 @@ void CDBlock::PartitionManager::LoadState(const savestate::CDBlockSaveState &sta
             partBuffer.subheader.chanNum = buffer.chanNum;
             partBuffer.subheader.submode = buffer.submode;
             partBuffer.subheader.codingInfo = buffer.codingInfo;
-            --m_freeBuffers;
         }
     }
     m_reservedBuffers = state.reservedBuffers;
@@ -225,10 +233,32 @@ void CDBlock::PartitionManager::LoadState(const savestate::CDBlockSaveState &sta
 
 void CDBlock::PartitionManager::OnTracerAttached() {
     if (m_tracer) {
+        // The tracer receives a snapshot copy; this only happens when attaching or loading states
+        std::deque<Buffer> buffers{};
         for (uint8 i = 0; i < kNumPartitions; ++i) {
-            m_tracer->PartitionSync(i, m_partitions[i]);
+            const auto &partition = m_partitions[i];
+            buffers.clear();
+            for (uint32 j = 0; j < partition.count; j++) {
+                buffers.push_back(m_buffers[partition.slots[j]]);
+            }
+            m_tracer->PartitionSync(i, buffers);
         }
     }
 }
 
+uint8 CDBlock::PartitionManager::AllocateSlot() {
+    assert(m_freeBuffers > 0);
+    return m_freeSlots[--m_freeBuffers];
+}
+
+void CDBlock::PartitionManager::ReleaseSlots(Partition &partition, uint32 start, uint32 count) {
+    assert(start + count <= partition.count);
+    for (uint32 i = 0; i < count; i++) {
+        m_freeSlots[m_freeBuffers++] = partition.slots[start + i];
+    }
+    std::copy(partition.slots.begin() + start + count, partition.slots.begin() + partition.count,
+              partition.slots.begin() + start);
+    partition.count -= count;
+}
+
 } // namespace ymir::cdblock
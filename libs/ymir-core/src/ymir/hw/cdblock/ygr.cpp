@@ -65,7 +65,13 @@ void YGR::MapMemory(sys::SH1Bus &cdbBus) {
     cdbBus.MapNormal(
         0xA000000, 0xCFFFFFF, this, //
         [](uint32 address, void *ctx) -> uint16 { return cast(ctx).CDBReadWord<false>(address); },
-        [](uint32 address, uint16 value, void *ctx) { cast(ctx).CDBWriteWord<false>(address, value); });
+        [](uint32 address, uint16 value, void *ctx) { cast(ctx).CDBWriteWord<false>(address, value); },
+        [](uint32 address, uint16 *out, uint32 count, void *ctx) -> uint32 {
+            return cast(ctx).CDBReadBurst(address, out, count);
+        },
+        [](uint32 address, const uint16 *in, uint32 count, void *ctx) -> uint32 {
+            return cast(ctx).CDBWriteBurst(address, in, count);
+        });
 
     cdbBus.MapSideEffectFree(
         0xA000000, 0xCFFFFFF, this, //
@@ -278,6 +284,52 @@ FORCE_INLINE void YGR::CDBWriteWord(uint32 address, uint16 value) {
     }
 }
 
+FORCE_INLINE uint32 YGR::CDBReadBurst(uint32 address, uint16 *out, uint32 count) const {
+    if (((address >> 20) & 0xF) == 0x1 || (address & 0xFFFF) != 0x00) {
+        // Only the FIFO streams data
+        return 0;
+    }
+
+    // Same as a sequence of CDBReadWord<false>(0x00), but DREQ1# is only updated once at the end
+    uint32 units = 0;
+    while (units < count) {
+        if (!m_regs.TRCTL.TE && m_regs.TRCTL.DIR && m_fifo.count == 1) {
+            m_regs.TRCTL.TE = 1;
+        }
+        out[units++] = m_fifo.Read<false>();
+        if (IsFIFODREQBlocked()) {
+            break;
+        }
+    }
+    devlog::trace<grp::ygr_fifo>("CDB  FIFO burst read  <- rd={:X} wr={:X} cnt={:X}  {} words", m_fifo.readPos,
+                                 m_fifo.writePos, m_fifo.count, units);
+    UpdateFIFODREQ();
+    return units;
+}
+
+uint32 YGR::CDBWriteBurst(uint32 address, const uint16 *in, uint32 count) {
+    if (((address >> 20) & 0xF) == 0x1 || (address & 0xFFFF) != 0x00) {
+        // Only the FIFO streams data
+        return 0;
+    }
+
+    // Same as a sequence of CDBWriteWord<false>(0x00, ...), but DREQ1# is only updated once at the end
+    uint32 units = 0;
+    while (units < count) {
+        m_fifo.Write<false>(in[units++]);
+        if (m_regs.TRCTL.TE && m_regs.TRCTL.DIR) {
+            m_regs.TRCTL.TE = 0;
+        }
+        if (IsFIFODREQBlocked()) {
+            break;
+        }
+    }
+    devlog::trace<grp::ygr_fifo>("CDB  FIFO burst write -> rd={:X} wr={:X} cnt={:X}  {} words", m_fifo.readPos,
+                                 m_fifo.writePos, m_fifo.count, units);
+    UpdateFIFODREQ();
+    return units;
+}
+
 FORCE_INLINE uint8 YGR::CDBPeekByte(uint32 address) const {
     if (((address >> 20) & 0xF) == 0x1) {
         // TODO: read from Video CD Card registers instead
@@ -668,13 +720,17 @@ void YGR::UpdateInterrupts() {
     }
 }
 
-void YGR::UpdateFIFODREQ() const {
+FORCE_INLINE bool YGR::IsFIFODREQBlocked() const {
     // DREQ1# signals data transfers between the host and the CD block SH-1.
     // DREQ1# is asserted when transfers are enabled and not blocked from the SH-1 side:
     // - When doing a CDB->host transfer (SH-1 is writing to the FIFO), the FIFO should not be full
     // - When doing a host->CDB transfer (SH-1 is reading from the FIFO), the FIFO should not be empty
     // The signal is inverted, so `true` means the transfer should be blocked.
-    m_cbSetDREQ1n(!m_regs.TRCTL.TE || (m_regs.TRCTL.DIR ? m_fifo.IsEmpty() : m_fifo.IsFull()));
+    return !m_regs.TRCTL.TE || (m_regs.TRCTL.DIR ? m_fifo.IsEmpty() : m_fifo.IsFull());
+}
+
+void YGR::UpdateFIFODREQ() const {
+    m_cbSetDREQ1n(IsFIFODREQBlocked());
 }
 
 void YGR::SectorTransferDone() {
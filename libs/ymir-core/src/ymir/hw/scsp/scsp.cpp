@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <limits>
 #include <ostream>
+#include <vector>
 
 using namespace ymir::m68k;
 
@@ -45,6 +46,7 @@ SCSP::SCSP(core::Scheduler &scheduler, core::Configuration::Audio &config)
     // Replicate interpolation mode to avoid an extra dereference in the hot path
     config.interpolation.Observe(m_interpMode);
     config.threadedSCSP.Observe([&](bool value) { EnableThreading(value); });
+    config.m68kBatching.Observe([&](bool value) { m_m68kBatching = value; });
 
     m_sampleTickEvent =
         m_scheduler.RegisterEvent(core::events::SCSPSample, this,
@@ -86,6 +88,8 @@ void SCSP::Reset(bool hard) {
     m_m68k.Reset(true);
     m_m68kSpilloverCycles = 0;
     m_m68kEnabled = false;
+    m_m68kIdleLoop.Reset();
+    m_m68kBatch.Reset();
 
     m_m68kCycles = 0;
     m_sampleCounter = 0;
@@ -118,6 +122,7 @@ void SCSP::Reset(bool hard) {
     }
 
     m_scuEnabledInterrupts = 0;
+    m_scuInterruptsEnabled = false;
     m_scuPendingInterrupts = 0;
     m_m68kEnabledInterrupts = 0;
     m_m68kPendingInterrupts = 0;
@@ -145,7 +150,7 @@ void SCSP::Reset(bool hard) {
 }
 
 void SCSP::MapMemoryDirect(sys::SH2Bus &bus) {
-    bus.MapArray(0x5A0'0000, 0x5A7'FFFF, m_WRAM, true);
+    bus.MapArray(0x5A0'0000, 0x5A7'FFFF, m_WRAM, true, sys::kHostEndianMemory);
 }
 
 void SCSP::MapMemoryThreaded(sys::SH2Bus &bus) {
@@ -343,7 +348,9 @@ void SCSP::FlushMidiOutput(bool endPacket) {
 }
 
 void SCSP::DumpWRAM(std::ostream &out) const {
-    out.write((const char *)m_WRAM.data(), m_WRAM.size());
+    std::vector<uint8> buf(m_WRAM.size());
+    sys::CopyToGuestOrder(buf, m_WRAM);
+    out.write((const char *)buf.data(), buf.size());
 }
 
 void SCSP::DumpDSP_MPRO(std::ostream &out) const {
@@ -407,11 +414,17 @@ void SCSP::DumpDSPRegs(std::ostream &out) const {
 }
 
 void SCSP::SetCPUEnabled(bool enabled) {
+    // The MC68EC000 runs on the SCSP thread and fetches its reset vectors from sound RAM, which may still have writes
+    // pending in the event queue
+    if (m_threadedSCSP) {
+        SyncSCSPThread();
+    }
     if (m_m68kEnabled != enabled) {
         devlog::info<grp::base>("MC68EC00 processor {}", (enabled ? "enabled" : "disabled"));
         if (enabled) {
             m_m68k.Reset(true); // false? does it matter?
             m_m68kSpilloverCycles = 0;
+            m_m68kIdleLoop.Reset();
         }
         m_m68kEnabled = enabled;
     }
@@ -419,7 +432,7 @@ void SCSP::SetCPUEnabled(bool enabled) {
 
 void SCSP::SaveState(savestate::SCSPSaveState &state) const {
     const_cast<SCSP *>(this)->SyncSCSPThread();
-    state.WRAM = m_WRAM;
+    sys::CopyToGuestOrder(state.WRAM, m_WRAM);
     state.cddaBuffer = m_cddaBuffer;
     state.cddaReadPos = m_cddaReadPos;
     state.cddaWritePos = m_cddaWritePos;
@@ -428,6 +441,9 @@ void SCSP::SaveState(savestate::SCSPSaveState &state) const {
     m_m68k.SaveState(state.m68k);
     state.m68kSpilloverCycles = m_m68kSpilloverCycles;
     state.m68kEnabled = m_m68kEnabled;
+    state.m68kBatchLength = m_m68kBatch.length;
+    state.m68kBatchTicks = m_m68kBatch.ticks;
+    state.m68kBatchProcessed = m_m68kBatch.processed;
 
     for (size_t i = 0; i < 32; i++) {
         m_slots[i].SaveState(state.slots[i]);
@@ -506,6 +522,10 @@ bool SCSP::ValidateState(const savestate::SCSPSaveState &state) const {
     if (state.currSlot > 31) {
         return false;
     }
+    if (state.m68kBatchLength > M68KBatch::kMaxSamples || state.m68kBatchTicks > state.m68kBatchLength ||
+        state.m68kBatchProcessed > state.m68kBatchLength || state.m68kBatchProcessed < state.m68kBatchTicks) {
+        return false;
+    }
     if (!m_dsp.ValidateState(state.dsp)) {
         return false;
     }
@@ -529,7 +549,7 @@ void SCSP::LoadState(const savestate::SCSPSaveState &state) {
     if (m_threadedSCSP) {
         SyncSCSPThread();
     }
-    m_WRAM = state.WRAM;
+    sys::CopyFromGuestOrder(m_WRAM, state.WRAM);
     m_cddaBuffer = state.cddaBuffer;
     m_cddaReadPos = state.cddaReadPos % m_cddaBuffer.size();
     m_cddaWritePos = state.cddaWritePos % m_cddaBuffer.size();
@@ -538,6 +558,13 @@ void SCSP::LoadState(const savestate::SCSPSaveState &state) {
     m_m68k.LoadState(state.m68k);
     m_m68kSpilloverCycles = state.m68kSpilloverCycles;
     m_m68kEnabled = state.m68kEnabled;
+    m_m68kIdleLoop.Reset();
+    m_m68kBatch.Reset();
+    if (m_stepGranularity == 5u) {
+        m_m68kBatch.length = state.m68kBatchLength;
+        m_m68kBatch.ticks = state.m68kBatchTicks;
+        m_m68kBatch.processed = state.m68kBatchProcessed;
+    }
 
     for (size_t i = 0; i < 32; i++) {
         m_slots[i].LoadState(state.slots[i]);
@@ -556,6 +583,7 @@ void SCSP::LoadState(const savestate::SCSPSaveState &state) {
     }
 
     m_scuEnabledInterrupts = state.MCIEB & 0x7FF;
+    m_scuInterruptsEnabled = m_scuEnabledInterrupts != 0;
     m_scuPendingInterrupts = state.MCIPD & 0x7FF;
     m_m68kEnabledInterrupts = state.SCIEB & 0x7FF;
     m_m68kPendingInterrupts = state.SCIPD & 0x7FF;
@@ -625,6 +653,10 @@ void SCSP::OnSampleTickEvent(core::EventContext &eventContext, void *userContext
         scsp.TickSampleThreaded();
     } else {
         scsp.TickSample<debug, false>();
+        if (scsp.m_pendingStepGranularity != 5u && scsp.m_m68kBatch.ticks == scsp.m_m68kBatch.length) [[unlikely]] {
+            scsp.ApplyPendingStepGranularity(eventContext);
+            return;
+        }
     }
     eventContext.Reschedule(kCyclesPerSample);
 }
@@ -638,14 +670,14 @@ void SCSP::OnTransitionalTickEvent(core::EventContext &eventContext, void *userC
     // Check if the slot counter is aligned
     auto &scsp = *static_cast<SCSP *>(userContext);
     if ((scsp.m_currSlot & kSlotIndexMask) == 0) {
-        // Aligned; switch to the bigger tick event
+        // Aligned; switch to the bigger tick event and run it right away so that this tick isn't lost
         if constexpr (newStepShift == 5u) {
             scsp.m_scheduler.SetEventCallback(scsp.m_sampleTickEvent, &scsp, OnSampleTickEvent<debug, threaded>);
-            eventContext.Reschedule(kCyclesPerSample);
+            OnSampleTickEvent<debug, threaded>(eventContext, userContext);
         } else {
             scsp.m_scheduler.SetEventCallback(scsp.m_sampleTickEvent, &scsp,
                                               OnSlotTickEvent<newStepShift, debug, threaded>);
-            eventContext.Reschedule(kCyclesPerSlot << newStepShift);
+            OnSlotTickEvent<newStepShift, debug, threaded>(eventContext, userContext);
         }
     } else {
         // Not yet aligned; continue ticking slots one by one
@@ -656,6 +688,13 @@ void SCSP::OnTransitionalTickEvent(core::EventContext &eventContext, void *userC
 
 void SCSP::SetStepGranularity(uint32 granularity) {
     granularity = 5u - std::min(granularity, 5u);
+    if (!m_threadedSCSP && m_stepGranularity == 5u && m_m68kBatch.ticks < m_m68kBatch.length) {
+        // The slots may be ahead of the scheduler in the middle of an MC68EC000 batch.
+        // Let the sample tick event switch steps once the batch is complete.
+        m_pendingStepGranularity = granularity;
+        return;
+    }
+    m_pendingStepGranularity = 5u;
     if (m_stepGranularity != granularity) {
         // Switch callbacks
         if (granularity < m_stepGranularity) {
@@ -666,28 +705,7 @@ void SCSP::SetStepGranularity(uint32 granularity) {
             m_scheduler.ScheduleAt(m_sampleTickEvent, newTarget);
 
             if (!m_threadedSCSP) {
-                core::Scheduler::EventCallback callback;
-                switch (granularity) {
-                case 0u: callback = GetSlotTickEvent<0u, false>(); break;
-                case 1u:
-                    callback =
-                        (m_currSlot & 0x1) ? GetTransitionalTickEvent<1u, false>() : GetSlotTickEvent<1u, false>();
-                    break;
-                case 2u:
-                    callback =
-                        (m_currSlot & 0x3) ? GetTransitionalTickEvent<2u, false>() : GetSlotTickEvent<2u, false>();
-                    break;
-                case 3u:
-                    callback =
-                        (m_currSlot & 0x7) ? GetTransitionalTickEvent<3u, false>() : GetSlotTickEvent<3u, false>();
-                    break;
-                case 4u:
-                    callback =
-                        (m_currSlot & 0xF) ? GetTransitionalTickEvent<4u, false>() : GetSlotTickEvent<4u, false>();
-                    break;
-                default: util::unreachable();
-                }
-                m_scheduler.SetEventCallback(m_sampleTickEvent, this, callback);
+                m_scheduler.SetEventCallback(m_sampleTickEvent, this, GetSmallerStepTickEvent(granularity));
             }
         } else {
             // Going from smaller to larger steps requires the slot counter to be realigned.
@@ -717,11 +735,36 @@ void SCSP::SetStepGranularity(uint32 granularity) {
     }
 }
 
+void SCSP::ApplyPendingStepGranularity(core::EventContext &eventContext) {
+    // The event is currently at the end of the last sample of the batch, so the next smaller step simply ends one step
+    // from here instead of one sample
+    const uint32 granularity = m_pendingStepGranularity;
+    m_pendingStepGranularity = 5u;
+    m_scheduler.SetEventCallback(m_sampleTickEvent, this, GetSmallerStepTickEvent(granularity));
+    eventContext.Reschedule(kCyclesPerSlot << granularity);
+    m_stepGranularity = granularity;
+}
+
+core::Scheduler::EventCallback SCSP::GetSmallerStepTickEvent(uint32 granularity) {
+    switch (granularity) {
+    case 0u: return GetSlotTickEvent<0u, false>();
+    case 1u: return (m_currSlot & 0x1) ? GetTransitionalTickEvent<1u, false>() : GetSlotTickEvent<1u, false>();
+    case 2u: return (m_currSlot & 0x3) ? GetTransitionalTickEvent<2u, false>() : GetSlotTickEvent<2u, false>();
+    case 3u: return (m_currSlot & 0x7) ? GetTransitionalTickEvent<3u, false>() : GetSlotTickEvent<3u, false>();
+    case 4u: return (m_currSlot & 0xF) ? GetTransitionalTickEvent<4u, false>() : GetSlotTickEvent<4u, false>();
+    default: util::unreachable();
+    }
+}
+
 void SCSP::UpdateStepFunction() {
     if (m_threadedSCSP) {
         m_scheduler.SetEventCallback(m_sampleTickEvent, this, GetSampleTickEvent<true>());
         return;
     }
+    if (m_stepGranularity != 5u) {
+        // Slot steps run the MC68EC000 in lockstep with the slots
+        m_m68kBatch.Reset();
+    }
     switch (m_stepGranularity) {
     case 0u: m_scheduler.SetEventCallback(m_sampleTickEvent, this, GetSlotTickEvent<0u, false>()); break;
     case 1u: m_scheduler.SetEventCallback(m_sampleTickEvent, this, GetTransitionalTickEvent<1u, false>()); break;
@@ -880,29 +923,201 @@ void SCSP::ExecuteDMA() {
 
 template <uint32 stepShift, bool debug>
 FORCE_INLINE void SCSP::TickSlots() {
-    RunM68K(kM68KCyclesPerSlot << stepShift);
+    RunM68K<false>(kM68KCyclesPerSlot << stepShift);
     ProcessMidiInputQueue<false>();
     StepSlots<stepShift, false>();
 }
 
 template <bool debug, bool threaded>
 FORCE_INLINE void SCSP::TickSample() {
-    RunM68K(kM68KCyclesPerSample);
-    ProcessMidiInputQueue<threaded>();
-    StepSample<debug, threaded>();
+    auto &batch = m_m68kBatch;
+    if (batch.ticks == batch.length) {
+        // Without batching, every batch spans a single sample, which runs the MC68EC000 and the slots in lockstep
+        batch.length = m_m68kBatching ? CalcM68KBatchLength() : 1;
+        batch.ticks = 0;
+        batch.processed = 0;
+        batch.fnProcessSample = &SCSP::ProcessM68KBatchSample<debug, threaded>;
+        RunM68KBatch();
+    }
+    ++batch.ticks;
+
+    // The slots may have already caught up with this sample while the MC68EC000 was running
+    if (batch.processed < batch.ticks) {
+        ProcessM68KBatchSample<debug, threaded>();
+    }
 }
 
+template <bool batched>
 FORCE_INLINE void SCSP::RunM68K(uint64 cycles) {
     if (m_m68kEnabled) {
         cycles <<= m_m68kClockShift;
         uint64 cy = m_m68kSpilloverCycles;
+        if (m_m68kIdleLoop.idle) {
+            cy = RunM68KIdle(cy, cycles);
+        }
         while (cy < cycles) {
-            cy += m_m68k.Step();
+            if constexpr (batched) {
+                m_m68kBatch.instrCycle = cy;
+            }
+            const uint32 prevPC = m_m68k.GetPC();
+            const uint64 stepCycles = m_m68k.Step();
+            cy += stepCycles;
+            if (m_m68k.GetPC() < prevPC || m_m68kIdleLoop.observing) [[unlikely]] {
+                ObserveM68KIdleLoop(prevPC, stepCycles);
+            }
+            if constexpr (batched) {
+                // The instruction may have cut the batch short
+                cycles = m_m68kBatch.length * m_m68kBatch.budget;
+            }
         }
         m_m68kSpilloverCycles = cy - cycles;
     }
 }
 
+FORCE_INLINE void SCSP::RunM68KBatch() {
+    auto &batch = m_m68kBatch;
+    batch.budget = kM68KCyclesPerSample << m_m68kClockShift;
+    batch.instrCycle = 0;
+    batch.syncCycle = batch.budget;
+    RunM68K<true>(batch.length * kM68KCyclesPerSample);
+    batch.syncCycle = M68KBatch::kNoSync;
+}
+
+template <bool debug, bool threaded>
+FORCE_INLINE void SCSP::ProcessM68KBatchSample() {
+    ProcessMidiInputQueue<threaded>();
+    StepSample<debug, threaded>();
+    ++m_m68kBatch.processed;
+}
+
+void SCSP::SyncM68KBatch() {
+    auto &batch = m_m68kBatch;
+    const uint64 sample = batch.instrCycle / batch.budget;
+    while (batch.processed < sample) {
+        (this->*batch.fnProcessSample)();
+    }
+    batch.syncCycle = (sample + 1) * batch.budget;
+}
+
+void SCSP::ShortenM68KBatch() {
+    auto &batch = m_m68kBatch;
+    batch.length = std::min(batch.length, batch.processed + CalcM68KBatchLength());
+}
+
+uint32 SCSP::CalcM68KBatchLength() const {
+    // Interrupts may be delivered to the MC68EC000 or to the SCU
+    const uint16 enabledInterrupts = m_m68kEnabledInterrupts | m_scuEnabledInterrupts;
+
+    // The sample interrupt fires on every sample
+    if (enabledInterrupts & (1u << kIntrSample)) {
+        return 1;
+    }
+
+    // Stop at the first sample where an enabled timer interrupt may fire. Timers tick on the samples where the masked
+    // counter wraps around to zero.
+    uint64 length = M68KBatch::kMaxSamples;
+    for (uint32 i = 0; i < 3; i++) {
+        if (enabledInterrupts & (1u << (kIntrTimerA + i))) {
+            const auto &timer = m_timers[i];
+            const uint64 firstTick = (m_sampleCounter | timer.incrementMask) + 1;
+            const uint64 trigger = firstTick + (timer.TicksUntilTrigger() - 1) * (timer.incrementMask + 1);
+            length = std::min(length, trigger - m_sampleCounter);
+        }
+    }
+    return static_cast<uint32>(length);
+}
+
+uint64 SCSP::RunM68KIdle(uint64 cy, uint64 cycles) {
+    auto &loop = m_m68kIdleLoop;
+
+    // Everything the loop depends on can only change between calls, so if nothing changed since the loop was observed,
+    // the whole budget of this call is spent spinning in it.
+    // The DSP is the exception: it writes to sound RAM while the slots process the samples of this call, which may be
+    // a whole batch. If a DSP program loaded or moved since the loop was observed may write to any of the polled
+    // addresses, leave the loop so that the reads synchronize with the slots as usual.
+    bool unchanged = m_m68k.GetExternalInterruptLevel() == loop.startState.extIntrLevel;
+    for (uint32 i = 0; i < loop.numReads && unchanged; ++i) {
+        const auto &read = loop.reads[i];
+        if (m_dsp.MayWriteWRAM(read.address)) {
+            unchanged = false;
+            break;
+        }
+        const uint16 value = read.word ? ReadWRAM<uint16>(read.address) : ReadWRAM<uint8>(read.address);
+        unchanged = value == read.value;
+    }
+    if (!unchanged) {
+        devlog::trace<grp::base>("M68K left idle loop at {:06X}", loop.startState.PC);
+        loop.idle = false;
+        return cy;
+    }
+
+    // The previous call may have stopped in the middle of an iteration; finish it normally
+    for (uint32 i = 0; i < loop.numInstructions && m_m68k.GetPC() != loop.startState.PC; ++i) {
+        if (cy >= cycles) {
+            return cy;
+        }
+        cy += m_m68k.Step();
+    }
+    if (m_m68k.GetPC() != loop.startState.PC) {
+        // Shouldn't happen, but bail out just in case
+        loop.idle = false;
+        return cy;
+    }
+
+    // Skip every iteration that would run to completion within the budget. The remainder is executed normally so that
+    // the MC68EC000 stops at the same instruction it would have if every iteration had been executed.
+    if (cy < cycles) {
+        cy += (cycles - cy - 1) / loop.cycles * loop.cycles;
+    }
+    return cy;
+}
+
+void SCSP::ObserveM68KIdleLoop(uint32 prevPC, uint64 stepCycles) {
+    auto &loop = m_m68kIdleLoop;
+    if (loop.idle) {
+        return;
+    }
+
+    const uint32 pc = m_m68k.GetPC();
+    if (!loop.observing) {
+        // A backward branch was taken; observe the next iteration if the loop is short enough
+        if (prevPC - pc > M68KIdleLoop::kMaxLoopSize) {
+            return;
+        }
+        if (loop.retryDelay > 0) {
+            --loop.retryDelay;
+            return;
+        }
+        loop.observing = true;
+        loop.disqualified = false;
+        loop.numInstructions = 0;
+        loop.numReads = 0;
+        loop.cycles = 0;
+        m_m68k.SaveState(loop.startState);
+        return;
+    }
+
+    loop.cycles += stepCycles;
+    ++loop.numInstructions;
+    if (!loop.disqualified && loop.numInstructions <= M68KIdleLoop::kMaxInstructions && pc != loop.startState.PC) {
+        // Still in the middle of the iteration
+        return;
+    }
+
+    loop.observing = false;
+    if (!loop.disqualified && pc == loop.startState.PC) {
+        savestate::M68KSaveState state;
+        m_m68k.SaveState(state);
+        if (state == loop.startState) {
+            devlog::trace<grp::base>("M68K idle loop detected at {:06X} - {} instructions, {} cycles, {} reads", pc,
+                                     loop.numInstructions, loop.cycles, loop.numReads);
+            loop.idle = true;
+            return;
+        }
+    }
+    loop.retryDelay = M68KIdleLoop::kRetryDelay;
+}
+
 template <uint32 stepShift, bool debug>
 FORCE_INLINE void SCSP::StepSlots() {
     if constexpr (stepShift == 5u) {
@@ -1410,19 +1625,26 @@ void SCSP::SCSPThreadLoop() {
                 break;
             }
 
-            case ThreadEvent::Type::Sample:
-                // Process one sample
+            case ThreadEvent::Type::Advance:
                 if (m_debugTracing) {
-                    TickSample<true, true>();
+                    for (uint32 j = 0; j < evt.samples; ++j) {
+                        TickSample<true, true>();
+                    }
                 } else {
-                    TickSample<false, true>();
+                    for (uint32 j = 0; j < evt.samples; ++j) {
+                        TickSample<false, true>();
+                    }
                 }
                 break;
 
             case ThreadEvent::Type::Quit: m_threadRunning = false; break;
             }
+        }
 
-            m_eventsProcessed.fetch_add(1, std::memory_order_release);
+        // Pairs with the m_syncWaiting store and m_eventsProcessed load in SyncSCSPThread() (both sequentially
+        // consistent): either the waiter observes the new count or this thread observes the waiter and wakes it up
+        m_eventsProcessed.fetch_add(numEvents);
+        if (m_syncWaiting.load()) {
             m_eventsProcessed.notify_all();
         }
     }
@@ -1433,10 +1655,17 @@ void SCSP::SyncSCSPThread() {
         return;
     }
 
-    uint64 target = m_eventsProcessed.load();
-    while (target != m_eventsEnqueued) {
-        m_eventsProcessed.wait(target, std::memory_order_acquire);
-        target = m_eventsProcessed.load(std::memory_order_acquire);
+    FlushEvents();
+
+    uint64 processed = m_eventsProcessed.load(std::memory_order_acquire);
+    if (processed != m_eventsEnqueued) {
+        m_syncWaiting.store(true);
+        processed = m_eventsProcessed.load();
+        while (processed != m_eventsEnqueued) {
+            m_eventsProcessed.wait(processed, std::memory_order_acquire);
+            processed = m_eventsProcessed.load(std::memory_order_acquire);
+        }
+        m_syncWaiting.store(false, std::memory_order_relaxed);
     }
 
     PollSCSPInterrupts();
@@ -1445,6 +1674,7 @@ void SCSP::SyncSCSPThread() {
 void SCSP::StopSCSPThread() {
     if (m_scspThread.joinable()) {
         EnqueueEvent(ThreadEvent::Quit());
+        FlushEvents();
         m_scspThread.join();
     }
 }
@@ -1467,8 +1697,20 @@ void SCSP::EnqueueWrite(uint32 address, T value) {
 }
 
 void SCSP::EnqueueEvent(ThreadEvent &&event) {
-    ++m_eventsEnqueued;
-    m_threadEventQueue.enqueue(m_ptokThreadEventQueue, std::move(event));
+    m_pendingEvents[m_numPendingEvents++] = std::move(event);
+    if (m_numPendingEvents == m_pendingEvents.size()) {
+        FlushEvents();
+    }
+}
+
+void SCSP::FlushEvents() {
+    if (m_numPendingEvents == 0) {
+        return;
+    }
+    m_eventsEnqueued += m_numPendingEvents;
+    m_threadEventQueue.enqueue_bulk(m_ptokThreadEventQueue, m_pendingEvents.begin(), m_numPendingEvents);
+    m_numPendingEvents = 0;
+    m_numPendingSamples = 0;
 }
 
 template void SCSP::EnqueueWrite<uint8>(uint32 address, uint8 value);
@@ -1515,7 +1757,16 @@ template void SCSP::WriteRegBus<uint8>(uint32 address, uint8 value);
 template void SCSP::WriteRegBus<uint16>(uint32 address, uint16 value);
 
 void SCSP::TickSampleThreaded() {
-    EnqueueEvent(ThreadEvent::Sample());
+    if (m_numPendingEvents > 0 && m_pendingEvents[m_numPendingEvents - 1].type == ThreadEvent::Type::Advance) {
+        ++m_pendingEvents[m_numPendingEvents - 1].samples;
+    } else {
+        EnqueueEvent(ThreadEvent::Advance(1));
+    }
+    // Don't hold back samples that may raise sound request interrupts, otherwise they would reach the SCU up to
+    // kMaxPendingSamples samples late
+    if (++m_numPendingSamples >= kMaxPendingSamples || m_scuInterruptsEnabled.load(std::memory_order_relaxed)) {
+        FlushEvents();
+    }
     PollSCSPInterrupts();
 }
 
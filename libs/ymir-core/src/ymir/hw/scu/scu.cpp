@@ -827,8 +827,53 @@ void SCU::RunDMA(uint64 cycles) {
                                         addr, value, ch.currXferCount);
             }
 
+            // Fixed-address reads from data ports such as the CD block data transfer register can be done in bursts
+            const bool burstRead = ch.currSrcAddrInc == 0 && m_bus.HasBurstRead(ch.currSrcAddr);
+
             // 32-bit transfers -- the bulk of the DMA operation
             while (ch.currXferCount >= 4) {
+                if (burstRead && xfer.bufPos == 4) {
+                    // Collect the destinations of the next writes up to the first one that would stall
+                    std::array<uint32, 64> addrs;
+                    std::array<uint32, 64> values;
+                    const uint32 maxCount = std::min<uint32>(ch.currXferCount / 4, addrs.size());
+                    uint32 count = 0;
+                    if (!checkReadStall(sizeof(uint32))) {
+                        uint32 dstOffset = currDstOffset;
+                        uint32 dstAddr = currDstAddr;
+                        while (count < maxCount) {
+                            if (dstOffset >= 4u) {
+                                dstOffset -= 4u;
+                                dstAddr += ch.currDstAddrInc;
+                                dstAddr &= 0x7FF'FFFF;
+                            }
+                            const uint32 addr = (dstAddr + dstOffset) & ~3u;
+                            if (checkWriteStall(addr, sizeof(uint32))) {
+                                break;
+                            }
+                            addrs[count++] = addr;
+                            dstOffset += 4;
+                        }
+                    }
+
+                    // Let the regular path handle stalls
+                    if (count > 0) {
+                        m_bus.ReadBurst(ch.currSrcAddr & ~3u, values.data(), count);
+                        xfer.buf = values[count - 1];
+                        for (uint32 i = 0; i < count; ++i) {
+                            incDst();
+                            m_bus.Write<uint32>(addrs[i], values[i]);
+
+                            currDstOffset += 4;
+                            ch.currXferCount -= 4;
+
+                            devlog::trace<grp::dma>("SCU DMA{}: 32-bit write to {:08X} -> {:08X}, {:X} bytes remaining",
+                                                    level, addrs[i], values[i], ch.currXferCount);
+                        }
+                        continue;
+                    }
+                }
+
                 incDst();
                 const uint32 addr = (currDstAddr + currDstOffset) & ~3u;
                 if (checkReadStall(sizeof(uint32)) || checkWriteStall(addr, sizeof(uint32))) {
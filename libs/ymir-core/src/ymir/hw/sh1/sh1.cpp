@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -141,6 +142,8 @@ void SH1::Reset(bool hard, bool watchdogInitiated) {
     m_delaySlot = false;
 
     m_totalCycles = 0;
+    m_sliceStartCycles = 0;
+    UpdateNextITUEvent();
 }
 
 void SH1::LoadROM(std::span<uint8, 64 * 1024> rom) {
@@ -151,9 +154,11 @@ void SH1::LoadROM(std::span<uint8, 64 * 1024> rom) {
 uint64 SH1::Advance(uint64 cycles, uint64 spilloverCycles) {
     m_cyclesExecuted = spilloverCycles;
 
-    // TODO: lazily update these
-    // TODO: AdvanceWDT<false>();
-    AdvanceITU();
+    // TODO: AdvanceWDT<false>(); lazily, like the ITU
+    m_sliceStartCycles = m_totalCycles;
+    if (m_totalCycles >= m_nextITUEventCycles) {
+        AdvanceITU();
+    }
     AdvanceSCI();
 
     // TODO: debugging features
@@ -214,7 +219,10 @@ uint64 SH1::Advance(uint64 cycles, uint64 spilloverCycles) {
 FLATTEN uint64 SH1::Step() {
     m_cyclesExecuted = 0; // so that on-chip modules are synced to the scheduler
     // TODO: AdvanceWDT<false>();
-    AdvanceITU();
+    m_sliceStartCycles = m_totalCycles;
+    if (m_totalCycles >= m_nextITUEventCycles) {
+        AdvanceITU();
+    }
     AdvanceSCI();
     const uint64 cycles = InterpretNext();
     AdvanceDMA(cycles);
@@ -270,6 +278,7 @@ void SH1::SetTIOCB3(bool level) {
     }
 
     if (trigger) {
+        AdvanceITU();
         timer.IMFB = true;
         if (timer.bufferModeB) {
             timer.BRB = timer.GRB;
@@ -281,6 +290,7 @@ void SH1::SetTIOCB3(bool level) {
         if (timer.IMFBIntrEnable) {
             RaiseInterrupt(InterruptSource::ITU3_IMIB3);
         }
+        UpdateNextITUEvent();
     }
 }
 
@@ -390,13 +400,16 @@ void SH1::LoadState(const savestate::SH1SaveState &state) {
     m_TIOCB3 = state.TIOCB3;
 
     m_intrPending = !m_delaySlot && INTC.pending.level > SR.ILevel;
+
+    m_sliceStartCycles = m_totalCycles;
+    UpdateNextITUEvent();
 }
 
 // -----------------------------------------------------------------------------
 // Cycle counting
 
-FORCE_INLINE void SH1::AdvanceITU() {
-    const uint64 cycles = m_totalCycles;
+void SH1::AdvanceITU() {
+    const uint64 cycles = m_sliceStartCycles;
 
     for (uint32 i = 0; i < 5; ++i) {
         auto &timer = ITU.timers[i];
@@ -407,29 +420,8 @@ FORCE_INLINE void SH1::AdvanceITU() {
         // Must be monotonically increasing
         assert(cycles >= timer.currCycles);
 
-        const uint64 timerCycles = cycles - timer.currCycles;
-
-        uint64 steps = 0;
-        using Prescaler = IntegratedTimerPulseUnit::Timer::Prescaler;
-        switch (timer.prescaler) {
-        case Prescaler::Phi:
-            steps = timerCycles;
-            timer.currCycles = cycles;
-            break;
-        case Prescaler::Phi2:
-            steps = timerCycles >> 1ull;
-            timer.currCycles = cycles & ~1ull;
-            break;
-        case Prescaler::Phi4:
-            steps = timerCycles >> 2ull;
-            timer.currCycles = cycles & ~3ull;
-            break;
-        case Prescaler::Phi8:
-            steps = timerCycles >> 3ull;
-            timer.currCycles = cycles & ~7ull;
-            break;
-        default: timer.currCycles = cycles; break; // TCLKA to TCLKD, not implemented
-        }
+        const uint64 steps = timer.StepsUntil(cycles);
+        timer.currCycles = cycles;
 
         uint64 nextCount = timer.counter + steps;
         if (nextCount >= 0x10000) {
@@ -490,6 +482,16 @@ FORCE_INLINE void SH1::AdvanceITU() {
         }
         timer.counter = nextCount;
     }
+
+    UpdateNextITUEvent();
+}
+
+FORCE_INLINE void SH1::UpdateNextITUEvent() {
+    uint64 nextEventCycles = std::numeric_limits<uint64>::max();
+    for (const auto &timer : ITU.timers) {
+        nextEventCycles = std::min(nextEventCycles, timer.NextEventCycles());
+    }
+    m_nextITUEventCycles = nextEventCycles;
 }
 
 FORCE_INLINE void SH1::AdvanceSCI() {
@@ -509,24 +511,36 @@ FORCE_INLINE void SH1::AdvanceSCI() {
         // Must be monotonically increasing
         assert(cycles >= ch.currCycles);
 
+        // Frames are exchanged with the peer as whole bytes at the time their last bit is clocked.
+        // A partially shifted frame is left pending until enough cycles have elapsed to complete it.
         uint64 chCycles = cycles - ch.currCycles;
         while (chCycles >= ch.cyclesPerBit) {
-            chCycles -= ch.cyclesPerBit;
             if (ch.txEnd) {
                 chCycles = cycles;
                 break;
             }
+            const uint64 frameCycles = ch.FrameBitsLeft() * ch.cyclesPerBit;
+            if (chCycles < frameCycles) {
+                break;
+            }
+            chCycles -= frameCycles;
+
+            if (ch.txEnable && ch.TSRbit == 0u) {
+                // Idle transmitter; nothing is exchanged with the peer
+                ch.TransmitByte();
+                continue;
+            }
             if (ch.rxEnable) {
-                const bool bit = m_cbSerialRx[i]();
-                ch.ReceiveBit(bit);
-                if (ch.rxIntrEnable && ch.rxFull) {
+                ch.ReceiveByte(m_cbSerialRx[i]());
+                if (ch.rxIntrEnable) {
                     RaiseInterrupt(
                         static_cast<InterruptSource>(static_cast<uint32>(InterruptSource::SCI0_RxI0) - i * 4));
                 }
             }
             if (ch.txEnable) {
-                const bool bit = ch.TransmitBit();
-                m_cbSerialTx[i](bit);
+                const uint8 value = ch.TSR;
+                ch.TransmitByte();
+                m_cbSerialTx[i](value);
                 // TODO: handle Tx-related interrupts
             }
         }
@@ -535,11 +549,15 @@ FORCE_INLINE void SH1::AdvanceSCI() {
 }
 
 /*FORCE_INLINE*/ void SH1::AdvanceDMA(uint64 cycles) {
+    // One unit per cycle, the maximum transfer count of a channel is 65536 units
     for (uint32 i = 0; i < 4; ++i) {
-        for (uint64 c = 0; c < cycles; ++c) {
-            if (!StepDMAC(i)) {
+        uint64 remaining = cycles;
+        while (remaining > 0) {
+            const uint32 units = StepDMAC(i, static_cast<uint32>(std::min<uint64>(remaining, 0x10000)));
+            if (units == 0) {
                 break;
             }
+            remaining -= units;
         }
     }
 }
@@ -692,8 +710,20 @@ FORCE_INLINE uint64 SH1::AccessCycles(uint32 address) {
 // -----------------------------------------------------------------------------
 // On-chip modules
 
+// Accesses to ITU registers synchronize the timers
+FORCE_INLINE static bool IsITURegister(uint32 address) {
+    return address >= 0x100 && address <= 0x13F;
+}
+
 template <mem_primitive T, bool peek>
 /*FLATTEN_EX FORCE_INLINE_EX*/ T SH1::OnChipRegRead(uint32 address) {
+    // Peeks compute the timer counters on the fly instead
+    if constexpr (!peek) {
+        if (IsITURegister(address)) {
+            AdvanceITU();
+        }
+    }
+
     if constexpr (std::is_same_v<T, uint32>) {
         return OnChipRegReadLong<peek>(address);
     } else if constexpr (std::is_same_v<T, uint16>) {
@@ -738,8 +768,8 @@ FORCE_INLINE_EX uint8 SH1::OnChipRegReadByte(uint32 address) {
     case 0x105: return ITU.timers[0].ReadTIOR();
     case 0x106: return ITU.timers[0].ReadTIER();
     case 0x107: return ITU.timers[0].ReadTSR<peek>();
-    case 0x108: return ITU.timers[0].ReadTCNT() >> 8u;
-    case 0x109: return ITU.timers[0].ReadTCNT();
+    case 0x108: return ITU.timers[0].ReadTCNT<peek>(m_sliceStartCycles) >> 8u;
+    case 0x109: return ITU.timers[0].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x10A: return ITU.timers[0].ReadGRA() >> 8u;
     case 0x10B: return ITU.timers[0].ReadGRA();
     case 0x10C: return ITU.timers[0].ReadGRB() >> 8u;
@@ -748,8 +778,8 @@ FORCE_INLINE_EX uint8 SH1::OnChipRegReadByte(uint32 address) {
     case 0x10F: return ITU.timers[1].ReadTIOR();
     case 0x110: return ITU.timers[1].ReadTIER();
     case 0x111: return ITU.timers[1].ReadTSR<peek>();
-    case 0x112: return ITU.timers[1].ReadTCNT() >> 8u;
-    case 0x113: return ITU.timers[1].ReadTCNT();
+    case 0x112: return ITU.timers[1].ReadTCNT<peek>(m_sliceStartCycles) >> 8u;
+    case 0x113: return ITU.timers[1].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x114: return ITU.timers[1].ReadGRA() >> 8u;
     case 0x115: return ITU.timers[1].ReadGRA();
     case 0x116: return ITU.timers[1].ReadGRB() >> 8u;
@@ -758,8 +788,8 @@ FORCE_INLINE_EX uint8 SH1::OnChipRegReadByte(uint32 address) {
     case 0x119: return ITU.timers[2].ReadTIOR();
     case 0x11A: return ITU.timers[2].ReadTIER();
     case 0x11B: return ITU.timers[2].ReadTSR<peek>();
-    case 0x11C: return ITU.timers[2].ReadTCNT() >> 8u;
-    case 0x11D: return ITU.timers[2].ReadTCNT();
+    case 0x11C: return ITU.timers[2].ReadTCNT<peek>(m_sliceStartCycles) >> 8u;
+    case 0x11D: return ITU.timers[2].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x11E: return ITU.timers[2].ReadGRA() >> 8u;
     case 0x11F: return ITU.timers[2].ReadGRA();
     case 0x120: return ITU.timers[2].ReadGRB() >> 8u;
@@ -768,8 +798,8 @@ FORCE_INLINE_EX uint8 SH1::OnChipRegReadByte(uint32 address) {
     case 0x123: return ITU.timers[3].ReadTIOR();
     case 0x124: return ITU.timers[3].ReadTIER();
     case 0x125: return ITU.timers[3].ReadTSR<peek>();
-    case 0x126: return ITU.timers[3].ReadTCNT() >> 8u;
-    case 0x127: return ITU.timers[3].ReadTCNT();
+    case 0x126: return ITU.timers[3].ReadTCNT<peek>(m_sliceStartCycles) >> 8u;
+    case 0x127: return ITU.timers[3].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x128: return ITU.timers[3].ReadGRA() >> 8u;
     case 0x129: return ITU.timers[3].ReadGRA();
     case 0x12A: return ITU.timers[3].ReadGRB() >> 8u;
@@ -783,8 +813,8 @@ FORCE_INLINE_EX uint8 SH1::OnChipRegReadByte(uint32 address) {
     case 0x133: return ITU.timers[4].ReadTIOR();
     case 0x134: return ITU.timers[4].ReadTIER();
     case 0x135: return ITU.timers[4].ReadTSR<peek>();
-    case 0x136: return ITU.timers[4].ReadTCNT() >> 8u;
-    case 0x137: return ITU.timers[4].ReadTCNT();
+    case 0x136: return ITU.timers[4].ReadTCNT<peek>(m_sliceStartCycles) >> 8u;
+    case 0x137: return ITU.timers[4].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x138: return ITU.timers[4].ReadGRA() >> 8u;
     case 0x139: return ITU.timers[4].ReadGRA();
     case 0x13A: return ITU.timers[4].ReadGRB() >> 8u;
@@ -1087,22 +1117,22 @@ FORCE_INLINE_EX uint16 SH1::OnChipRegReadWord(uint32 address) {
     case 0x102: return 0; // ITU TMDR and TFCR only accept 8-bit reads
     case 0x104: return 0; // ITU TCR0 and TIOR0 only accept 8-bit reads
     case 0x106: return 0; // ITU TIER0 and TSR0 only accept 8-bit reads
-    case 0x108: return ITU.timers[0].ReadTCNT();
+    case 0x108: return ITU.timers[0].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x10A: return ITU.timers[0].ReadGRA();
     case 0x10C: return ITU.timers[0].ReadGRB();
     case 0x10E: return 0; // ITU TCR1 and TIOR1 only accept 8-bit reads
     case 0x110: return 0; // ITU TIER1 and TSR1 only accept 8-bit reads
-    case 0x112: return ITU.timers[1].ReadTCNT();
+    case 0x112: return ITU.timers[1].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x114: return ITU.timers[1].ReadGRA();
     case 0x116: return ITU.timers[1].ReadGRB();
     case 0x118: return 0; // ITU TCR2 and TIOR2 only accept 8-bit reads
     case 0x11A: return 0; // ITU TIER2 and TSR2 only accept 8-bit reads
-    case 0x11C: return ITU.timers[2].ReadTCNT();
+    case 0x11C: return ITU.timers[2].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x11E: return ITU.timers[2].ReadGRA();
     case 0x120: return ITU.timers[2].ReadGRB();
     case 0x122: return 0; // ITU TCR3 and TIOR3 only accept 8-bit reads
     case 0x124: return 0; // ITU TIER3 and TSR3 only accept 8-bit reads
-    case 0x126: return ITU.timers[3].ReadTCNT();
+    case 0x126: return ITU.timers[3].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x128: return ITU.timers[3].ReadGRA();
     case 0x12A: return ITU.timers[3].ReadGRB();
     case 0x12C: return ITU.timers[3].ReadBRA();
@@ -1110,7 +1140,7 @@ FORCE_INLINE_EX uint16 SH1::OnChipRegReadWord(uint32 address) {
     case 0x130: return 0; // ITU TOCR only accepts 8-bit reads
     case 0x132: return 0; // ITU TCR4 and TIOR4 only accept 8-bit reads
     case 0x134: return 0; // ITU TIER4 and TSR4 only accept 8-bit reads
-    case 0x136: return ITU.timers[4].ReadTCNT();
+    case 0x136: return ITU.timers[4].ReadTCNT<peek>(m_sliceStartCycles);
     case 0x138: return ITU.timers[4].ReadGRA();
     case 0x13A: return ITU.timers[4].ReadGRB();
     case 0x13C: return ITU.timers[4].ReadBRA();
@@ -1319,6 +1349,13 @@ FORCE_INLINE_EX uint32 SH1::OnChipRegReadLong(uint32 address) {
 
 template <mem_primitive T, bool poke>
 /*FLATTEN_EX FORCE_INLINE_EX*/ void SH1::OnChipRegWrite(uint32 address, T value) {
+    const bool itu = IsITURegister(address);
+    if constexpr (!poke) {
+        if (itu) {
+            AdvanceITU();
+        }
+    }
+
     if constexpr (std::is_same_v<T, uint32>) {
         OnChipRegWriteLong<poke>(address, value);
     } else if constexpr (std::is_same_v<T, uint16>) {
@@ -1326,6 +1363,11 @@ template <mem_primitive T, bool poke>
     } else if constexpr (std::is_same_v<T, uint8>) {
         OnChipRegWriteByte<poke>(address, value);
     }
+
+    // Pokes skip the sync but still need the deadline to reflect the new register values
+    if (itu) {
+        UpdateNextITUEvent();
+    }
 }
 
 template <bool poke>
@@ -2108,7 +2150,7 @@ FORCE_INLINE_EX void SH1::OnChipRegWriteLong(uint32 address, uint32 value) {
     }
 }
 
-FORCE_INLINE bool SH1::StepDMAC(uint32 channel) {
+FORCE_INLINE uint32 SH1::StepDMAC(uint32 channel, uint32 maxUnits) {
     assert(channel < DMAC.channels.size());
     auto &ch = DMAC.channels[channel];
 
@@ -2116,36 +2158,38 @@ FORCE_INLINE bool SH1::StepDMAC(uint32 channel) {
     // TODO: proper timings, cycle-stealing, etc. (suspend instructions if not cached)
 
     if (!IsDMATransferActive(ch)) {
-        return false;
+        return 0;
     }
 
+    bool dreq = false;
     switch (ch.xferResSelect) {
     case DMAResourceSelect::nDREQDual: [[fallthrough]];
     case DMAResourceSelect::nDREQSingleDACKDst: [[fallthrough]];
     case DMAResourceSelect::nDREQSingleDACKSrc:
         if (channel >= 2) {
             // No DREQ# signals for these channels
-            return false;
+            return 0;
         }
         if (m_nDREQ[channel]) {
             // DREQ# not asserted
             devlog::trace<grp::dma>("DMAC{} DREQ# not asserted", channel);
-            return false;
+            return 0;
         }
+        dreq = true;
         break;
-    case DMAResourceSelect::SCI0_RXI0: /*TODO*/ return false;
-    case DMAResourceSelect::SCI0_TXI0: /*TODO*/ return false;
-    case DMAResourceSelect::SCI1_RXI1: /*TODO*/ return false;
-    case DMAResourceSelect::SCI1_TXI1: /*TODO*/ return false;
-    case DMAResourceSelect::ITU0_IMIA0: /*TODO*/ return false;
-    case DMAResourceSelect::ITU1_IMIA1: /*TODO*/ return false;
-    case DMAResourceSelect::ITU2_IMIA2: /*TODO*/ return false;
-    case DMAResourceSelect::ITU3_IMIA3: /*TODO*/ return false;
+    case DMAResourceSelect::SCI0_RXI0: /*TODO*/ return 0;
+    case DMAResourceSelect::SCI0_TXI0: /*TODO*/ return 0;
+    case DMAResourceSelect::SCI1_RXI1: /*TODO*/ return 0;
+    case DMAResourceSelect::SCI1_TXI1: /*TODO*/ return 0;
+    case DMAResourceSelect::ITU0_IMIA0: /*TODO*/ return 0;
+    case DMAResourceSelect::ITU1_IMIA1: /*TODO*/ return 0;
+    case DMAResourceSelect::ITU2_IMIA2: /*TODO*/ return 0;
+    case DMAResourceSelect::ITU3_IMIA3: /*TODO*/ return 0;
     case DMAResourceSelect::AutoRequest: break;
-    case DMAResourceSelect::AD_ADI: /*TODO*/ return false;
+    case DMAResourceSelect::AD_ADI: /*TODO*/ return 0;
     case DMAResourceSelect::Reserved1: [[fallthrough]];
     case DMAResourceSelect::ReservedE: [[fallthrough]];
-    case DMAResourceSelect::ReservedF: return false;
+    case DMAResourceSelect::ReservedF: return 0;
     }
 
     static constexpr uint32 kXferSize[] = {1, 2};
@@ -2164,6 +2208,13 @@ FORCE_INLINE bool SH1::StepDMAC(uint32 channel) {
     const sint32 srcInc = getAddressInc(ch.srcMode);
     const sint32 dstInc = getAddressInc(ch.dstMode);
 
+    // DREQ1# is driven by the YGR FIFO, so word transfers between it and memory can be moved in bursts
+    if (channel == 1 && dreq && maxUnits > 1 && ch.xferSize == DMATransferSize::Word) {
+        if (const uint32 units = BurstDMAC(channel, maxUnits, srcInc, dstInc); units > 0) {
+            return units;
+        }
+    }
+
     // Perform one unit of transfer
     switch (ch.xferSize) {
     case DMATransferSize::Byte: //
@@ -2190,20 +2241,94 @@ FORCE_INLINE bool SH1::StepDMAC(uint32 channel) {
     --ch.xferCount;
 
     if (ch.xferCount == 0) {
-        ch.xferEnded = true;
-        devlog::trace<grp::dma>("DMAC{} transfer finished", channel);
-        if (ch.irqEnable) {
-            devlog::trace<grp::dma>("DMAC{} DEI{} raised", channel, channel);
-            switch (channel) {
-            case 0: RaiseInterrupt(InterruptSource::DMAC0_DEI0); break;
-            case 1: RaiseInterrupt(InterruptSource::DMAC1_DEI1); break;
-            case 2: RaiseInterrupt(InterruptSource::DMAC2_DEI2); break;
-            case 3: RaiseInterrupt(InterruptSource::DMAC3_DEI3); break;
-            }
+        EndDMATransfer(channel);
+    }
+    return 1;
+}
+
+uint32 SH1::BurstDMAC(uint32 channel, uint32 maxUnits, sint32 srcInc, sint32 dstInc) {
+    // Moves a run of words between a data port at a fixed address (such as the YGR FIFO) and external memory.
+    // The port ends the burst right after the transfer that withdraws the DMA request, so the addresses, transfer
+    // count, port state and DREQ# line end up exactly as if the units had been transferred one at a time.
+    static constexpr uint32 kMaxBurst = 64;
+
+    auto &ch = DMAC.channels[channel];
+
+    auto isExternal = [](uint32 address) {
+        const uint32 partition = (address >> 24u) & 0xF;
+        return partition != 0x0 && partition != 0x5 && partition != 0x8 && partition != 0xF;
+    };
+
+    const uint32 srcAddress = ch.srcAddress & 0xFFFFFFF;
+    const uint32 dstAddress = ch.dstAddress & 0xFFFFFFF;
+    if (!isExternal(ch.srcAddress) || !isExternal(ch.dstAddress)) {
+        return 0;
+    }
+
+    // A transfer count of zero means 65536 units
+    const uint32 remaining = ch.xferCount == 0 ? 0x10000 : ch.xferCount;
+    const uint32 count = std::min({maxUnits, remaining, kMaxBurst});
+    const sint32 span = static_cast<sint32>(count - 1);
+
+    std::array<uint16, kMaxBurst> buffer;
+    uint32 units;
+    if (srcInc == 0 && m_bus.HasBurstRead16(srcAddress)) {
+        // Port -> memory
+        if (!m_bus.IsMemory(dstAddress) || !m_bus.IsMemory(dstAddress + span * dstInc)) {
+            return 0;
+        }
+        units = m_bus.ReadBurst16(srcAddress, buffer.data(), count);
+        uint32 address = dstAddress;
+        for (uint32 i = 0; i < units; ++i) {
+            m_bus.Write<uint16>(address, buffer[i]);
+            address += dstInc;
+        }
+    } else if (dstInc == 0 && m_bus.HasBurstWrite16(dstAddress)) {
+        // Memory -> port
+        // Reading ahead is harmless since memory reads have no side-effects
+        if (!m_bus.IsMemory(srcAddress) || !m_bus.IsMemory(srcAddress + span * srcInc)) {
+            return 0;
+        }
+        uint32 address = srcAddress;
+        for (uint32 i = 0; i < count; ++i) {
+            buffer[i] = m_bus.Read<uint16>(address);
+            address += srcInc;
+        }
+        units = m_bus.WriteBurst16(dstAddress, buffer.data(), count);
+    } else {
+        return 0;
+    }
+
+    if (units == 0) {
+        return 0;
+    }
+
+    devlog::trace<grp::dma>("DMAC{} 16-bit burst of {} units from {:08X} to {:08X}", channel, units, ch.srcAddress,
+                            ch.dstAddress);
+
+    ch.srcAddress += srcInc * static_cast<sint32>(units);
+    ch.dstAddress += dstInc * static_cast<sint32>(units);
+    ch.xferCount -= units;
+
+    if (ch.xferCount == 0) {
+        EndDMATransfer(channel);
+    }
+    return units;
+}
+
+void SH1::EndDMATransfer(uint32 channel) {
+    auto &ch = DMAC.channels[channel];
+    ch.xferEnded = true;
+    devlog::trace<grp::dma>("DMAC{} transfer finished", channel);
+    if (ch.irqEnable) {
+        devlog::trace<grp::dma>("DMAC{} DEI{} raised", channel, channel);
+        switch (channel) {
+        case 0: RaiseInterrupt(InterruptSource::DMAC0_DEI0); break;
+        case 1: RaiseInterrupt(InterruptSource::DMAC1_DEI1); break;
+        case 2: RaiseInterrupt(InterruptSource::DMAC2_DEI2); break;
+        case 3: RaiseInterrupt(InterruptSource::DMAC3_DEI3); break;
         }
-        return false;
     }
-    return true;
 }
 
 FLATTEN FORCE_INLINE bool SH1::IsDMATransferActive(const DMAController::DMAChannel &ch) const {
@@ -112,206 +112,217 @@ namespace config {
 // -----------------------------------------------------------------------------
 // Debugger
 
-FORCE_INLINE static void TraceReset(debug::ISH2Tracer *tracer, uint32 pc, uint32 sp, bool watchdogInitiated) {
-    if (tracer) {
-        return tracer->Reset(pc, sp, watchdogInitiated);
+FORCE_INLINE void SH2::PushTraceRecord(const debug::SH2TraceRecord &record) {
+    m_traceRecords[m_traceRecordCount++] = record;
+    if (m_traceRecordCount == m_traceRecords.size()) [[unlikely]] {
+        FlushTraceRecords();
+    }
+}
+
+void SH2::FlushTraceRecords() {
+    if (m_traceRecordCount > 0) {
+        // Reset the count first in case the tracer detaches itself
+        const size_t count = m_traceRecordCount;
+        m_traceRecordCount = 0;
+        m_tracer->ProcessRecords(std::span{m_traceRecords.data(), count});
+    }
+}
+
+void SH2::TraceReset(uint32 pc, uint32 sp, bool watchdogInitiated) {
+    if (m_tracer) {
+        FlushTraceRecords();
+        m_tracer->Reset(pc, sp, watchdogInitiated);
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceExecuteInstruction(debug::ISH2Tracer *tracer, uint32 pc, uint16 opcode, bool delaySlot) {
+FORCE_INLINE void SH2::TraceExecuteInstruction(uint32 pc, uint16 opcode, bool delaySlot) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->ExecuteInstruction(pc, opcode, delaySlot);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::ExecuteInstruction(pc, opcode, delaySlot));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceDelaySlot(debug::ISH2Tracer *tracer, uint32 pc, uint32 target) {
+FORCE_INLINE void SH2::TraceDelaySlot(uint32 pc, uint32 target) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->DelaySlot(pc, target);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::DelaySlot(pc, target));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceBranch(debug::ISH2Tracer *tracer, uint32 pc, uint32 target) {
+FORCE_INLINE void SH2::TraceBranch(uint32 pc, uint32 target) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Branch(pc, target);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Branch(pc, target));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceBranchDelay(debug::ISH2Tracer *tracer, uint32 target) {
+FORCE_INLINE void SH2::TraceBranchDelay(uint32 target) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->BranchDelay(target);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::BranchDelay(target));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceCall(debug::ISH2Tracer *tracer, uint32 target) {
+FORCE_INLINE void SH2::TraceCall(uint32 target) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Call(target);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Call(target));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceReturn(debug::ISH2Tracer *tracer, uint32 target) {
+FORCE_INLINE void SH2::TraceReturn(uint32 target) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Return(target);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Return(target));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceReturnFromException(debug::ISH2Tracer *tracer, uint32 target, uint32 newSP) {
+FORCE_INLINE void SH2::TraceReturnFromException(uint32 target, uint32 newSP) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->ReturnFromException(target, newSP);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::ReturnFromException(target, newSP));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceInterrupt(debug::ISH2Tracer *tracer, uint8 vecNum, uint8 level,
-                                        sh2::InterruptSource source, uint32 pc) {
+FORCE_INLINE void SH2::TraceInterrupt(uint8 vecNum, uint8 level, InterruptSource source, uint32 pc) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Interrupt(vecNum, level, source, pc);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Interrupt(vecNum, level, source, pc));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceException(debug::ISH2Tracer *tracer, uint8 vecNum, uint32 oldPC, uint32 oldSR,
-                                        uint32 oldSP, uint32 newPC) {
+FORCE_INLINE void SH2::TraceException(uint8 vecNum, uint32 oldPC, uint32 oldSR, uint32 oldSP, uint32 newPC) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Exception(vecNum, oldPC, oldSR, oldSP, newPC);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Exception(vecNum, oldPC, oldSR, oldSP, newPC));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceTrap(debug::ISH2Tracer *tracer, uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
+FORCE_INLINE void SH2::TraceTrap(uint8 vecNum, uint32 oldPC, uint32 oldSP, uint32 newPC) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Trap(vecNum, oldPC, oldSP, newPC);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Trap(vecNum, oldPC, oldSP, newPC));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceChangeStack(debug::ISH2Tracer *tracer, uint8 reg, uint32 newSP) {
+FORCE_INLINE void SH2::TraceChangeStack(uint8 reg, uint32 newSP) {
     if constexpr (debug) {
-        if (tracer && reg == 15) {
-            return tracer->ChangeStack(newSP);
+        if (m_tracer && reg == 15) {
+            PushTraceRecord(debug::SH2TraceRecord::ChangeStack(newSP));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceResizeStack(debug::ISH2Tracer *tracer, uint8 reg, uint32 oldSP, uint32 newSP) {
+FORCE_INLINE void SH2::TraceResizeStack(uint8 reg, uint32 oldSP, uint32 newSP) {
     if constexpr (debug) {
-        if (tracer && reg == 15) {
-            return tracer->ResizeStack(oldSP, newSP);
+        if (m_tracer && reg == 15) {
+            PushTraceRecord(debug::SH2TraceRecord::ResizeStack(oldSP, newSP));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TracePushRegisterToStack(debug::ISH2Tracer *tracer, uint8 reg, uint8 rn, uint32 oldSP,
-                                                  uint32 newSP) {
+FORCE_INLINE void SH2::TracePushRegisterToStack(uint8 reg, uint8 rn, uint32 oldSP, uint32 newSP) {
     if constexpr (debug) {
-        if (tracer && reg == 15) {
-            return tracer->PushRegisterToStack(rn, oldSP, newSP);
+        if (m_tracer && reg == 15) {
+            PushTraceRecord(debug::SH2TraceRecord::PushRegisterToStack(rn, oldSP, newSP));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TracePushToStack(debug::ISH2Tracer *tracer, uint8 reg, debug::SH2StackValueType type,
-                                          uint32 newSP) {
+FORCE_INLINE void SH2::TracePushToStack(uint8 reg, debug::SH2StackValueType type, uint32 newSP) {
     if constexpr (debug) {
-        if (tracer && reg == 15) {
-            return tracer->PushToStack(type, newSP);
+        if (m_tracer && reg == 15) {
+            PushTraceRecord(debug::SH2TraceRecord::PushToStack(type, newSP));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TracePopFromStack(debug::ISH2Tracer *tracer, uint8 reg, uint32 newSP) {
+FORCE_INLINE void SH2::TracePopFromStack(uint8 reg, uint32 newSP) {
     if constexpr (debug) {
-        if (tracer && reg == 15) {
-            return tracer->PopFromStack(newSP);
+        if (m_tracer && reg == 15) {
+            PushTraceRecord(debug::SH2TraceRecord::PopFromStack(newSP));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceBegin32x32Division(debug::ISH2Tracer *tracer, sint32 dividend, sint32 divisor,
-                                                 bool overflowIntrEnable) {
+FORCE_INLINE void SH2::TraceBegin32x32Division(sint32 dividend, sint32 divisor, bool overflowIntrEnable) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Begin32x32Division(dividend, divisor, overflowIntrEnable);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Begin32x32Division(dividend, divisor, overflowIntrEnable));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceBegin64x32Division(debug::ISH2Tracer *tracer, sint64 dividend, sint32 divisor,
-                                                 bool overflowIntrEnable) {
+FORCE_INLINE void SH2::TraceBegin64x32Division(sint64 dividend, sint32 divisor, bool overflowIntrEnable) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->Begin64x32Division(dividend, divisor, overflowIntrEnable);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::Begin64x32Division(dividend, divisor, overflowIntrEnable));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceEndDivision(debug::ISH2Tracer *tracer, sint32 quotient, sint32 remainder, bool overflow) {
+FORCE_INLINE void SH2::TraceEndDivision(sint32 quotient, sint32 remainder, bool overflow) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->EndDivision(quotient, remainder, overflow);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::EndDivision(quotient, remainder, overflow));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceDMAXferBegin(debug::ISH2Tracer *tracer, uint32 channel, uint32 srcAddress,
-                                           uint32 dstAddress, uint32 count, uint32 unitSize, sint32 srcInc,
-                                           sint32 dstInc) {
+FORCE_INLINE void SH2::TraceDMAXferBegin(uint32 channel, uint32 srcAddress, uint32 dstAddress, uint32 count,
+                                         uint32 unitSize, sint32 srcInc, sint32 dstInc) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->DMAXferBegin(channel, srcAddress, dstAddress, count, unitSize, srcInc, dstInc);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::DMAXferBegin(channel, srcAddress, dstAddress, count, unitSize,
+                                                                srcInc, dstInc));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceDMAXferData(debug::ISH2Tracer *tracer, uint32 channel, uint32 srcAddress,
-                                          uint32 dstAddress, uint32 data, uint32 unitSize) {
+FORCE_INLINE void SH2::TraceDMAXferData(uint32 channel, uint32 srcAddress, uint32 dstAddress, uint32 data,
+                                        uint32 unitSize) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->DMAXferData(channel, srcAddress, dstAddress, data, unitSize);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::DMAXferData(channel, srcAddress, dstAddress, data, unitSize));
         }
     }
 }
 
 template <bool debug>
-FORCE_INLINE static void TraceDMAXferEnd(debug::ISH2Tracer *tracer, uint32 channel, bool irqRaised) {
+FORCE_INLINE void SH2::TraceDMAXferEnd(uint32 channel, bool irqRaised) {
     if constexpr (debug) {
-        if (tracer) {
-            return tracer->DMAXferEnd(channel, irqRaised);
+        if (m_tracer) {
+            PushTraceRecord(debug::SH2TraceRecord::DMAXferEnd(channel, irqRaised));
         }
     }
 }
@@ -392,7 +403,7 @@ void SH2::Reset(bool hard, bool watchdogInitiated) {
 
     m_cache.Reset();
 
-    TraceReset(m_tracer, PC, R[15], watchdogInitiated);
+    TraceReset(PC, R[15], watchdogInitiated);
 }
 
 void SH2::MapMemory(sys::SH2Bus &bus) {
@@ -495,6 +506,9 @@ FLATTEN uint64 SH2::Advance(uint64 cycles, uint64 spilloverCycles) {
         }
     }
     AdvanceDMA<debug, emulateCache>(m_cyclesExecuted - spilloverCycles);
+    if constexpr (debug) {
+        FlushTraceRecords();
+    }
     return m_cyclesExecuted;
 }
 
@@ -510,6 +524,9 @@ FLATTEN uint64 SH2::Step() {
     AdvanceFRT<false>();
     m_cyclesExecuted = InterpretNext<debug, emulateCache>();
     AdvanceDMA<debug, emulateCache>(m_cyclesExecuted);
+    if constexpr (debug) {
+        FlushTraceRecords();
+    }
     return m_cyclesExecuted;
 }
 
@@ -625,6 +642,7 @@ void SH2::PostLoadState(const savestate::SH2SaveState &state) {
     }
 
     if (m_tracer) {
+        FlushTraceRecords();
         m_tracer->Attached();
     }
 }
@@ -1837,7 +1855,7 @@ FORCE_INLINE bool SH2::StepDMAC(uint32 channel) {
     if constexpr (debug) {
         if (!m_dmacTraced[channel]) {
             m_dmacTraced[channel] = true;
-            TraceDMAXferBegin<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, ch.xferCount, xferSize, srcInc,
+            TraceDMAXferBegin<debug>(channel, ch.srcAddress, ch.dstAddress, ch.xferCount, xferSize, srcInc,
                                      dstInc);
         }
     }
@@ -1849,7 +1867,7 @@ FORCE_INLINE bool SH2::StepDMAC(uint32 channel) {
         devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 8-bit transfer from {:08X} to {:08X} -> {:X}", channel,
                                      ch.srcAddress, ch.dstAddress, value);
         MemWriteByte<debug, emulateCache>(ch.dstAddress, value);
-        TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
+        TraceDMAXferData<debug>(channel, ch.srcAddress, ch.dstAddress, value, xferSize);
         break;
     }
     case DMATransferSize::Word: {
@@ -1857,7 +1875,7 @@ FORCE_INLINE bool SH2::StepDMAC(uint32 channel) {
         devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 16-bit transfer from {:08X} to {:08X} -> {:X}", channel,
                                      ch.srcAddress, ch.dstAddress, value);
         MemWriteWord<debug, emulateCache>(ch.dstAddress, value);
-        TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
+        TraceDMAXferData<debug>(channel, ch.srcAddress, ch.dstAddress, value, xferSize);
         break;
     }
     case DMATransferSize::Longword: {
@@ -1865,7 +1883,7 @@ FORCE_INLINE bool SH2::StepDMAC(uint32 channel) {
         devlog::trace<grp::dma_xfer>(m_logPrefix, "DMAC{} 32-bit transfer from {:08X} to {:08X} -> {:X}", channel,
                                      ch.srcAddress, ch.dstAddress, value);
         MemWriteLong<debug, emulateCache>(ch.dstAddress, value);
-        TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, xferSize);
+        TraceDMAXferData<debug>(channel, ch.srcAddress, ch.dstAddress, value, xferSize);
         break;
     }
     case DMATransferSize::QuadLongword: {
@@ -1879,7 +1897,7 @@ FORCE_INLINE bool SH2::StepDMAC(uint32 channel) {
         for (int i = 0; i < 4; i++) {
             const uint32 value = line[i];
             MemWriteLong<debug, emulateCache>(ch.dstAddress + i * sizeof(uint32), value);
-            TraceDMAXferData<debug>(m_tracer, channel, ch.srcAddress, ch.dstAddress, value, 4);
+            TraceDMAXferData<debug>(channel, ch.srcAddress, ch.dstAddress, value, 4);
         }
         break;
     }
@@ -1901,7 +1919,7 @@ FORCE_INLINE bool SH2::StepDMAC(uint32 channel) {
     }
 
     if (ch.xferCount == 0) {
-        TraceDMAXferEnd<debug>(m_tracer, channel, ch.irqEnable);
+        TraceDMAXferEnd<debug>(channel, ch.irqEnable);
         if constexpr (debug) {
             m_dmacTraced[channel] = false;
         }
@@ -1949,9 +1967,9 @@ template <bool debug>
 FORCE_INLINE void SH2::ExecuteDiv32() {
     DIVU.DVDNTL = DIVU.DVDNT;
     DIVU.DVDNTH = static_cast<sint32>(DIVU.DVDNT) >> 31;
-    TraceBegin32x32Division<debug>(m_tracer, DIVU.DVDNTL, DIVU.DVSR, DIVU.DVCR.OVFIE);
+    TraceBegin32x32Division<debug>(DIVU.DVDNTL, DIVU.DVSR, DIVU.DVCR.OVFIE);
     DIVU.Calc32();
-    TraceEndDivision<debug>(m_tracer, DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
+    TraceEndDivision<debug>(DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
     if (DIVU.DVCR.OVF && DIVU.DVCR.OVFIE) {
         RaiseInterrupt(InterruptSource::DIVU_OVFI);
     }
@@ -1959,11 +1977,10 @@ FORCE_INLINE void SH2::ExecuteDiv32() {
 
 template <bool debug>
 FORCE_INLINE void SH2::ExecuteDiv64() {
-    TraceBegin64x32Division<debug>(m_tracer,
-                                   (static_cast<sint64>(DIVU.DVDNTH) << 32ll) | static_cast<sint64>(DIVU.DVDNTL),
+    TraceBegin64x32Division<debug>((static_cast<sint64>(DIVU.DVDNTH) << 32ll) | static_cast<sint64>(DIVU.DVDNTL),
                                    DIVU.DVSR, DIVU.DVCR.OVFIE);
     DIVU.Calc64();
-    TraceEndDivision<debug>(m_tracer, DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
+    TraceEndDivision<debug>(DIVU.DVDNTL, DIVU.DVDNTH, DIVU.DVCR.OVF);
     if (DIVU.DVCR.OVF && DIVU.DVCR.OVFIE) {
         RaiseInterrupt(InterruptSource::DIVU_OVFI);
     }
@@ -2158,7 +2175,7 @@ FORCE_INLINE void SH2::SetupDelaySlot(uint32 targetAddress) {
 template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE void SH2::AdvancePC() {
     if constexpr (delaySlot) {
-        TraceDelaySlot<debug>(m_tracer, PC, m_delaySlotTarget);
+        TraceDelaySlot<debug>(PC, m_delaySlotTarget);
         PC = m_delaySlotTarget;
         if (PC & 2) {
             RefillPipeline<emulateCache>();
@@ -2181,7 +2198,7 @@ FORCE_INLINE uint64 SH2::EnterException(uint8 vectorNumber) {
     MemWriteLong<debug, emulateCache>(address1, SR.u32);
     MemWriteLong<debug, emulateCache>(address2, PC);
     const uint32 target = MemReadLong<emulateCache>(address3);
-    TraceException<debug>(m_tracer, vectorNumber, PC, SR.u32, R[15], target);
+    TraceException<debug>(vectorNumber, PC, SR.u32, R[15], target);
     PC = target;
     if (PC & 2) {
         RefillPipeline<emulateCache>();
@@ -2199,7 +2216,7 @@ FORCE_INLINE uint64 SH2::InterpretNext() {
     if (std::bit_cast<uint16>(m_intrFlags) == kIntrFlagsPendingAllowed) [[unlikely]] {
         // Service interrupt
         const uint8 vecNum = INTC.GetVector(INTC.pending.source);
-        TraceInterrupt<debug>(m_tracer, vecNum, INTC.pending.level, INTC.pending.source, PC);
+        TraceInterrupt<debug>(vecNum, INTC.pending.level, INTC.pending.source, PC);
         devlog::trace<grp::intr>(m_logPrefix, "[PC = {:08X}] Handling interrupt level {:02X}, vector number {:02X}", PC,
                                  INTC.pending.level, vecNum);
         const uint64 cycles = EnterException<debug, emulateCache>(vecNum);
@@ -2228,7 +2245,7 @@ FORCE_INLINE uint64 SH2::InterpretNext() {
 
     const uint32 pc = PC;
     const uint16 instr = FetchInstruction<emulateCache>(pc);
-    TraceExecuteInstruction<debug>(m_tracer, pc, instr, m_delaySlot);
+    TraceExecuteInstruction<debug>(pc, instr, m_delaySlot);
 
     const OpcodeType opcode = DecodeTable::s_instance.opcodes[m_delaySlot][instr];
 
@@ -2643,7 +2660,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::MOV(uint16 opcode) {
     DECODE_NM
     R[rn] = R[rm];
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -2657,7 +2674,7 @@ FORCE_INLINE uint64 SH2::MOVBL(uint16 opcode) {
     const uint32 address = R[rm];
     const uint64 cycles = AccessCycles<uint8, false, emulateCache>(address) + WritebackCycles(rm);
     R[rn] = bit::sign_extend<8>(MemReadByte<emulateCache>(address));
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = rn;
     return cycles;
@@ -2671,7 +2688,7 @@ FORCE_INLINE uint64 SH2::MOVWL(uint16 opcode) {
     uint64 cycles = AccessCycles<uint16, false, emulateCache>(address);
     if (!m_bus.IsBusWait(address, sizeof(uint16), false)) [[likely]] {
         R[rn] = bit::sign_extend<16>(MemReadWord<emulateCache>(address));
-        TraceChangeStack<debug>(m_tracer, rn, R[15]);
+        TraceChangeStack<debug>(rn, R[15]);
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm);
         m_wbReg = rn;
@@ -2687,7 +2704,7 @@ FORCE_INLINE uint64 SH2::MOVLL(uint16 opcode) {
     uint64 cycles = AccessCycles<uint32, false, emulateCache>(address);
     if (!m_bus.IsBusWait(address, sizeof(uint32), false)) [[likely]] {
         R[rn] = MemReadLong<emulateCache>(address);
-        TraceChangeStack<debug>(m_tracer, rn, R[15]);
+        TraceChangeStack<debug>(rn, R[15]);
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm);
         m_wbReg = rn;
@@ -2702,7 +2719,7 @@ FORCE_INLINE uint64 SH2::MOVBL0(uint16 opcode) {
     const uint32 address = R[rm] + R[0];
     const uint64 cycles = AccessCycles<uint8, false, emulateCache>(address) + WritebackCycles(rm, 0);
     R[rn] = bit::sign_extend<8>(MemReadByte<emulateCache>(address));
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = rn;
     return cycles;
@@ -2716,7 +2733,7 @@ FORCE_INLINE uint64 SH2::MOVWL0(uint16 opcode) {
     uint64 cycles = AccessCycles<uint16, false, emulateCache>(address);
     if (!m_bus.IsBusWait(address, sizeof(uint16), false)) [[likely]] {
         R[rn] = bit::sign_extend<16>(MemReadWord<emulateCache>(address));
-        TraceChangeStack<debug>(m_tracer, rn, R[15]);
+        TraceChangeStack<debug>(rn, R[15]);
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm, 0);
         m_wbReg = rn;
@@ -2732,7 +2749,7 @@ FORCE_INLINE uint64 SH2::MOVLL0(uint16 opcode) {
     uint64 cycles = AccessCycles<uint32, false, emulateCache>(address);
     if (!m_bus.IsBusWait(address, sizeof(uint32), false)) [[likely]] {
         R[rn] = MemReadLong<emulateCache>(address);
-        TraceChangeStack<debug>(m_tracer, rn, R[15]);
+        TraceChangeStack<debug>(rn, R[15]);
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm, 0);
         m_wbReg = rn;
@@ -2775,7 +2792,7 @@ FORCE_INLINE uint64 SH2::MOVLL4(uint16 opcode) {
     uint64 cycles = AccessCycles<uint32, false, emulateCache>(address);
     if (!m_bus.IsBusWait(address, sizeof(uint32), false)) [[likely]] {
         R[rn] = MemReadLong<emulateCache>(address);
-        TraceChangeStack<debug>(m_tracer, rn, R[15]);
+        TraceChangeStack<debug>(rn, R[15]);
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm);
         m_wbReg = rn;
@@ -2830,7 +2847,7 @@ FORCE_INLINE uint64 SH2::MOVBM(uint16 opcode) {
     const uint32 address = R[rn] - 1;
     const uint64 cycles = AccessCycles<uint8, true, emulateCache>(address) + WritebackCycles(rm, rn);
     MemWriteByte<debug, emulateCache>(address, R[rm]);
-    TracePushRegisterToStack<debug>(m_tracer, rn, rm, R[15], address);
+    TracePushRegisterToStack<debug>(rn, rm, R[15], address);
     R[rn] = address;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = kWBRegNone;
@@ -2845,7 +2862,7 @@ FORCE_INLINE uint64 SH2::MOVWM(uint16 opcode) {
     uint64 cycles = AccessCycles<uint16, true, emulateCache>(address);
     if (!m_bus.IsBusWait(address, sizeof(uint16), true)) [[likely]] {
         MemWriteWord<debug, emulateCache>(address, R[rm]);
-        TracePushRegisterToStack<debug>(m_tracer, rn, rm, R[15], address);
+        TracePushRegisterToStack<debug>(rn, rm, R[15], address);
         R[rn] = address;
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm, rn);
@@ -2862,7 +2879,7 @@ FORCE_INLINE uint64 SH2::MOVLM(uint16 opcode) {
     uint64 cycles = AccessCycles<uint32, true, emulateCache>(address);
     if (!m_bus.IsBusWait(address, sizeof(uint32), true)) [[likely]] {
         MemWriteLong<debug, emulateCache>(address, R[rm]);
-        TracePushRegisterToStack<debug>(m_tracer, rn, rm, R[15], address);
+        TracePushRegisterToStack<debug>(rn, rm, R[15], address);
         R[rn] = address;
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm, rn);
@@ -2881,8 +2898,8 @@ FORCE_INLINE uint64 SH2::MOVBP(uint16 opcode) {
     if (rn != rm) {
         R[rm] += 1;
     }
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = rn;
     return cycles;
@@ -2899,8 +2916,8 @@ FORCE_INLINE uint64 SH2::MOVWP(uint16 opcode) {
         if (rn != rm) {
             R[rm] += 2;
         }
-        TracePopFromStack<debug>(m_tracer, rm, R[15]);
-        TraceChangeStack<debug>(m_tracer, rn, R[15]);
+        TracePopFromStack<debug>(rm, R[15]);
+        TraceChangeStack<debug>(rn, R[15]);
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm);
         m_wbReg = rn;
@@ -2919,8 +2936,8 @@ FORCE_INLINE uint64 SH2::MOVLP(uint16 opcode) {
         if (rn != rm) {
             R[rm] += 4;
         }
-        TracePopFromStack<debug>(m_tracer, rm, R[15]);
-        TraceChangeStack<debug>(m_tracer, rn, R[15]);
+        TracePopFromStack<debug>(rm, R[15]);
+        TraceChangeStack<debug>(rn, R[15]);
         AdvancePC<debug, emulateCache, delaySlot>();
         cycles += WritebackCycles(rm);
         m_wbReg = rn;
@@ -3101,7 +3118,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::MOVI(uint16 opcode) {
     DECODE_NI
     R[rn] = imm;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3116,7 +3133,7 @@ FORCE_INLINE uint64 SH2::MOVWI(uint16 opcode) {
     const uint32 address = pc + disp + 4u;
     const uint64 cycles = AccessCycles<uint16, false, emulateCache>(address);
     R[rn] = bit::sign_extend<16>(MemReadWord<emulateCache, true>(address));
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = rn;
     return cycles;
@@ -3130,7 +3147,7 @@ FORCE_INLINE uint64 SH2::MOVLI(uint16 opcode) {
     const uint32 address = (pc & ~3u) + disp + 4u;
     const uint64 cycles = AccessCycles<uint32, false, emulateCache>(address);
     R[rn] = MemReadLong<emulateCache, true>(address);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = rn;
     return cycles;
@@ -3154,7 +3171,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::MOVT(uint16 opcode) {
     DECODE_N
     R[rn] = SR.T;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3184,7 +3201,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::EXTSB(uint16 opcode) {
     DECODE_NM
     R[rn] = bit::sign_extend<8>(R[rm]);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3196,7 +3213,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::EXTSW(uint16 opcode) {
     DECODE_NM
     R[rn] = bit::sign_extend<16>(R[rm]);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3208,7 +3225,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::EXTUB(uint16 opcode) {
     DECODE_NM
     R[rn] = R[rm] & 0xFF;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3220,7 +3237,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::EXTUW(uint16 opcode) {
     DECODE_NM
     R[rn] = R[rm] & 0xFFFF;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3234,7 +3251,7 @@ FORCE_INLINE uint64 SH2::SWAPB(uint16 opcode) {
     const uint32 tmp0 = R[rm] & 0xFFFF0000;
     const uint32 tmp1 = (R[rm] & 0xFF) << 8u;
     R[rn] = ((R[rm] >> 8u) & 0xFF) | tmp1 | tmp0;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3247,7 +3264,7 @@ FORCE_INLINE uint64 SH2::SWAPW(uint16 opcode) {
     DECODE_NM
     const uint32 tmp = R[rm] >> 16u;
     R[rn] = (R[rm] << 16u) | tmp;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3259,7 +3276,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::XTRCT(uint16 opcode) {
     DECODE_NM
     R[rn] = (R[rn] >> 16u) | (R[rm] << 16u);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3346,7 +3363,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STCGBR(uint16 opcode) {
     DECODE_N
     R[rn] = GBR;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
@@ -3359,7 +3376,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STCSR(uint16 opcode) {
     DECODE_N
     R[rn] = SR.u32;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
@@ -3372,7 +3389,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STCVBR(uint16 opcode) {
     DECODE_N
     R[rn] = VBR;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
@@ -3385,7 +3402,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STSMACH(uint16 opcode) {
     DECODE_N
     R[rn] = MAC.H;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = rn;
@@ -3397,7 +3414,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STSMACL(uint16 opcode) {
     DECODE_N
     R[rn] = MAC.L;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = rn;
@@ -3409,7 +3426,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STSPR(uint16 opcode) {
     DECODE_N
     R[rn] = PR;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn, kWBRegPR) + 1;
@@ -3425,7 +3442,7 @@ FORCE_INLINE uint64 SH2::LDCMGBR(uint16 opcode) {
     const uint64 cycles = AccessCycles<uint32, false, emulateCache>(address) + WritebackCycles(rm) + 2;
     GBR = MemReadLong<emulateCache>(address);
     R[rm] += 4;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = kWBRegNone;
@@ -3444,7 +3461,7 @@ FORCE_INLINE uint64 SH2::LDCMSR(uint16 opcode) {
         .allow = false,
     }));
     R[rm] += 4;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = kWBRegNone;
     return cycles;
@@ -3458,7 +3475,7 @@ FORCE_INLINE uint64 SH2::LDCMVBR(uint16 opcode) {
     const uint64 cycles = AccessCycles<uint32, false, emulateCache>(address) + WritebackCycles(rm) + 2;
     VBR = MemReadLong<emulateCache>(address);
     R[rm] += 4;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = kWBRegNone;
@@ -3473,7 +3490,7 @@ FORCE_INLINE uint64 SH2::LDSMMACH(uint16 opcode) {
     const uint64 cycles = AccessCycles<uint32, false, emulateCache>(address) + WritebackCycles(rm);
     MAC.H = MemReadLong<emulateCache>(address);
     R[rm] += 4;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = kWBRegNone;
@@ -3488,7 +3505,7 @@ FORCE_INLINE uint64 SH2::LDSMMACL(uint16 opcode) {
     const uint64 cycles = AccessCycles<uint32, false, emulateCache>(address) + WritebackCycles(rm);
     MAC.L = MemReadLong<emulateCache>(address);
     R[rm] += 4;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = kWBRegNone;
@@ -3503,7 +3520,7 @@ FORCE_INLINE uint64 SH2::LDSMPR(uint16 opcode) {
     const uint64 cycles = AccessCycles<uint32, false, emulateCache>(address) + WritebackCycles(rm);
     PR = MemReadLong<emulateCache>(address);
     R[rm] += 4;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
     m_intrFlags.allow = false;
     AdvancePC<debug, emulateCache, delaySlot>();
     m_wbReg = kWBRegPR;
@@ -3515,7 +3532,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STCMGBR(uint16 opcode) {
     DECODE_N
     R[rn] -= 4;
-    TracePushToStack<debug>(m_tracer, rn, debug::SH2StackValueType::GBR, R[15]);
+    TracePushToStack<debug>(rn, debug::SH2StackValueType::GBR, R[15]);
     const uint32 address = R[rn];
     const uint64 cycles = AccessCycles<uint32, true, emulateCache>(address) + WritebackCycles(rn) + 2;
     MemWriteLong<debug, emulateCache>(address, GBR);
@@ -3530,7 +3547,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STCMSR(uint16 opcode) {
     DECODE_N
     R[rn] -= 4;
-    TracePushToStack<debug>(m_tracer, rn, debug::SH2StackValueType::SR, R[15]);
+    TracePushToStack<debug>(rn, debug::SH2StackValueType::SR, R[15]);
     const uint32 address = R[rn];
     const uint64 cycles = AccessCycles<uint32, true, emulateCache>(address) + WritebackCycles(rn) + 2;
     MemWriteLong<debug, emulateCache>(address, SR.u32);
@@ -3545,7 +3562,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STCMVBR(uint16 opcode) {
     DECODE_N
     R[rn] -= 4;
-    TracePushToStack<debug>(m_tracer, rn, debug::SH2StackValueType::VBR, R[15]);
+    TracePushToStack<debug>(rn, debug::SH2StackValueType::VBR, R[15]);
     const uint32 address = R[rn];
     const uint64 cycles = AccessCycles<uint32, true, emulateCache>(address) + WritebackCycles(rn) + 2;
     MemWriteLong<debug, emulateCache>(address, VBR);
@@ -3560,7 +3577,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STSMMACH(uint16 opcode) {
     DECODE_N
     R[rn] -= 4;
-    TracePushToStack<debug>(m_tracer, rn, debug::SH2StackValueType::MACH, R[15]);
+    TracePushToStack<debug>(rn, debug::SH2StackValueType::MACH, R[15]);
     const uint32 address = R[rn];
     const uint64 cycles = AccessCycles<uint32, true, emulateCache>(address) + WritebackCycles(rn);
     MemWriteLong<debug, emulateCache>(address, MAC.H);
@@ -3575,7 +3592,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STSMMACL(uint16 opcode) {
     DECODE_N
     R[rn] -= 4;
-    TracePushToStack<debug>(m_tracer, rn, debug::SH2StackValueType::MACL, R[15]);
+    TracePushToStack<debug>(rn, debug::SH2StackValueType::MACL, R[15]);
     const uint32 address = R[rn];
     const uint64 cycles = AccessCycles<uint32, true, emulateCache>(address) + WritebackCycles(rn);
     MemWriteLong<debug, emulateCache>(address, MAC.L);
@@ -3590,7 +3607,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::STSMPR(uint16 opcode) {
     DECODE_N
     R[rn] -= 4;
-    TracePushToStack<debug>(m_tracer, rn, debug::SH2StackValueType::PR, R[15]);
+    TracePushToStack<debug>(rn, debug::SH2StackValueType::PR, R[15]);
     const uint32 address = R[rn];
     const uint64 cycles = AccessCycles<uint32, true, emulateCache>(address) + WritebackCycles(rn, kWBRegPR);
     MemWriteLong<debug, emulateCache>(address, PR);
@@ -3605,7 +3622,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::ADD(uint16 opcode) {
     DECODE_NM
     const uint32 newValue = R[rn] + R[rm];
-    TraceResizeStack<debug>(m_tracer, rn, R[15], newValue);
+    TraceResizeStack<debug>(rn, R[15], newValue);
     R[rn] = newValue;
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
@@ -3618,7 +3635,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::ADDI(uint16 opcode) {
     DECODE_NI
     const uint32 newValue = R[rn] + imm;
-    TraceResizeStack<debug>(m_tracer, rn, R[15], newValue);
+    TraceResizeStack<debug>(rn, R[15], newValue);
     R[rn] = newValue;
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
@@ -3633,7 +3650,7 @@ FORCE_INLINE uint64 SH2::ADDC(uint16 opcode) {
     const uint32 tmp1 = R[rn] + R[rm];
     const uint32 tmp0 = R[rn];
     const uint32 newValue = tmp1 + SR.T;
-    TraceResizeStack<debug>(m_tracer, rn, R[15], newValue);
+    TraceResizeStack<debug>(rn, R[15], newValue);
     R[rn] = newValue;
     SR.T = (tmp0 > tmp1) || (tmp1 > R[rn]);
     AdvancePC<debug, emulateCache, delaySlot>();
@@ -3650,7 +3667,7 @@ FORCE_INLINE uint64 SH2::ADDV(uint16 opcode) {
     const bool src = static_cast<sint32>(R[rm]) < 0;
 
     const uint32 newValue = R[rn] + R[rm];
-    TraceResizeStack<debug>(m_tracer, rn, R[15], newValue);
+    TraceResizeStack<debug>(rn, R[15], newValue);
     R[rn] = newValue;
 
     bool ans = static_cast<sint32>(R[rn]) < 0;
@@ -3668,7 +3685,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::AND(uint16 opcode) {
     DECODE_NM
     R[rn] &= R[rm];
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3706,7 +3723,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::NEG(uint16 opcode) {
     DECODE_NM
     R[rn] = -R[rm];
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3720,7 +3737,7 @@ FORCE_INLINE uint64 SH2::NEGC(uint16 opcode) {
     const uint32 tmp = -R[rm];
     R[rn] = tmp - SR.T;
     SR.T = (0 < tmp) || (tmp < R[rn]);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3732,7 +3749,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::NOT(uint16 opcode) {
     DECODE_NM
     R[rn] = ~R[rm];
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3744,7 +3761,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::OR(uint16 opcode) {
     DECODE_NM
     R[rn] |= R[rm];
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3784,7 +3801,7 @@ FORCE_INLINE uint64 SH2::ROTCL(uint16 opcode) {
     const bool tmp = R[rn] >> 31u;
     R[rn] = (R[rn] << 1u) | SR.T;
     SR.T = tmp;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3798,7 +3815,7 @@ FORCE_INLINE uint64 SH2::ROTCR(uint16 opcode) {
     const bool tmp = R[rn] & 1u;
     R[rn] = (R[rn] >> 1u) | (SR.T << 31u);
     SR.T = tmp;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3811,7 +3828,7 @@ FORCE_INLINE uint64 SH2::ROTL(uint16 opcode) {
     DECODE_N
     SR.T = R[rn] >> 31u;
     R[rn] = (R[rn] << 1u) | SR.T;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3824,7 +3841,7 @@ FORCE_INLINE uint64 SH2::ROTR(uint16 opcode) {
     DECODE_N
     SR.T = R[rn] & 1u;
     R[rn] = (R[rn] >> 1u) | (SR.T << 31u);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3837,7 +3854,7 @@ FORCE_INLINE uint64 SH2::SHAL(uint16 opcode) {
     DECODE_N
     SR.T = R[rn] >> 31u;
     R[rn] <<= 1u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3850,7 +3867,7 @@ FORCE_INLINE uint64 SH2::SHAR(uint16 opcode) {
     DECODE_N
     SR.T = R[rn] & 1u;
     R[rn] = static_cast<sint32>(R[rn]) >> 1;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3863,7 +3880,7 @@ FORCE_INLINE uint64 SH2::SHLL(uint16 opcode) {
     DECODE_N
     SR.T = R[rn] >> 31u;
     R[rn] <<= 1u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3875,7 +3892,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::SHLL2(uint16 opcode) {
     DECODE_N
     R[rn] <<= 2u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3887,7 +3904,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::SHLL8(uint16 opcode) {
     DECODE_N
     R[rn] <<= 8u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3899,7 +3916,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::SHLL16(uint16 opcode) {
     DECODE_N
     R[rn] <<= 16u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3912,7 +3929,7 @@ FORCE_INLINE uint64 SH2::SHLR(uint16 opcode) {
     DECODE_N
     SR.T = R[rn] & 1u;
     R[rn] >>= 1u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3924,7 +3941,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::SHLR2(uint16 opcode) {
     DECODE_N
     R[rn] >>= 2u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3936,7 +3953,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::SHLR8(uint16 opcode) {
     DECODE_N
     R[rn] >>= 8u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3948,7 +3965,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::SHLR16(uint16 opcode) {
     DECODE_N
     R[rn] >>= 16u;
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3960,7 +3977,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::SUB(uint16 opcode) {
     DECODE_NM
     const uint32 newValue = R[rn] - R[rm];
-    TraceResizeStack<debug>(m_tracer, rn, R[15], newValue);
+    TraceResizeStack<debug>(rn, R[15], newValue);
     R[rn] = newValue;
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
@@ -3975,10 +3992,10 @@ FORCE_INLINE uint64 SH2::SUBC(uint16 opcode) {
     const uint32 tmp1 = R[rn] - R[rm];
     const uint32 tmp0 = R[rn];
     const uint32 newValue = tmp1 - SR.T;
-    TraceResizeStack<debug>(m_tracer, rn, R[15], newValue);
+    TraceResizeStack<debug>(rn, R[15], newValue);
     R[rn] = newValue;
     SR.T = (tmp0 < tmp1) || (tmp1 < R[rn]);
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -3992,7 +4009,7 @@ FORCE_INLINE uint64 SH2::SUBV(uint16 opcode) {
     const bool dst = static_cast<sint32>(R[rn]) < 0;
     const bool src = static_cast<sint32>(R[rm]) < 0;
     const uint32 newValue = R[rn] - R[rm];
-    TraceResizeStack<debug>(m_tracer, rn, R[15], newValue);
+    TraceResizeStack<debug>(rn, R[15], newValue);
 
     R[rn] = newValue;
 
@@ -4011,7 +4028,7 @@ template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::XOR(uint16 opcode) {
     DECODE_NM
     R[rn] ^= R[rm];
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
     m_wbReg = kWBRegNone;
@@ -4048,7 +4065,7 @@ FORCE_INLINE uint64 SH2::XORM(uint16 opcode) {
 template <bool debug, bool emulateCache, bool delaySlot>
 FORCE_INLINE uint64 SH2::DT(uint16 opcode) {
     DECODE_N
-    TraceResizeStack<debug>(m_tracer, rn, R[15], R[15] - 1);
+    TraceResizeStack<debug>(rn, R[15], R[15] - 1);
     --R[rn];
     SR.T = R[rn] == 0;
     AdvancePC<debug, emulateCache, delaySlot>();
@@ -4075,13 +4092,13 @@ FORCE_INLINE uint64 SH2::MACW(uint16 opcode) {
     uint64 cycles = AccessCycles<uint16, false, emulateCache>(address2);
     const sint32 op2 = static_cast<sint16>(MemReadWord<emulateCache>(address2));
     R[rn] += 2;
-    TracePopFromStack<debug>(m_tracer, rn, R[15]);
+    TracePopFromStack<debug>(rn, R[15]);
 
     const uint32 address1 = R[rm];
     cycles += AccessCycles<uint16, false, emulateCache>(address1);
     const sint32 op1 = static_cast<sint16>(MemReadWord<emulateCache>(address1));
     R[rm] += 2;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
 
     const sint32 mul = op1 * op2;
     if (SR.S) {
@@ -4112,13 +4129,13 @@ FORCE_INLINE uint64 SH2::MACL(uint16 opcode) {
     uint64 cycles = AccessCycles<uint32, false, emulateCache>(address2);
     const sint64 op2 = static_cast<sint64>(static_cast<sint32>(MemReadLong<emulateCache>(address2)));
     R[rn] += 4;
-    TracePopFromStack<debug>(m_tracer, rn, R[15]);
+    TracePopFromStack<debug>(rn, R[15]);
 
     const uint32 address1 = R[rm];
     cycles += AccessCycles<uint32, false, emulateCache>(address1);
     const sint64 op1 = static_cast<sint64>(static_cast<sint32>(MemReadLong<emulateCache>(address1)));
     R[rm] += 4;
-    TracePopFromStack<debug>(m_tracer, rm, R[15]);
+    TracePopFromStack<debug>(rm, R[15]);
 
     const sint64 mul = op1 * op2;
     sint64 result = mul + MAC.u64;
@@ -4252,7 +4269,7 @@ FORCE_INLINE uint64 SH2::DIV1(uint16 opcode) {
     SR.T = Q == M;
     SR.Q = Q;
 
-    TraceChangeStack<debug>(m_tracer, rn, R[15]);
+    TraceChangeStack<debug>(rn, R[15]);
 
     AdvancePC<debug, emulateCache, delaySlot>();
     const uint64 cycles = WritebackCycles(rm, rn) + 1;
@@ -4423,7 +4440,7 @@ FORCE_INLINE uint64 SH2::BF(uint16 opcode) {
     m_wbReg = kWBRegNone;
     if (!SR.T) {
         const uint32 target = PC + disp + 4;
-        TraceBranch<debug>(m_tracer, PC, target);
+        TraceBranch<debug>(PC, target);
         PC = target;
         RefillPipeline<emulateCache>();
         return 3;
@@ -4439,7 +4456,7 @@ FORCE_INLINE uint64 SH2::BFS(uint16 opcode) {
     DECODE_D_S(1)
     if (!SR.T) {
         const uint32 target = PC + disp + 4;
-        TraceBranchDelay<debug>(m_tracer, target);
+        TraceBranchDelay<debug>(target);
         SetupDelaySlot(target);
     }
     PC += 2;
@@ -4454,7 +4471,7 @@ FORCE_INLINE uint64 SH2::BT(uint16 opcode) {
     m_wbReg = kWBRegNone;
     if (SR.T) {
         const uint32 target = PC + disp + 4;
-        TraceBranch<debug>(m_tracer, PC, target);
+        TraceBranch<debug>(PC, target);
         PC = target;
         RefillPipeline<emulateCache>();
         return 3;
@@ -4470,7 +4487,7 @@ FORCE_INLINE uint64 SH2::BTS(uint16 opcode) {
     DECODE_D_S(1)
     if (SR.T) {
         const uint32 target = PC + disp + 4;
-        TraceBranchDelay<debug>(m_tracer, target);
+        TraceBranchDelay<debug>(target);
         SetupDelaySlot(target);
     }
     PC += 2;
@@ -4483,7 +4500,7 @@ template <bool debug>
 FORCE_INLINE uint64 SH2::BRA(uint16 opcode) {
     DECODE_D12(1)
     const uint32 target = PC + disp + 4;
-    TraceBranchDelay<debug>(m_tracer, target);
+    TraceBranchDelay<debug>(target);
     SetupDelaySlot(target);
     PC += 2;
     m_wbReg = kWBRegNone;
@@ -4495,7 +4512,7 @@ template <bool debug>
 FORCE_INLINE uint64 SH2::BRAF(uint16 opcode) {
     DECODE_M
     const uint32 target = PC + R[rm] + 4;
-    TraceBranchDelay<debug>(m_tracer, target);
+    TraceBranchDelay<debug>(target);
     SetupDelaySlot(target);
     PC += 2;
     const uint64 cycles = WritebackCycles(rm) + 2;
@@ -4509,7 +4526,7 @@ FORCE_INLINE uint64 SH2::BSR(uint16 opcode) {
     DECODE_D12(1)
     PR = PC + 4;
     const uint32 target = PC + disp + 4;
-    TraceCall<debug>(m_tracer, target);
+    TraceCall<debug>(target);
     SetupDelaySlot(target);
     PC += 2;
     const uint64 cycles = WritebackCycles(kWBRegPR) + 2;
@@ -4523,7 +4540,7 @@ FORCE_INLINE uint64 SH2::BSRF(uint16 opcode) {
     DECODE_M
     PR = PC + 4;
     const uint32 target = PC + R[rm] + 4;
-    TraceCall<debug>(m_tracer, target);
+    TraceCall<debug>(target);
     SetupDelaySlot(target);
     PC += 2;
     const uint64 cycles = WritebackCycles(rm, kWBRegPR) + 2;
@@ -4536,7 +4553,7 @@ template <bool debug>
 FORCE_INLINE uint64 SH2::JMP(uint16 opcode) {
     DECODE_M
     const uint32 target = R[rm];
-    TraceBranchDelay<debug>(m_tracer, target);
+    TraceBranchDelay<debug>(target);
     SetupDelaySlot(R[rm]);
     PC += 2;
     const uint64 cycles = WritebackCycles(rm) + 2;
@@ -4550,7 +4567,7 @@ FORCE_INLINE uint64 SH2::JSR(uint16 opcode) {
     DECODE_M
     PR = PC + 4;
     const uint32 target = R[rm];
-    TraceCall<debug>(m_tracer, target);
+    TraceCall<debug>(target);
     SetupDelaySlot(target);
     PC += 2;
     const uint64 cycles = WritebackCycles(rm, kWBRegPR) + 2;
@@ -4572,7 +4589,7 @@ FORCE_INLINE uint64 SH2::TRAPA(uint16 opcode) {
     MemWriteLong<debug, emulateCache>(address1, SR.u32);
     MemWriteLong<debug, emulateCache>(address2, PC + 2);
     const uint32 target = MemReadLong<emulateCache>(address3);
-    TraceTrap<debug>(m_tracer, imm >> 2u, PC, R[15], target);
+    TraceTrap<debug>(imm >> 2u, PC, R[15], target);
     PC = target;
     RefillPipeline<emulateCache>();
     R[15] -= 8;
@@ -4589,7 +4606,7 @@ FORCE_INLINE uint64 SH2::RTE() {
     const uint64 cycles = AccessCycles<uint32, false, emulateCache>(address1) +
                           AccessCycles<uint32, false, emulateCache>(address2) + WritebackCycles(15) + 2;
     const uint32 target = MemReadLong<emulateCache>(address1);
-    TraceReturnFromException<debug>(m_tracer, target, R[15] + 8);
+    TraceReturnFromException<debug>(target, R[15] + 8);
     SetupDelaySlot(target);
     SR.u32 = MemReadLong<emulateCache>(address2) & 0x000003F3;
     PC += 2;
@@ -4603,7 +4620,7 @@ FORCE_INLINE uint64 SH2::RTE() {
 // rts
 template <bool debug>
 FORCE_INLINE uint64 SH2::RTS() {
-    TraceReturn<debug>(m_tracer, PR);
+    TraceReturn<debug>(PR);
     SetupDelaySlot(PR);
     PC += 2;
     const uint64 cycles = WritebackCycles(kWBRegPR) + 2;
@@ -4780,10 +4797,14 @@ void SH2::Probe::RefillPipeline() {
 
 void SH2::Probe::ExecuteDiv32() {
     m_sh2.ExecuteDiv32<true>();
+    // Deliver the division trace right away since this may run while the emulator is paused
+    m_sh2.FlushTraceRecords();
 }
 
 void SH2::Probe::ExecuteDiv64() {
     m_sh2.ExecuteDiv64<true>();
+    // Deliver the division trace right away since this may run while the emulator is paused
+    m_sh2.FlushTraceRecords();
 }
 
 } // namespace ymir::sh2
@@ -6,7 +6,10 @@
 #include <ymir/util/thread_name.hpp>
 #include <ymir/util/unreachable.hpp>
 
+#include <xxh3.h>
+
 #include <algorithm>
+#include <bit>
 #include <cassert>
 #include <limits>
 
@@ -63,6 +66,7 @@ SoftwareVDPRenderer::SoftwareVDPRenderer(VDPState &state, config::VDP2DebugRende
     , m_vdp2AccessPatternsConfig(vdp2AccessPatternsConfig) {
 
     UpdateFunctionPointers();
+    UpdateEnhancementBuffers();
 
     Reset(true);
 }
@@ -95,6 +99,12 @@ void SoftwareVDPRenderer::Reset(bool hard) {
 
     if (hard) {
         m_CRAMCache.fill({});
+        if (m_threadedVDP1Rendering) {
+            // The render thread resets its copy of VDP1 state and clears the caches derived from it
+            m_vdp1RenderingContext.EnqueueEvent(VDP1RenderEvent::Reset());
+        } else {
+            m_VDP1TexCache.Clear();
+        }
     }
 
     if (m_threadedVDP2Rendering) {
@@ -109,30 +119,75 @@ void SoftwareVDPRenderer::Reset(bool hard) {
     }
 
     for (auto &output : m_layerOutputs) {
-        output[0].Reset();
-        output[1].Reset();
+        output.Reset();
+    }
+    if (m_altLayerOutputs) {
+        for (auto &output : *m_altLayerOutputs) {
+            output.Reset();
+        }
     }
     m_spriteLayerAttrs[0].Reset();
     m_spriteLayerAttrs[1].Reset();
     for (auto &output : m_rotParamLineOutputs) {
         output.Reset();
     }
-    for (auto &fb : m_altSpriteFB) {
-        fb.fill(0);
-    }
-    for (auto &altFB : m_meshFB) {
-        for (auto &fb : altFB) {
+    if (m_altSpriteFB) {
+        for (auto &fb : *m_altSpriteFB) {
             fb.fill(0);
         }
     }
+    if (m_meshFB) {
+        for (auto &altFB : *m_meshFB) {
+            for (auto &fb : altFB) {
+                fb.fill(0);
+            }
+        }
+    }
+    if (m_meshLayerOutput) {
+        for (auto &output : *m_meshLayerOutput) {
+            output.Reset();
+        }
+    }
 
     VDP2UpdateEnabledBGs();
 }
 
+void SoftwareVDPRenderer::PreUpdateEnhancementsSync() {
+    // Let the render threads finish their work before the buffers are reallocated
+    PreSaveStateSync();
+}
+
 void SoftwareVDPRenderer::UpdateEnhancements() {
+    UpdateEnhancementBuffers();
     UpdateFunctionPointers();
 }
 
+void SoftwareVDPRenderer::UpdateEnhancementBuffers() {
+    if (m_enhancements.deinterlace) {
+        if (!m_altSpriteFB) {
+            m_altSpriteFB = std::make_unique<std::array<SpriteFB, 2>>();
+            m_altLayerOutputs = std::make_unique<LayerOutputs>();
+            devlog::debug<grp::swbase>("Allocated deinterlacing buffers");
+        }
+    } else if (m_altSpriteFB) {
+        m_altSpriteFB.reset();
+        m_altLayerOutputs.reset();
+        devlog::debug<grp::swbase>("Released deinterlacing buffers");
+    }
+
+    if (m_enhancements.transparentMeshes) {
+        if (!m_meshFB) {
+            m_meshFB = std::make_unique<std::array<std::array<SpriteFB, 2>, 2>>();
+            m_meshLayerOutput = std::make_unique<std::array<LayerOutput, 2>>();
+            devlog::debug<grp::swbase>("Allocated transparent mesh buffers");
+        }
+    } else if (m_meshFB) {
+        m_meshFB.reset();
+        m_meshLayerOutput.reset();
+        devlog::debug<grp::swbase>("Released transparent mesh buffers");
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Configuration
 
@@ -158,6 +213,9 @@ void SoftwareVDPRenderer::EnableThreadedVDP1(bool enable) {
         VDP1RenderEvent dummy{};
         while (m_vdp1RenderingContext.eventQueue.try_dequeue(dummy)) {
         }
+
+        // The cache reflected the render thread's copy of VRAM
+        m_VDP1TexCache.Clear();
     }
 }
 
@@ -235,6 +293,8 @@ void SoftwareVDPRenderer::PostLoadStateSync() {
 
     if (m_threadedVDP1Rendering) {
         m_vdp1RenderingContext.EnqueueEvent(VDP1RenderEvent::PostLoadStateSync());
+    } else {
+        m_VDP1TexCache.Clear();
     }
     if (m_threadedVDP2Rendering) {
         m_vdp2RenderingContext.EnqueueEvent(VDP2RenderEvent::PostLoadStateSync());
@@ -252,7 +312,15 @@ void SoftwareVDPRenderer::PostLoadStateSync() {
 
 void SoftwareVDPRenderer::SaveState(savestate::VDPSaveState::VDPRendererSaveState &state) {
     state.vdp1State.doubleV = m_VDP1doubleV;
-    state.vdp1State.meshFB = m_meshFB;
+    if (m_meshFB) {
+        state.vdp1State.meshFB = *m_meshFB;
+    } else {
+        for (auto &altFB : state.vdp1State.meshFB) {
+            for (auto &fb : altFB) {
+                fb.fill(0);
+            }
+        }
+    }
 
     auto copyChar = [&](savestate::VDPSaveState::VDPRendererSaveState::CharacterSaveState &dst, const Character &src) {
         dst.charNum = src.charNum;
@@ -284,7 +352,9 @@ bool SoftwareVDPRenderer::ValidateState(const savestate::VDPSaveState::VDPRender
 
 void SoftwareVDPRenderer::LoadState(const savestate::VDPSaveState::VDPRendererSaveState &state) {
     m_VDP1doubleV = state.vdp1State.doubleV;
-    m_meshFB = state.vdp1State.meshFB;
+    if (m_meshFB) {
+        *m_meshFB = state.vdp1State.meshFB;
+    }
 
     auto copyChar = [&](Character &dst, const savestate::VDPSaveState::VDPRendererSaveState::CharacterSaveState &src) {
         dst.charNum = src.charNum;
@@ -326,6 +396,8 @@ template <mem_primitive_16 T>
 FORCE_INLINE void SoftwareVDPRenderer::VDP1WriteVRAMImpl(uint32 address, T value) {
     if (m_threadedVDP1Rendering) {
         m_vdp1RenderingContext.EnqueueEvent(VDP1RenderEvent::VRAMWrite<T>(address, value));
+    } else {
+        m_VDP1TexCache.InvalidatePage(address);
     }
 }
 
@@ -356,7 +428,7 @@ void SoftwareVDPRenderer::VDP1WriteFB(uint32 address, uint16 value) {
 template <mem_primitive_16 T>
 FORCE_INLINE void SoftwareVDPRenderer::VDP1WriteFBImpl(uint32 address, T value) {
     if (m_enhancements.deinterlace) {
-        util::WriteBE<T>(&m_altSpriteFB[m_state.displayFB ^ 1][address & 0x3FFFF], value);
+        util::WriteBE<T>(&(*m_altSpriteFB)[m_state.displayFB ^ 1][address & 0x3FFFF], value);
     }
     if (m_threadedVDP1Rendering) {
         m_vdp1RenderingContext.EnqueueEvent(VDP1RenderEvent::FBRAMWrite<T>(address, value));
@@ -472,6 +544,10 @@ void SoftwareVDPRenderer::VDP1BeginFrame() {
     const VDP2Regs &regs2 = VDP2GetRegs();
     m_VDP1doubleV =
         m_enhancements.deinterlace && regs2.TVMD.LSMDn == InterlaceMode::DoubleDensity && !regs1.dblInterlaceEnable;
+
+    if (m_threadedVDP1Rendering) {
+        m_vdp1RenderingContext.EnqueueEvent(VDP1RenderEvent::BeginDraw());
+    }
 }
 
 void SoftwareVDPRenderer::VDP1ExecuteCommand(uint32 cmdAddress, VDP1Command::Control control) {
@@ -489,6 +565,184 @@ void SoftwareVDPRenderer::VDP1EndFrame() {
     Callbacks.VDP1DrawFinished();
 }
 
+// -----------------------------------------------------------------------------
+// VDP1 frame reuse
+
+void SoftwareVDPRenderer::VDP1ReuseBeginDraw() {
+    auto &reuse = m_VDP1FrameReuse;
+
+    // Drop anything left over from an unfinished frame
+    VDP1ReuseFlush();
+
+    reuse.drawing = !m_enhancements.AnyEnabled();
+    if (!reuse.drawing) {
+        reuse.matching = false;
+        return;
+    }
+
+    // The output of a frame depends on the initial contents of the draw framebuffer and the clipping and local
+    // coordinate state carried over from the previous frame
+    const auto &fb = m_vdp1RenderingContext.vdp1.spriteFB[VDP1GetDisplayFBIndex() ^ 1];
+    const auto &ctx = m_state.state1;
+    const std::array<sint32, 8> ctxValues{ctx.sysClipH,   ctx.sysClipV,   ctx.userClipX0,  ctx.userClipY0,
+                                          ctx.userClipX1, ctx.userClipY1, ctx.localCoordX, ctx.localCoordY};
+    reuse.startHash = XXH3_64bits_withSeed(fb.data(), fb.size(), 0);
+    reuse.startHash = XXH3_64bits_withSeed(ctxValues.data(), sizeof(ctxValues), reuse.startHash);
+
+    reuse.matching = reuse.prevValid && reuse.startHash == reuse.prevStartHash;
+    reuse.cmdHashes.clear();
+}
+
+void SoftwareVDPRenderer::VDP1ReuseExecuteCommand(uint32 cmdAddress, VDP1Command::Control control) {
+    auto &reuse = m_VDP1FrameReuse;
+
+    const uint64 seed = reuse.cmdHashes.empty() ? reuse.startHash : reuse.cmdHashes.back();
+    VDP1TextureCache::PageMask pages{};
+    const uint64 hash = VDP1CalcCommandFingerprint(cmdAddress, control, seed, pages);
+    const size_t index = reuse.cmdHashes.size();
+    reuse.cmdHashes.push_back(hash);
+
+    if (reuse.matching && index < reuse.prevCmdHashes.size() && reuse.prevCmdHashes[index] == hash) {
+        reuse.deferred.push_back({cmdAddress, control});
+        for (uint32 i = 0; i < pages.size(); ++i) {
+            reuse.deferredPages[i] |= pages[i];
+        }
+        return;
+    }
+
+    VDP1ReuseAbort();
+    (this->*m_fnVDP1HandleCommand)(cmdAddress, control);
+}
+
+void SoftwareVDPRenderer::VDP1ReuseEndDraw() {
+    auto &reuse = m_VDP1FrameReuse;
+    if (!reuse.drawing) {
+        return;
+    }
+    reuse.drawing = false;
+
+    auto &fb = m_vdp1RenderingContext.vdp1.spriteFB[VDP1GetDisplayFBIndex() ^ 1];
+    if (reuse.matching && reuse.cmdHashes.size() == reuse.prevCmdHashes.size()) {
+        // Same inputs as the last completed frame; the deferred commands would produce the same output
+        devlog::trace<grp::swvdp1>("Reusing previous frame ({} commands)", reuse.deferred.size());
+        reuse.deferred.clear();
+        reuse.deferredPages.fill(0);
+        fb = reuse.prevFB;
+        m_state.state1 = reuse.prevEndState;
+        return;
+    }
+
+    VDP1ReuseFlush();
+
+    // Remember this frame for the next one
+    reuse.prevValid = true;
+    reuse.prevStartHash = reuse.startHash;
+    std::swap(reuse.prevCmdHashes, reuse.cmdHashes);
+    reuse.prevEndState = m_state.state1;
+    reuse.prevFB = fb;
+}
+
+void SoftwareVDPRenderer::VDP1ReuseFlush() {
+    auto &reuse = m_VDP1FrameReuse;
+    for (const auto &cmd : reuse.deferred) {
+        (this->*m_fnVDP1HandleCommand)(cmd.address, cmd.control);
+    }
+    reuse.deferred.clear();
+    reuse.deferredPages.fill(0);
+}
+
+void SoftwareVDPRenderer::VDP1ReuseAbort() {
+    VDP1ReuseFlush();
+    m_VDP1FrameReuse.matching = false;
+}
+
+uint64 SoftwareVDPRenderer::VDP1CalcCommandFingerprint(uint32 cmdAddress, VDP1Command::Control control, uint64 seed,
+                                                       VDP1TextureCache::PageMask &pages) {
+    using Cache = VDP1TextureCache;
+
+    const auto &vram = m_vdp1RenderingContext.vdp1.mem.VRAM;
+    uint64 hash = seed;
+
+    // Hashes a range of VRAM and marks the pages it covers, handling wraparound
+    auto hashRange = [&](uint32 address, uint32 size) {
+        address &= kVDP1VRAMSize - 1;
+        while (size > 0) {
+            const uint32 count = std::min<uint32>(size, kVDP1VRAMSize - address);
+            hash = XXH3_64bits_withSeed(&vram[address], count, hash);
+            const uint32 firstPage = address >> Cache::kPageShift;
+            const uint32 lastPage = (address + count - 1) >> Cache::kPageShift;
+            for (uint32 page = firstPage; page <= lastPage; ++page) {
+                pages[page >> 6u] |= 1ull << (page & 63u);
+            }
+            address = 0;
+            size -= count;
+        }
+    };
+
+    // Registers and settings that affect drawing
+    const VDP1Regs &regs1 = VDP1GetRegs();
+    const VDP2Regs &regs2 = VDP2GetRegs();
+    const std::array<uint32, 8> settings{
+        control.u16,
+        regs1.fbSizeH,
+        regs1.pixel8Bits,
+        regs1.dblInterlaceEnable,
+        regs1.dblInterlaceDrawLine,
+        regs1.evenOddCoordSelect,
+        static_cast<uint32>(regs2.TVMD.LSMDn),
+        m_VDP1doubleV,
+    };
+    hash = XXH3_64bits_withSeed(settings.data(), sizeof(settings), hash);
+
+    // Command table entry
+    hashRange(cmdAddress, 0x20);
+
+    using enum VDP1Command::CommandType;
+    switch (control.command) {
+    case DrawNormalSprite:
+    case DrawScaledSprite:
+    case DrawDistortedSprite:
+    case DrawDistortedSpriteAlt: {
+        const VDP1Command::DrawMode mode{.u16 = VDP1ReadRendererVRAM<uint16>(cmdAddress + 0x04)};
+        const uint32 colorBank = VDP1ReadRendererVRAM<uint16>(cmdAddress + 0x06);
+        uint32 charAddr = VDP1ReadRendererVRAM<uint16>(cmdAddress + 0x08) * 8u;
+        const VDP1Command::Size size{.u16 = VDP1ReadRendererVRAM<uint16>(cmdAddress + 0x0A)};
+        const uint32 texels = std::max<uint32>(size.H * 8u, 1u) * std::max<uint32>(size.V, 1u);
+        switch (mode.colorMode) {
+        case 0: hashRange(charAddr, (texels + 1) / 2); break;
+        case 1:
+            hashRange(charAddr, (texels + 1) / 2);
+            hashRange(colorBank << 3u, 16 * sizeof(uint16));
+            break;
+        case 2: [[fallthrough]];
+        case 3: [[fallthrough]];
+        case 4: hashRange(charAddr, texels); break;
+        case 5:
+            charAddr &= ~0xF;
+            hashRange(charAddr, texels * sizeof(uint16));
+            break;
+        }
+        if (mode.gouraudEnable) {
+            hashRange(static_cast<uint32>(VDP1ReadRendererVRAM<uint16>(cmdAddress + 0x1C)) << 3u, 4 * sizeof(uint16));
+        }
+        break;
+    }
+    case DrawPolygon:
+    case DrawPolylines:
+    case DrawPolylinesAlt:
+    case DrawLine: {
+        const VDP1Command::DrawMode mode{.u16 = VDP1ReadRendererVRAM<uint16>(cmdAddress + 0x04)};
+        if (mode.gouraudEnable) {
+            hashRange(static_cast<uint32>(VDP1ReadRendererVRAM<uint16>(cmdAddress + 0x1C)) << 3u, 4 * sizeof(uint16));
+        }
+        break;
+    }
+    default: break;
+    }
+
+    return hash;
+}
+
 // -----------------------------------------------------------------------------
 
 void SoftwareVDPRenderer::VDP2SetResolution(uint32 h, uint32 v, bool exclusive) {
@@ -573,14 +827,16 @@ void SoftwareVDPRenderer::DumpExtraVDP1Framebuffers(std::ostream &out) const {
     const uint8 dispFB = m_state.displayFB;
     const uint8 drawFB = dispFB ^ 1;
     if (m_enhancements.deinterlace) {
-        out.write((const char *)m_altSpriteFB[drawFB].data(), m_altSpriteFB[drawFB].size());
-        out.write((const char *)m_altSpriteFB[dispFB].data(), m_altSpriteFB[dispFB].size());
+        const auto &altSpriteFB = *m_altSpriteFB;
+        out.write((const char *)altSpriteFB[drawFB].data(), altSpriteFB[drawFB].size());
+        out.write((const char *)altSpriteFB[dispFB].data(), altSpriteFB[dispFB].size());
     }
     if (m_enhancements.transparentMeshes) {
-        out.write((const char *)m_meshFB[0][drawFB].data(), m_meshFB[0][drawFB].size());
-        out.write((const char *)m_meshFB[0][dispFB].data(), m_meshFB[0][dispFB].size());
-        out.write((const char *)m_meshFB[1][drawFB].data(), m_meshFB[1][drawFB].size());
-        out.write((const char *)m_meshFB[1][dispFB].data(), m_meshFB[1][dispFB].size());
+        const auto &meshFB = *m_meshFB;
+        out.write((const char *)meshFB[0][drawFB].data(), meshFB[0][drawFB].size());
+        out.write((const char *)meshFB[0][dispFB].data(), meshFB[0][dispFB].size());
+        out.write((const char *)meshFB[1][drawFB].data(), meshFB[1][drawFB].size());
+        out.write((const char *)meshFB[1][dispFB].data(), meshFB[1][dispFB].size());
     }
 }
 
@@ -602,7 +858,11 @@ void SoftwareVDPRenderer::VDP1RenderThread() {
             const auto &event = events[i];
             using EvtType = VDP1RenderEvent::Type;
             switch (event.type) {
-            case EvtType::Reset: rctx.Reset(); break;
+            case EvtType::Reset:
+                rctx.Reset();
+                m_VDP1TexCache.Clear();
+                m_VDP1FrameReuse.Reset();
+                break;
 
             case EvtType::EraseFramebuffer: {
                 if (event.erase.cycles == 0) {
@@ -615,45 +875,81 @@ void SoftwareVDPRenderer::VDP1RenderThread() {
                 break;
             }
             case EvtType::SwapBuffers: {
+                VDP1ReuseAbort();
+                m_VDP1FrameReuse.drawing = false;
                 const auto fbIndex = VDP1GetDisplayFBIndex() ^ 1;
                 m_state.spriteFB[fbIndex] = rctx.vdp1.spriteFB[fbIndex];
                 rctx.swapBuffersSignal.Set();
                 break;
             }
+            case EvtType::BeginDraw: VDP1ReuseBeginDraw(); break;
             case EvtType::EndDraw: {
+                VDP1ReuseEndDraw();
                 const auto fbIndex = VDP1GetDisplayFBIndex() ^ 1;
                 m_state.spriteFB[fbIndex] = rctx.vdp1.spriteFB[fbIndex];
                 break;
             }
-            case EvtType::Command: (this->*m_fnVDP1HandleCommand)(event.command.address, event.command.control); break;
+            case EvtType::Command:
+                if (m_VDP1FrameReuse.drawing) {
+                    VDP1ReuseExecuteCommand(event.command.address, event.command.control);
+                } else {
+                    (this->*m_fnVDP1HandleCommand)(event.command.address, event.command.control);
+                }
+                break;
 
-            case EvtType::VRAMWriteByte: rctx.vdp1.mem.VRAM[event.write.address] = event.write.value; break;
-            case EvtType::VRAMWriteWord:
-                util::WriteBE<uint16>(&rctx.vdp1.mem.VRAM[event.write.address], event.write.value);
+            case EvtType::VRAMWriteByte:
+            case EvtType::VRAMWriteWord: {
+                // Deferred commands must see VRAM as it was when they were executed
+                const uint32 page = (event.write.address & (kVDP1VRAMSize - 1)) >> VDP1TextureCache::kPageShift;
+                if (m_VDP1FrameReuse.deferredPages[page >> 6u] & (1ull << (page & 63u))) {
+                    VDP1ReuseFlush();
+                }
+                if (event.type == EvtType::VRAMWriteByte) {
+                    rctx.vdp1.mem.VRAM[event.write.address] = event.write.value;
+                } else {
+                    util::WriteBE<uint16>(&rctx.vdp1.mem.VRAM[event.write.address], event.write.value);
+                }
+                m_VDP1TexCache.InvalidatePage(event.write.address);
                 break;
+            }
             case EvtType::FBRAMWriteByte:
+                VDP1ReuseAbort();
                 rctx.vdp1.spriteFB[VDP1GetDisplayFBIndex() ^ 1][event.write.address] = event.write.value;
                 break;
             case EvtType::FBRAMWriteWord:
+                VDP1ReuseAbort();
                 util::WriteBE<uint16>(&rctx.vdp1.spriteFB[VDP1GetDisplayFBIndex() ^ 1][event.write.address],
                                       event.write.value);
                 break;
-            case EvtType::RegWrite: rctx.vdp1.regs.Write<false>(event.write.address, event.write.value); break;
+            case EvtType::RegWrite:
+                VDP1ReuseFlush();
+                rctx.vdp1.regs.Write<false>(event.write.address, event.write.value);
+                break;
 
-            case EvtType::PreSaveStateSync: rctx.preSaveSyncSignal.Set(); break;
+            case EvtType::PreSaveStateSync:
+                VDP1ReuseFlush();
+                rctx.preSaveSyncSignal.Set();
+                break;
             case EvtType::PostLoadStateSync:
                 rctx.vdp1.regs = m_state.regs1;
                 rctx.vdp1.mem = m_state.mem1;
                 rctx.vdp1.spriteFB = m_state.spriteFB;
+                m_VDP1TexCache.Clear();
+                m_VDP1FrameReuse.Reset();
                 rctx.postLoadSyncSignal.Set();
                 break;
 
-            case EvtType::Shutdown: running = false; break;
+            case EvtType::Shutdown:
+                VDP1ReuseFlush();
+                m_VDP1FrameReuse.Reset();
+                running = false;
+                break;
             }
-
-            ++rctx.cmdFence;
-            rctx.cmdFence.notify_all();
         }
+
+        // Publish progress once per batch to avoid bouncing the fence between threads on every command
+        rctx.cmdFence.fetch_add(static_cast<uint32>(count));
+        rctx.cmdFence.notify_all();
     }
 }
 
@@ -889,7 +1185,7 @@ FORCE_INLINE uint8 SoftwareVDPRenderer::VDP1GetDisplayFBIndex() const {
 
 FORCE_INLINE std::array<SpriteFB, 2> &SoftwareVDPRenderer::VDP1GetRendererDrawFB(bool altFB) {
     if (altFB) {
-        return m_altSpriteFB;
+        return *m_altSpriteFB;
     } else if (m_threadedVDP1Rendering) {
         return m_vdp1RenderingContext.vdp1.spriteFB;
     } else {
@@ -909,9 +1205,6 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP1DoEraseFramebuffer(uint64 cycles) {
 
     const uint8 fbIndex = VDP1GetDisplayFBIndex();
     auto &fb = m_state.spriteFB[fbIndex];
-    auto &altFB = m_altSpriteFB[fbIndex];
-    [[maybe_unused]] auto &meshFB = m_meshFB[0][fbIndex];
-    [[maybe_unused]] auto &altMeshFB = m_meshFB[1][fbIndex];
 
     const uint32 fbOffsetShift = regs1.eraseOffsetShift;
 
@@ -930,6 +1223,11 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP1DoEraseFramebuffer(uint64 cycles) {
     const uint32 y3 = std::min<uint32>(regs1.eraseY3Latch, maxV) << scaleV;
 
     const bool mirror = m_enhancements.deinterlace && doubleDensity;
+    const bool clearMesh = m_enhancements.transparentMeshes;
+
+    SpriteFB *altFB = mirror ? &(*m_altSpriteFB)[fbIndex] : nullptr;
+    SpriteFB *meshFB = clearMesh ? &(*m_meshFB)[0][fbIndex] : nullptr;
+    SpriteFB *altMeshFB = clearMesh && mirror ? &(*m_meshFB)[1][fbIndex] : nullptr;
 
     static constexpr uint64 kCyclesPerWrite = 1;
 
@@ -939,13 +1237,13 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP1DoEraseFramebuffer(uint64 cycles) {
             const uint32 address = (fbOffset + x) * sizeof(uint16);
             util::WriteBE<uint16>(&fb[address & 0x3FFFE], regs1.eraseWriteValueLatch);
             if (mirror) {
-                util::WriteBE<uint16>(&altFB[address & 0x3FFFE], regs1.eraseWriteValueLatch);
+                util::WriteBE<uint16>(&(*altFB)[address & 0x3FFFE], regs1.eraseWriteValueLatch);
             }
 
-            if (m_enhancements.transparentMeshes) {
-                util::WriteBE<uint16>(&meshFB[address & 0x3FFFE], 0);
+            if (clearMesh) {
+                util::WriteBE<uint16>(&(*meshFB)[address & 0x3FFFE], 0);
                 if (mirror) {
-                    util::WriteBE<uint16>(&altMeshFB[address & 0x3FFFE], 0);
+                    util::WriteBE<uint16>(&(*altMeshFB)[address & 0x3FFFE], 0);
                 }
             }
 
@@ -1090,11 +1388,11 @@ FORCE_INLINE bool SoftwareVDPRenderer::VDP1PlotPixel(CoordS32 coord, const VDP1P
         if (pixelParams.mode.msbOn) {
             drawFB[fbOffset] |= 0x80;
         } else if (transparentMeshes && pixelParams.mode.meshEnable) {
-            m_meshFB[altFB][fbIndex][fbOffset] = pixelParams.color;
+            (*m_meshFB)[altFB][fbIndex][fbOffset] = pixelParams.color;
         } else {
             drawFB[fbOffset] = pixelParams.color;
             if constexpr (transparentMeshes) {
-                m_meshFB[altFB][fbIndex][fbOffset] = 0;
+                (*m_meshFB)[altFB][fbIndex][fbOffset] = 0;
             }
         }
     } else {
@@ -1150,11 +1448,11 @@ FORCE_INLINE bool SoftwareVDPRenderer::VDP1PlotPixel(CoordS32 coord, const VDP1P
             }
 
             if (transparentMeshes && pixelParams.mode.meshEnable) {
-                util::WriteBE<uint16>(&m_meshFB[altFB][fbIndex][fbOffset], dstColor.u16);
+                util::WriteBE<uint16>(&(*m_meshFB)[altFB][fbIndex][fbOffset], dstColor.u16);
             } else {
                 util::WriteBE<uint16>(pixel, dstColor.u16);
                 if constexpr (transparentMeshes) {
-                    util::WriteBE<uint16>(&m_meshFB[altFB][fbIndex][fbOffset], 0);
+                    util::WriteBE<uint16>(&(*m_meshFB)[altFB][fbIndex][fbOffset], 0);
                 }
             }
         }
@@ -1208,6 +1506,134 @@ FORCE_INLINE bool SoftwareVDPRenderer::VDP1PlotLine(CoordS32 coord1, CoordS32 co
     return plotted;
 }
 
+SoftwareVDPRenderer::VDP1TextureCache::Entry *
+SoftwareVDPRenderer::VDP1LookupTexture(const VDP1TexturedLineParams &lineParams) {
+    using Cache = VDP1TextureCache;
+
+    // Patterns with zero width or height use degenerate texture coordinates
+    const uint32 texelCount = lineParams.charSizeH * lineParams.charSizeV;
+    if (texelCount == 0 || texelCount > Cache::kMaxTexels) {
+        return nullptr;
+    }
+
+    const Cache::Key key{
+        .charAddr = lineParams.charAddr,
+        .colorBank = lineParams.colorBank,
+        .charSizeH = static_cast<uint16>(lineParams.charSizeH),
+        .charSizeV = static_cast<uint8>(lineParams.charSizeV),
+        .colorMode = static_cast<uint8>(lineParams.mode.colorMode),
+    };
+
+    uint32 hash = key.charAddr >> 3u;
+    hash = hash * 0x9E3779B1u + key.colorBank;
+    hash = hash * 0x9E3779B1u + (key.charSizeH << 16u) + (key.charSizeV << 8u) + key.colorMode;
+    hash ^= hash >> 16u;
+    auto &entry = m_VDP1TexCache.entries[hash & (Cache::kNumEntries - 1)];
+    if (entry.valid && entry.key == key) {
+        return &entry;
+    }
+
+    // (Re)initialize entry
+    entry.texelOffset = m_VDP1TexCache.AllocateTexels(texelCount);
+    entry.key = key;
+    entry.valid = true;
+    entry.rowValid.reset();
+
+    // Watch all VRAM pages used by the character data and the color lookup table
+    entry.pages.fill(0);
+    auto watchRange = [&](uint32 address, uint32 size) {
+        address &= kVDP1VRAMSize - 1;
+        const uint32 firstPage = address >> Cache::kPageShift;
+        const uint32 lastPage = (address + size - 1) >> Cache::kPageShift;
+        for (uint32 page = firstPage; page <= lastPage; ++page) {
+            const uint32 wrappedPage = page & (Cache::kNumPages - 1);
+            entry.pages[wrappedPage >> 6u] |= 1ull << (wrappedPage & 63u);
+        }
+    };
+    switch (lineParams.mode.colorMode) {
+    case 0: watchRange(lineParams.charAddr, (texelCount + 1) / 2); break;
+    case 1:
+        watchRange(lineParams.charAddr, (texelCount + 1) / 2);
+        watchRange(lineParams.colorBank, 16 * sizeof(uint16));
+        break;
+    case 2: [[fallthrough]];
+    case 3: [[fallthrough]];
+    case 4: watchRange(lineParams.charAddr, texelCount); break;
+    case 5: watchRange(lineParams.charAddr, texelCount * sizeof(uint16)); break;
+    default: entry.valid = false; return nullptr;
+    }
+    for (uint32 i = 0; i < entry.pages.size(); ++i) {
+        m_VDP1TexCache.watchedPages[i] |= entry.pages[i];
+    }
+
+    return &entry;
+}
+
+const uint32 *SoftwareVDPRenderer::VDP1GetTextureRow(VDP1TextureCache::Entry &entry,
+                                                     const VDP1TexturedLineParams &lineParams, uint32 v) {
+    uint32 *row = &m_VDP1TexCache.arena[entry.texelOffset + v * lineParams.charSizeH];
+    if (!entry.rowValid[v]) {
+        for (uint32 u = 0; u < lineParams.charSizeH; ++u) {
+            row[u] = VDP1DecodeTexel(lineParams, u, u + v * lineParams.charSizeH);
+        }
+        entry.rowValid[v] = true;
+    }
+    return row;
+}
+
+FORCE_INLINE uint32 SoftwareVDPRenderer::VDP1DecodeTexel(const VDP1TexturedLineParams &lineParams, uint32 u,
+                                                         uint32 charIndex) {
+    using Cache = VDP1TextureCache;
+
+    uint16 color = 0;
+    bool transparent = true;
+    bool endCode = false;
+
+    switch (lineParams.mode.colorMode) {
+    case 0: // 4 bpp, 16 colors, bank mode
+        color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + (charIndex >> 1));
+        color = (color >> ((~u & 1) * 4)) & 0xF;
+        endCode = color == 0xF;
+        transparent = color == 0x0;
+        color |= lineParams.colorBank;
+        break;
+    case 1: // 4 bpp, 16 colors, lookup table mode
+        color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + (charIndex >> 1));
+        color = (color >> ((~u & 1) * 4)) & 0xF;
+        endCode = color == 0xF;
+        transparent = color == 0x0;
+        color = VDP1ReadRendererVRAM<uint16>(color * sizeof(uint16) + lineParams.colorBank);
+        break;
+    case 2: // 8 bpp, 64 colors, bank mode
+        color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + charIndex);
+        endCode = color == 0xFF;
+        transparent = color == 0x00;
+        color &= 0x3F;
+        color |= lineParams.colorBank;
+        break;
+    case 3: // 8 bpp, 128 colors, bank mode
+        color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + charIndex);
+        endCode = color == 0xFF;
+        transparent = color == 0x00;
+        color &= 0x7F;
+        color |= lineParams.colorBank;
+        break;
+    case 4: // 8 bpp, 256 colors, bank mode
+        color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + charIndex);
+        endCode = color == 0xFF;
+        transparent = color == 0x00;
+        color |= lineParams.colorBank;
+        break;
+    case 5: // 16 bpp, 32768 colors, RGB mode
+        color = VDP1ReadRendererVRAM<uint16>(lineParams.charAddr + charIndex * sizeof(uint16));
+        endCode = color == 0x7FFF;
+        transparent = !bit::test<15>(color);
+        break;
+    }
+
+    return color | (transparent ? Cache::kTexelTransparent : 0u) | (endCode ? Cache::kTexelEndCode : 0u);
+}
+
 template <bool deinterlace, bool transparentMeshes>
 FORCE_INLINE bool SoftwareVDPRenderer::VDP1PlotTexturedLine(CoordS32 coord1, CoordS32 coord2,
                                                             VDP1TexturedLineParams &lineParams, const VDP1Regs &regs1,
@@ -1221,10 +1647,6 @@ FORCE_INLINE bool SoftwareVDPRenderer::VDP1PlotTexturedLine(CoordS32 coord1, Coo
     const uint32 charSizeH = std::max<uint32>(lineParams.charSizeH, 1u);
     const auto mode = lineParams.mode;
     const auto control = lineParams.control;
-    if (mode.colorMode == 5) {
-        // Force-align character address in 16 bpp RGB mode
-        lineParams.charAddr &= ~0xF;
-    }
 
     const uint32 v = lineParams.texVStepper.Value();
 
@@ -1257,61 +1679,26 @@ FORCE_INLINE bool SoftwareVDPRenderer::VDP1PlotTexturedLine(CoordS32 coord1, Coo
     bool hasEndCode = false;
     int endCodeCount = useHighSpeedShrink ? std::numeric_limits<int>::min() : 0;
 
+    // Use decoded texels from the texture cache if available
+    const uint32 *texRow = nullptr;
+    if (lineParams.texture != nullptr && v < lineParams.charSizeV) {
+        texRow = VDP1GetTextureRow(*lineParams.texture, lineParams, v);
+    }
+
     auto readTexel = [&] {
         const uint32 u = uStepper.Value();
 
-        const uint32 charIndex = u + v * charSizeH;
-
-        auto processEndCode = [&](bool endCode) {
-            if (endCode && !mode.endCodeDisable) {
-                hasEndCode = true;
-                ++endCodeCount;
-            } else {
-                hasEndCode = false;
-            }
-        };
-
         // Read next texel
-        switch (mode.colorMode) {
-        case 0: // 4 bpp, 16 colors, bank mode
-            color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + (charIndex >> 1));
-            color = (color >> ((~u & 1) * 4)) & 0xF;
-            processEndCode(color == 0xF);
-            transparent = color == 0x0;
-            color |= lineParams.colorBank;
-            break;
-        case 1: // 4 bpp, 16 colors, lookup table mode
-            color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + (charIndex >> 1));
-            color = (color >> ((~u & 1) * 4)) & 0xF;
-            processEndCode(color == 0xF);
-            transparent = color == 0x0;
-            color = VDP1ReadRendererVRAM<uint16>(color * sizeof(uint16) + lineParams.colorBank);
-            break;
-        case 2: // 8 bpp, 64 colors, bank mode
-            color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + charIndex);
-            processEndCode(color == 0xFF);
-            transparent = color == 0x00;
-            color &= 0x3F;
-            color |= lineParams.colorBank;
-            break;
-        case 3: // 8 bpp, 128 colors, bank mode
-            color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + charIndex);
-            processEndCode(color == 0xFF);
-            transparent = color == 0x00;
-            color &= 0x7F;
-            color |= lineParams.colorBank;
-            break;
-        case 4: // 8 bpp, 256 colors, bank mode
-            color = VDP1ReadRendererVRAM<uint8>(lineParams.charAddr + charIndex);
-            processEndCode(color == 0xFF);
-            transparent = color == 0x00;
-            color |= lineParams.colorBank;
-            break;
-        case 5: // 16 bpp, 32768 colors, RGB mode
-            color = VDP1ReadRendererVRAM<uint16>(lineParams.charAddr + charIndex * sizeof(uint16));
-            processEndCode(color == 0x7FFF);
-            transparent = !bit::test<15>(color);
-            break;
+        const uint32 texel =
+            texRow != nullptr && u < charSizeH ? texRow[u] : VDP1DecodeTexel(lineParams, u, u + v * charSizeH);
+        color = texel;
+        transparent = texel & VDP1TextureCache::kTexelTransparent;
+
+        if ((texel & VDP1TextureCache::kTexelEndCode) && !mode.endCodeDisable) {
+            hasEndCode = true;
+            ++endCodeCount;
+        } else {
+            hasEndCode = false;
         }
     };
 
@@ -1426,6 +1813,10 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP1PlotTexturedQuad(uint32 cmdAddress, V
         .charAddr = charAddr,
         .charSizeH = charSizeH,
         .charSizeV = charSizeV,
+        .texVStepper = {},
+        .gouraudLeft = nullptr,
+        .gouraudRight = nullptr,
+        .texture = nullptr,
     };
 
     // Precompute color bank masks/shifts
@@ -1435,9 +1826,11 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP1PlotTexturedQuad(uint32 cmdAddress, V
     case 2: lineParams.colorBank &= 0xFFC0; break; // 8 bpp, 64 colors, bank mode
     case 3: lineParams.colorBank &= 0xFF80; break; // 8 bpp, 128 colors, bank mode
     case 4: lineParams.colorBank &= 0xFF00; break; // 8 bpp, 256 colors, bank mode
-    case 5: break;                                 // 16 bpp, 32768 colors, RGB mode
+    case 5: lineParams.charAddr &= ~0xF; break;    // 16 bpp, 32768 colors, RGB mode (force-aligned address)
     }
 
+    lineParams.texture = VDP1LookupTexture(lineParams);
+
     QuadStepper quad{coordA, coordB, coordC, coordD};
 
     if (mode.gouraudEnable) {
@@ -2300,25 +2693,23 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2CalcWindows(uint32 y, const VDP2Regs
         auto &bgParams = regs2.bgParams[i];
         auto &bgWindow = m_bgWindows[altField][i];
 
-        VDP2CalcWindow<altField>(y, regs2, bgParams.windowSet, std::span{bgWindow}.first(m_HRes));
+        VDP2CalcWindow<altField>(y, regs2, bgParams.windowSet, bgWindow);
     }
 
     // Calculate window for rotation parameters
-    VDP2CalcWindow<altField>(y, regs2, regs2.commonRotParams.windowSet,
-                             std::span{m_rotParamsWindow[altField]}.first(m_HRes));
+    VDP2CalcWindow<altField>(y, regs2, regs2.commonRotParams.windowSet, m_rotParamsWindow[altField]);
 
     // Calculate window for color calculations
-    VDP2CalcWindow<altField>(y, regs2, regs2.colorCalcParams.windowSet,
-                             std::span{m_colorCalcWindow[altField]}.first(m_HRes));
+    VDP2CalcWindow<altField>(y, regs2, regs2.colorCalcParams.windowSet, m_colorCalcWindow[altField]);
 }
 
 template <bool altField, bool hasSpriteWindow>
 FORCE_INLINE void SoftwareVDPRenderer::VDP2CalcWindow(uint32 y, const VDP2Regs &regs2,
                                                       const WindowSet<hasSpriteWindow> &windowSet,
-                                                      std::span<bool> windowState) {
+                                                      LineMask &windowState) {
     // If no windows are enabled, consider the pixel outside of windows
     if (!std::any_of(windowSet.enabled.begin(), windowSet.enabled.end(), std::identity{})) {
-        std::fill(windowState.begin(), windowState.end(), false);
+        windowState.Fill(false);
         return;
     }
 
@@ -2332,9 +2723,9 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2CalcWindow(uint32 y, const VDP2Regs &
 template <bool altField, bool logicOR, bool hasSpriteWindow>
 FORCE_INLINE void SoftwareVDPRenderer::VDP2CalcWindowLogic(uint32 y, const VDP2Regs &regs2,
                                                            const WindowSet<hasSpriteWindow> &windowSet,
-                                                           std::span<bool> windowState) {
+                                                           LineMask &windowState) {
     // Initialize to all inside if using AND logic or all outside if using OR logic
-    std::fill(windowState.begin(), windowState.end(), !logicOR);
+    windowState.Fill(!logicOR);
 
     const uint16 doubleV = regs2.TVMD.LSMDn == InterlaceMode::SingleDensity;
 
@@ -2370,7 +2761,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2CalcWindowLogic(uint32 y, const VDP2R
         if (sy < startY || sy > endY) {
             if (logicOR == inverted) {
                 // Cases 1 and 4
-                std::fill(windowState.begin(), windowState.end(), logicOR);
+                windowState.Fill(logicOR);
                 return;
             } else {
                 // Cases 2 and 3
@@ -2419,22 +2810,16 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2CalcWindowLogic(uint32 y, const VDP2R
         }
 
         // Fill in horizontal coordinate
+        const uint32 start = startX;
+        const uint32 end = std::min<uint32>(endX + 1, m_HRes);
         if (inverted != logicOR) {
             // - fill [startX..endX] with outside if using AND logic and inverted
             // - fill [startX..endX] with inside if using OR logic and not inverted
-            if (startX < windowState.size()) {
-                endX = std::min<sint16>(endX, windowState.size() - 1);
-                if (startX <= endX) {
-                    std::fill(windowState.begin() + startX, windowState.begin() + endX + 1, logicOR);
-                }
-            }
+            windowState.FillRange(start, end, logicOR);
         } else {
             // Fill complement of [startX..endX] with outside if using AND logic or inside if using OR logic
-            startX = std::min<sint16>(startX, windowState.size());
-            std::fill_n(windowState.begin(), startX, logicOR);
-            if (endX < windowState.size()) {
-                std::fill(windowState.begin() + endX + 1, windowState.end(), logicOR);
-            }
+            windowState.FillRange(0, std::min<uint32>(start, m_HRes), logicOR);
+            windowState.FillRange(end, m_HRes, logicOR);
         }
     }
 
@@ -2442,12 +2827,10 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2CalcWindowLogic(uint32 y, const VDP2R
     if constexpr (hasSpriteWindow) {
         if (windowSet.enabled[2]) {
             const bool inverted = windowSet.inverted[2];
-            for (uint32 x = 0; x < m_HRes; x++) {
-                if constexpr (logicOR) {
-                    windowState[x] |= m_spriteLayerAttrs[altField].shadowOrWindow[x] != inverted;
-                } else {
-                    windowState[x] &= m_spriteLayerAttrs[altField].shadowOrWindow[x] != inverted;
-                }
+            if constexpr (logicOR) {
+                windowState.Or(m_spriteLayerAttrs[altField].shadowOrWindow, inverted);
+            } else {
+                windowState.And(m_spriteLayerAttrs[altField].shadowOrWindow, inverted);
             }
         }
     }
@@ -2541,12 +2924,10 @@ void SoftwareVDPRenderer::VDP2DrawLine(uint32 y, bool altField) {
     // Calculate window for sprite layer
     if (altField) {
         VDP2CalcWindow<true>(VDP2GetY<deinterlace>(y, regs2) ^ static_cast<uint32>(altField), regs2,
-                             regs2.spriteParams.windowSet,
-                             std::span{m_spriteLayerAttrs[altField].window}.first(m_HRes));
+                             regs2.spriteParams.windowSet, m_spriteLayerAttrs[altField].window);
     } else {
         VDP2CalcWindow<false>(VDP2GetY<deinterlace>(y, regs2) ^ static_cast<uint32>(altField), regs2,
-                              regs2.spriteParams.windowSet,
-                              std::span{m_spriteLayerAttrs[altField].window}.first(m_HRes));
+                              regs2.spriteParams.windowSet, m_spriteLayerAttrs[altField].window);
     }
 
     // Draw sprite layer
@@ -2618,15 +2999,16 @@ NO_INLINE void SoftwareVDPRenderer::VDP2DrawSpriteLayer(uint32 y, const VDP2Regs
     const bool doubleDensity = regs2.TVMD.LSMDn == InterlaceMode::DoubleDensity;
 
     const SpriteParams &params = regs2.spriteParams;
-    auto &layerOut = m_layerOutputs[altField][0];
+    auto &layerOut = VDP2GetLayerOutputs(altField)[0];
     auto &layerAttrs = m_spriteLayerAttrs[altField];
 
     const uint8 fbIndex = VDP1GetDisplayFBIndex();
-    const auto &spriteFB = doubleDensity && altField ? m_altSpriteFB[fbIndex] : m_state.spriteFB[fbIndex];
+    const auto &spriteFB = doubleDensity && altField ? (*m_altSpriteFB)[fbIndex] : m_state.spriteFB[fbIndex];
 
-    [[maybe_unused]] auto &meshLayerOut = m_meshLayerOutput[altField];
+    // The mesh buffers only exist while transparent meshes are enabled
+    [[maybe_unused]] auto &meshLayerOut = transparentMeshes ? (*m_meshLayerOutput)[altField] : layerOut;
     [[maybe_unused]] auto &meshLayerAttrs = m_meshLayerAttrs[altField];
-    [[maybe_unused]] const auto &meshFB = m_meshFB[altField][fbIndex];
+    [[maybe_unused]] const auto &meshFB = transparentMeshes ? (*m_meshFB)[altField][fbIndex] : spriteFB;
 
     for (uint32 x = 0; x < maxX; x++) {
         const uint32 xx = x << xOutputShift;
@@ -2637,16 +3019,16 @@ NO_INLINE void SoftwareVDPRenderer::VDP2DrawSpriteLayer(uint32 y, const VDP2Regs
             const auto &coord = rotParamOut.spriteCoords[x];
             if (coord.x() < 0 || coord.x() >= regs1.fbSizeH || coord.y() < 0 || coord.y() >= regs1.fbSizeV) {
                 layerOut.pixels.priority[xx] = 0;
-                layerAttrs.shadowOrWindow[xx] = false;
-                layerAttrs.specialType[xx] = SpriteData::Special::Transparent;
+                layerAttrs.shadowOrWindow.Set(xx, false);
+                layerAttrs.SetSpecialType(xx, SpriteData::Special::Transparent);
                 if (doubleResH) {
                     layerOut.pixels.CopyPixel(xx, xx + 1);
                     layerAttrs.CopyAttrs(xx, xx + 1);
                 }
                 if constexpr (transparentMeshes) {
                     meshLayerOut.pixels.priority[xx] = 0;
-                    meshLayerAttrs.shadowOrWindow[xx] = false;
-                    layerAttrs.specialType[xx] = SpriteData::Special::Transparent;
+                    meshLayerAttrs.shadowOrWindow.Set(xx, false);
+                    layerAttrs.SetSpecialType(xx, SpriteData::Special::Transparent);
                     if (doubleResH) {
                         meshLayerOut.pixels.CopyPixel(xx, xx + 1);
                         meshLayerAttrs.CopyAttrs(xx, xx + 1);
@@ -2689,14 +3071,14 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawSpritePixel(uint32 x, const VDP2R
     // - Opaque pixels drawn on transparent pixels will become translucent and enable the transparentMesh attribute.
     // Transparent mesh pixels are handled separately from the rest of the rendering pipeline.
 
-    auto &layerOut = applyMesh ? m_meshLayerOutput[altField] : m_layerOutputs[altField][0];
+    auto &layerOut = applyMesh ? (*m_meshLayerOutput)[altField] : VDP2GetLayerOutputs(altField)[0];
     auto &layerAttrs = applyMesh ? m_meshLayerAttrs[altField] : m_spriteLayerAttrs[altField];
 
     // NOTE: intentionally using the base sprite layer here as the windows are not computed for the mesh layer
     if (m_spriteLayerAttrs[altField].window[x]) {
         layerOut.pixels.priority[x] = 0;
-        layerAttrs.shadowOrWindow[x] = false;
-        layerAttrs.specialType[x] = SpriteData::Special::Transparent;
+        layerAttrs.shadowOrWindow.Set(x, false);
+        layerAttrs.SetSpecialType(x, SpriteData::Special::Transparent);
         return;
     }
 
@@ -2712,15 +3094,15 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawSpritePixel(uint32 x, const VDP2R
             if (params.type >= 8) {
                 if (bit::extract<0, 7>(spriteDataValue) == 0) {
                     layerOut.pixels.priority[x] = 0;
-                    layerAttrs.shadowOrWindow[x] = false;
-                    layerAttrs.specialType[x] = SpriteData::Special::Transparent;
+                    layerAttrs.shadowOrWindow.Set(x, false);
+                    layerAttrs.SetSpecialType(x, SpriteData::Special::Transparent);
                     return;
                 }
             } else if (params.type >= 2) {
                 if (params.useSpriteWindow && bit::extract<0, 14>(spriteDataValue) == 0) {
                     layerOut.pixels.priority[x] = 0;
-                    layerAttrs.shadowOrWindow[x] = false;
-                    layerAttrs.specialType[x] = SpriteData::Special::Transparent;
+                    layerAttrs.shadowOrWindow.Set(x, false);
+                    layerAttrs.SetSpecialType(x, SpriteData::Special::Transparent);
                     return;
                 }
             }
@@ -2730,8 +3112,8 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawSpritePixel(uint32 x, const VDP2R
             layerOut.pixels.specialColorCalc[x] = false;
 
             layerAttrs.colorCalcRatio[x] = params.colorCalcRatios[0];
-            layerAttrs.shadowOrWindow[x] = false;
-            layerAttrs.specialType[x] = SpriteData::Special::Normal;
+            layerAttrs.shadowOrWindow.Set(x, false);
+            layerAttrs.SetSpecialType(x, SpriteData::Special::Normal);
             return;
         }
     }
@@ -2743,8 +3125,8 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawSpritePixel(uint32 x, const VDP2R
     if (params.useSpriteWindow && params.spriteWindowEnabled &&
         spriteData.shadowOrWindow != params.spriteWindowInverted) {
         layerOut.pixels.priority[x] = 0;
-        layerAttrs.shadowOrWindow[x] = true;
-        layerAttrs.specialType[x] = SpriteData::Special::Transparent;
+        layerAttrs.shadowOrWindow.Set(x, true);
+        layerAttrs.SetSpecialType(x, SpriteData::Special::Transparent);
         return;
     }
 
@@ -2758,8 +3140,8 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawSpritePixel(uint32 x, const VDP2R
     layerOut.pixels.specialColorCalc[x] = true;
 
     layerAttrs.colorCalcRatio[x] = params.colorCalcRatios[spriteData.colorCalcRatio];
-    layerAttrs.shadowOrWindow[x] = spriteData.shadowOrWindow;
-    layerAttrs.specialType[x] = spriteData.special;
+    layerAttrs.shadowOrWindow.Set(x, spriteData.shadowOrWindow);
+    layerAttrs.SetSpecialType(x, spriteData.special);
 }
 
 template <uint32 bgIndex, bool deinterlace>
@@ -2767,7 +3149,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawNormalBG(const VDP2Regs &regs2, u
     static_assert(bgIndex < 4, "Invalid NBG index");
 
     using FnDraw = void (SoftwareVDPRenderer::*)(const VDP2Regs &, const BGParams &, LayerOutput &,
-                                                 const NBGLayerState &, VRAMFetcher &, std::span<const bool>, bool);
+                                                 const NBGLayerState &, VRAMFetcher &, const LineMask &, bool);
 
     // Lookup table of scroll BG drawing functions
     // Indexing: [charMode][fourCellChar][colorFormat][colorMode]
@@ -2827,9 +3209,9 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawNormalBG(const VDP2Regs &regs2, u
         return;
     }
 
-    LayerOutput &layerOut = m_layerOutputs[altField][bgIndex + 2];
+    LayerOutput &layerOut = VDP2GetLayerOutputs(altField)[bgIndex + 2];
     VRAMFetcher &vramFetcher = m_vramFetchers[altField][bgIndex];
-    auto windowState = std::span<const bool>{m_bgWindows[altField][bgIndex + 1]}.first(m_HRes);
+    const LineMask &windowState = m_bgWindows[altField][bgIndex + 1];
 
     const uint32 cf = static_cast<uint32>(bgParams.colorFormat);
     if (bgParams.bitmap) {
@@ -2851,9 +3233,9 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawRotationBG(const VDP2Regs &regs2,
     static_assert(bgIndex < 2, "Invalid RBG index");
 
     using FnDrawScroll = void (SoftwareVDPRenderer::*)(const VDP2Regs &, const BGParams &, LayerOutput &, VRAMFetcher &,
-                                                       std::span<const bool>, bool);
+                                                       const LineMask &, bool);
     using FnDrawBitmap =
-        void (SoftwareVDPRenderer::*)(const VDP2Regs &, const BGParams &, LayerOutput &, std::span<const bool>, bool);
+        void (SoftwareVDPRenderer::*)(const VDP2Regs &, const BGParams &, LayerOutput &, const LineMask &, bool);
 
     // Lookup table of scroll BG drawing functions
     // Indexing: [charMode][fourCellChar][colorFormat][colorMode]
@@ -2904,9 +3286,9 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2DrawRotationBG(const VDP2Regs &regs2,
     }
 
     const BGParams &bgParams = regs2.bgParams[bgIndex];
-    LayerOutput &layerOut = m_layerOutputs[altField][bgIndex + 1];
+    LayerOutput &layerOut = VDP2GetLayerOutputs(altField)[bgIndex + 1];
     VRAMFetcher &vramFetcher = m_vramFetchers[altField][bgIndex + 4];
-    auto windowState = std::span<const bool>{m_bgWindows[altField][bgIndex]}.first(m_HRes);
+    const LineMask &windowState = m_bgWindows[altField][bgIndex];
 
     const uint32 cf = static_cast<uint32>(bgParams.colorFormat);
     if (bgParams.bitmap) {
@@ -3804,12 +4186,12 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
                                                               uint8(LYR_Back ^ 7)};
     std::fill_n(layerSortOrder.begin(), m_HRes, kLayerSortOrderInit);
 
-    for (uint32 layer = 0; layer < m_layerOutputs[altField].size(); layer++) {
+    for (uint32 layer = 0; layer < VDP2GetLayerOutputs(altField).size(); layer++) {
         if (!state2.layerEnabled[layer]) {
             continue;
         }
 
-        const LayerOutput &output = m_layerOutputs[altField][layer];
+        const LayerOutput &output = VDP2GetLayerOutputs(altField)[layer];
 
         if (AllZeroU8(std::span{output.pixels.priority}.first(m_HRes))) {
             // All priorities are zero
@@ -3838,16 +4220,20 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
         };
 
         if (layer == LYR_Sprite) {
-            for (uint32 x = 0; x < m_HRes; x++) {
-                const uint8 priority = output.pixels.priority[x];
-                if (priority == 0) {
-                    continue;
-                }
-                if (spriteLayerAttrs.specialType[x] != SpriteData::Special::Normal) {
-                    continue;
-                }
+            // Only normal sprite pixels take part in sorting
+            for (uint32 i = 0; i * 64u < m_HRes; i++) {
+                for (uint64 normal = spriteLayerAttrs.NormalWord(i); normal != 0; normal &= normal - 1) {
+                    const uint32 x = i * 64u + std::countr_zero(normal);
+                    if (x >= m_HRes) {
+                        break;
+                    }
+                    const uint8 priority = output.pixels.priority[x];
+                    if (priority == 0) {
+                        continue;
+                    }
 
-                push(x, priority);
+                    push(x, priority);
+                }
             }
         } else {
             for (uint32 x = 0; x < m_HRes; x++) {
@@ -3874,26 +4260,29 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
         std::fill_n(scanline_meshLayers.begin(), m_HRes, 0xFF);
 
         if (state2.layerEnabled[0] &&
-            !AllZeroU8(std::span{m_meshLayerOutput[altField].pixels.priority}.first(m_HRes))) {
+            !AllZeroU8(std::span{(*m_meshLayerOutput)[altField].pixels.priority}.first(m_HRes))) {
 
-            for (uint32 x = 0; x < m_HRes; x++) {
-                const uint8 priority = m_meshLayerOutput[altField].pixels.priority[x];
-                if (priority == 0) {
-                    continue;
-                }
-                if (m_meshLayerAttrs[altField].specialType[x] != SpriteData::Special::Normal) {
-                    continue;
-                }
-
-                const std::array<uint8, 3> &layerPrios = scanline_layerPrios[x];
-                for (int i = 0; i < 3; i++) {
-                    // The sprite layer has the highest priority on ties, so the priority check can be simplified.
-                    // Sprite pixels drawn of top of mesh pixels erase the corresponding pixels from the mesh layer,
-                    // therefore the mesh layer can be considered always on top of the sprite layer.
-                    if (priority >= layerPrios[i]) {
-                        scanline_meshLayers[x] = i;
+            for (uint32 w = 0; w * 64u < m_HRes; w++) {
+                for (uint64 normal = m_meshLayerAttrs[altField].NormalWord(w); normal != 0; normal &= normal - 1) {
+                    const uint32 x = w * 64u + std::countr_zero(normal);
+                    if (x >= m_HRes) {
                         break;
                     }
+                    const uint8 priority = (*m_meshLayerOutput)[altField].pixels.priority[x];
+                    if (priority == 0) {
+                        continue;
+                    }
+
+                    const std::array<uint8, 3> &layerPrios = scanline_layerPrios[x];
+                    for (int i = 0; i < 3; i++) {
+                        // The sprite layer has the highest priority on ties, so the priority check can be simplified.
+                        // Sprite pixels drawn of top of mesh pixels erase the corresponding pixels from the mesh
+                        // layer, therefore the mesh layer can be considered always on top of the sprite layer.
+                        if (priority >= layerPrios[i]) {
+                            scanline_meshLayers[x] = i;
+                            break;
+                        }
+                    }
                 }
             }
         }
@@ -3904,7 +4293,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
         if (layer == LYR_Back) {
             return state2.lineBackLayerState.backColor;
         } else {
-            return m_layerOutputs[altField][layer].pixels.color[x];
+            return VDP2GetLayerOutputs(altField)[layer].pixels.color[x];
         }
     };
 
@@ -3917,7 +4306,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
             if (!spriteParams.colorCalcEnable) {
                 return false;
             }
-            const auto &pixels = m_layerOutputs[altField][LYR_Sprite].pixels;
+            const auto &pixels = VDP2GetLayerOutputs(altField)[LYR_Sprite].pixels;
             if (restrictedColorCalc && pixels.specialColorCalc[x]) {
                 return false;
             }
@@ -3929,7 +4318,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
             case PriorityLessThanOrEqual: return pixelPriority <= spriteParams.colorCalcValue;
             case PriorityEqual: return pixelPriority == spriteParams.colorCalcValue;
             case PriorityGreaterThanOrEqual: return pixelPriority >= spriteParams.colorCalcValue;
-            case MsbEqualsOne: return m_layerOutputs[altField][LYR_Sprite].pixels.color[x].msb == 1;
+            case MsbEqualsOne: return VDP2GetLayerOutputs(altField)[LYR_Sprite].pixels.color[x].msb == 1;
             default: util::unreachable();
             }
         } else if (layer == LYR_Back) {
@@ -3952,53 +4341,76 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
     auto &layer0BlendMeshLayer = composeLineBuffers.layer0BlendMeshLayer;
     auto &layer0ShadowEnabled = composeLineBuffers.layer0ShadowEnabled;
     auto &layer0ColorOffsetEnabled = composeLineBuffers.layer0ColorOffsetEnabled;
-    for (uint32 x = 0; x < m_HRes; x++) {
-        const LayerIndex layer = scanline_layers[x][0];
 
-        // Color
-        layer0Pixels[x] = getLayerColor(layer, x);
+    // Sprite pixels that may cast shadows: normal shadow patterns, and MSB shadows if the sprite window is not in use
+    LineMask shadowCandidates = spriteLayerAttrs.specialShadow;
+    if (!regs2.spriteParams.useSpriteWindow) {
+        shadowCandidates.Or(spriteLayerAttrs.shadowOrWindow, false);
+    }
 
-        // Color calculation
-        if constexpr (transparentMeshes) {
-            layer0BlendMeshLayer[x] = scanline_meshLayers[x] == 0;
-        }
-        if (m_colorCalcWindow[altField][x]) {
-            layer0ColorCalcEnabled[x] = false;
-        } else if (!isColorCalcEnabled(layer, x)) {
-            layer0ColorCalcEnabled[x] = false;
-        } else {
-            switch (layer) {
-            case LYR_Back: [[fallthrough]];
-            case LYR_Sprite: layer0ColorCalcEnabled[x] = true; break;
-            default: layer0ColorCalcEnabled[x] = m_layerOutputs[altField][layer].pixels.specialColorCalc[x]; break;
-            }
+    // Process 64 pixels at a time to test the window and shadow masks one word at a time
+    const auto &spritePixels = VDP2GetLayerOutputs(altField)[LYR_Sprite].pixels;
+    for (uint32 i = 0; i * 64u < m_HRes; i++) {
+        const uint32 start = i * 64u;
+        const uint32 end = std::min(start + 64u, m_HRes);
+        const uint64 colorCalcWindowWord = m_colorCalcWindow[altField].words[i];
+        const uint64 shadowCandidatesWord = shadowCandidates.words[i];
+        const uint64 shadowOrWindowWord = spriteLayerAttrs.shadowOrWindow.words[i];
+
+        // Most lines have no shadows at all
+        if (shadowCandidatesWord == 0) {
+            std::fill(layer0ShadowEnabled.begin() + start, layer0ShadowEnabled.begin() + end, false);
         }
 
-        // Shadow
-        if (m_layerOutputs[altField][LYR_Sprite].pixels.priority[x] < scanline_layerPrios[x][0]) {
-            // Sprite layer is beneath top layer
-            layer0ShadowEnabled[x] = false;
-        } else {
-            // Sprite layer doesn't have shadow
-            const bool isNormalShadow = spriteLayerAttrs.specialType[x] == SpriteData::Special::Shadow;
-            const bool isMSBShadow = !regs2.spriteParams.useSpriteWindow && spriteLayerAttrs.shadowOrWindow[x];
-            if (!isNormalShadow && !isMSBShadow) {
-                layer0ShadowEnabled[x] = false;
+        for (uint32 x = start; x < end; x++) {
+            const uint64 bit = 1ull << (x & 63u);
+            const LayerIndex layer = scanline_layers[x][0];
+
+            // Color
+            layer0Pixels[x] = getLayerColor(layer, x);
+
+            // Color calculation
+            if constexpr (transparentMeshes) {
+                layer0BlendMeshLayer[x] = scanline_meshLayers[x] == 0;
+            }
+            if (colorCalcWindowWord & bit) {
+                layer0ColorCalcEnabled[x] = false;
+            } else if (!isColorCalcEnabled(layer, x)) {
+                layer0ColorCalcEnabled[x] = false;
             } else {
                 switch (layer) {
-                case LYR_Sprite: layer0ShadowEnabled[x] = spriteLayerAttrs.shadowOrWindow[x]; break;
-                case LYR_Back: layer0ShadowEnabled[x] = regs2.backScreenParams.shadowEnable; break;
-                default: layer0ShadowEnabled[x] = regs2.bgParams[layer - LYR_RBG0].shadowEnable; break;
+                case LYR_Back: [[fallthrough]];
+                case LYR_Sprite: layer0ColorCalcEnabled[x] = true; break;
+                default:
+                    layer0ColorCalcEnabled[x] = VDP2GetLayerOutputs(altField)[layer].pixels.specialColorCalc[x];
+                    break;
                 }
             }
-        }
 
-        // Color offset
-        if (!regs2.colorOffsetEnable[layer]) {
-            layer0ColorOffsetEnabled[x] = false;
-        } else {
-            const auto &colorOffset = regs2.colorOffset[regs2.colorOffsetSelect[layer]];
-            layer0ColorOffsetEnabled[x] = colorOffset.nonZero;
+            // Shadow
+            if (shadowCandidatesWord & bit) {
+                if (spritePixels.priority[x] < scanline_layerPrios[x][0]) {
+                    // Sprite layer is beneath top layer
+                    layer0ShadowEnabled[x] = false;
+                } else {
+                    switch (layer) {
+                    case LYR_Sprite: layer0ShadowEnabled[x] = (shadowOrWindowWord & bit) != 0; break;
+                    case LYR_Back: layer0ShadowEnabled[x] = regs2.backScreenParams.shadowEnable; break;
+                    default: layer0ShadowEnabled[x] = regs2.bgParams[layer - LYR_RBG0].shadowEnable; break;
+                    }
+                }
+            } else if (shadowCandidatesWord != 0) {
+                // Sprite layer doesn't have shadow
+                layer0ShadowEnabled[x] = false;
+            }
+
+            // Color offset
+            if (!regs2.colorOffsetEnable[layer]) {
+                layer0ColorOffsetEnabled[x] = false;
+            } else {
+                const auto &colorOffset = regs2.colorOffset[regs2.colorOffsetSelect[layer]];
+                layer0ColorOffsetEnabled[x] = colorOffset.nonZero;
+            }
         }
     }
 
@@ -4072,7 +4484,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
                 mask[x] = scanline_layers[x][0] == colorGradLayer || scanline_layers[x][1] == colorGradLayer;
             }
 
-            auto &input = m_layerOutputs[altField][colorGradLayer].pixels.color;
+            auto &input = VDP2GetLayerOutputs(altField)[colorGradLayer].pixels.color;
             auto &output = composeLineBuffers.colorGradLayerColors;
 
             // TODO: should pixels 0 and 1 pull from pixels -1 and -2?
@@ -4108,7 +4520,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
             // TODO: apply color calculation effects
             if constexpr (transparentMeshes) {
                 Color888AverageMasked(std::span{layer2Pixels}.first(m_HRes), layer2BlendMeshLayer, layer2Pixels,
-                                      m_meshLayerOutput[altField].pixels.color);
+                                      (*m_meshLayerOutput)[altField].pixels.color);
             }
 
             Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer1ColorCalcEnabled, layer1Pixels,
@@ -4133,7 +4545,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
         // TODO: apply color calculation effects
         if constexpr (transparentMeshes) {
             Color888AverageMasked(std::span{layer1Pixels}.first(m_HRes), layer1BlendMeshLayer, layer1Pixels,
-                                  m_meshLayerOutput[altField].pixels.color);
+                                  (*m_meshLayerOutput)[altField].pixels.color);
         }
 
         // Blend layer 0 and layer 1
@@ -4194,11 +4606,11 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
     // Blend layer 0 with sprite mesh layer colors
     if constexpr (transparentMeshes) {
         const SpriteParams &spriteParams = regs2.spriteParams;
-        std::span<Color888> meshOut = std::span{m_meshLayerOutput[altField].pixels.color}.first(m_HRes);
+        std::span<Color888> meshOut = std::span{(*m_meshLayerOutput)[altField].pixels.color}.first(m_HRes);
         if (spriteParams.colorCalcEnable) {
             std::array<bool, kMaxResH> &layer0MeshColorCalcEnabled = composeLineBuffers.layer0MeshColorCalcEnabled;
             for (uint32 x = 0; x < m_HRes; ++x) {
-                const uint8 pixelPriority = m_meshLayerOutput[altField].pixels.priority[x];
+                const uint8 pixelPriority = (*m_meshLayerOutput)[altField].pixels.priority[x];
 
                 using enum SpriteColorCalculationCondition;
                 switch (spriteParams.colorCalcCond) {
@@ -4210,7 +4622,7 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
                     layer0MeshColorCalcEnabled[x] = pixelPriority >= spriteParams.colorCalcValue;
                     break;
                 case MsbEqualsOne:
-                    layer0MeshColorCalcEnabled[x] = m_layerOutputs[altField][LYR_Sprite].pixels.color[x].msb == 1;
+                    layer0MeshColorCalcEnabled[x] = VDP2GetLayerOutputs(altField)[LYR_Sprite].pixels.color[x].msb == 1;
                     break;
                 default: util::unreachable();
                 }
@@ -4221,12 +4633,12 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
                 meshOut = std::span{composeLineBuffers.meshTempColors}.first(m_HRes);
                 if (colorCalcParams.useAdditiveBlend) {
                     // Saturated add
-                    Color888SatAddMasked(meshOut, layer0MeshColorCalcEnabled, m_meshLayerOutput[altField].pixels.color,
+                    Color888SatAddMasked(meshOut, layer0MeshColorCalcEnabled, (*m_meshLayerOutput)[altField].pixels.color,
                                          framebufferOutput);
                 } else {
                     // Alpha composite
                     Color888CompositeRatioPerPixelMasked(meshOut, layer0MeshColorCalcEnabled,
-                                                         m_meshLayerOutput[altField].pixels.color, framebufferOutput,
+                                                         (*m_meshLayerOutput)[altField].pixels.color, framebufferOutput,
                                                          m_meshLayerAttrs[altField].colorCalcRatio);
                 }
             }
@@ -4284,13 +4696,17 @@ FORCE_INLINE void SoftwareVDPRenderer::VDP2ComposeLine(uint32 y, const VDP2Regs
                     switch (layerLevel) {
                     case LYR_Back: overlayColor = state2.lineBackLayerState.backColor; break;
                     case LYR_LineColor: overlayColor = state2.lineBackLayerState.lineColor; break;
-                    case 8 /*transparent meshes*/: overlayColor = m_meshLayerOutput[altField].pixels.color[x]; break;
+                    case 8 /*transparent meshes*/:
+                        if constexpr (transparentMeshes) {
+                            overlayColor = (*m_meshLayerOutput)[altField].pixels.color[x];
+                        }
+                        break;
                     case 9 /*gradation screen*/:
                         if (colorGradEnabled) {
                             overlayColor = composeLineBuffers.colorGradLayerColors[x];
                         }
                         break;
-                    default: overlayColor = m_layerOutputs[altField][layerLevel].pixels.color[x];
+                    default: overlayColor = VDP2GetLayerOutputs(altField)[layerLevel].pixels.color[x];
                     }
                     break;
                 }
@@ -4390,7 +4806,7 @@ template <SoftwareVDPRenderer::CharacterMode charMode, bool fourCellChar, ColorF
           bool useVCellScroll, bool deinterlace>
 NO_INLINE void SoftwareVDPRenderer::VDP2DrawNormalScrollBG(const VDP2Regs &regs2, const BGParams &bgParams,
                                                            LayerOutput &layerOut, const NBGLayerState &bgState,
-                                                           VRAMFetcher &vramFetcher, std::span<const bool> windowState,
+                                                           VRAMFetcher &vramFetcher, const LineMask &windowState,
                                                            bool altField) {
     const bool altLine = deinterlace && altField && regs2.TVMD.LSMDn == InterlaceMode::DoubleDensity;
     uint32 fracScrollX = bgState.fracScrollX + bgParams.scrollAmountH;
@@ -4493,7 +4909,7 @@ NO_INLINE void SoftwareVDPRenderer::VDP2DrawNormalScrollBG(const VDP2Regs &regs2
 template <ColorFormat colorFormat, uint32 colorMode, bool useVCellScroll, bool deinterlace>
 NO_INLINE void SoftwareVDPRenderer::VDP2DrawNormalBitmapBG(const VDP2Regs &regs2, const BGParams &bgParams,
                                                            LayerOutput &layerOut, const NBGLayerState &bgState,
-                                                           VRAMFetcher &vramFetcher, std::span<const bool> windowState,
+                                                           VRAMFetcher &vramFetcher, const LineMask &windowState,
                                                            bool altField) {
     const bool doubleDensity = regs2.TVMD.LSMDn == InterlaceMode::DoubleDensity;
     const bool altLine = deinterlace && altField && doubleDensity && !bgParams.lineScrollYEnable;
@@ -4516,6 +4932,13 @@ NO_INLINE void SoftwareVDPRenderer::VDP2DrawNormalBitmapBG(const VDP2Regs &regs2
         return bgState.vcellScrollDelay ? prevValue : vramFetcher.lastVCellScroll;
     };
 
+    // Lines without mosaic, vertical cell scrolling or horizontal zoom read consecutive dots from VRAM
+    if (!bgParams.mosaicEnable && !vcellScrollEnable && bgState.scrollIncH == 0x100) {
+        VDP2DrawNormalBitmapLine<colorFormat, colorMode>(regs2, bgParams, layerOut, vramFetcher, windowState,
+                                                         fracScrollX >> 8u, fracScrollY >> 8u, altField);
+        return;
+    }
+
     uint32 mosaicCounterX = 0;
     uint32 vcellScrollY = 0;
     uint32 vcellScrollX = fracScrollX >> (8u + 3u);
@@ -4570,11 +4993,243 @@ NO_INLINE void SoftwareVDPRenderer::VDP2DrawNormalBitmapBG(const VDP2Regs &regs2
     }
 }
 
+// Converts a run of big-endian RGB555 dots into RGB888 colors.
+FORCE_INLINE static void ConvertRGB555to888BE(const uint8 *src, Color888 *dst, uint32 count) {
+    uint32 i = 0;
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+    #if defined(__SSE2__)
+    // 8 at a time
+    const __m128i maskR = _mm_set1_epi32(0x001F);
+    const __m128i maskG = _mm_set1_epi32(0x03E0);
+    const __m128i maskB = _mm_set1_epi32(0x7C00);
+    const __m128i maskMSB = _mm_set1_epi32(0x8000);
+    auto expand = [&](__m128i dots) {
+        const __m128i r = _mm_slli_epi32(_mm_and_si128(dots, maskR), 3);
+        const __m128i g = _mm_slli_epi32(_mm_and_si128(dots, maskG), 6);
+        const __m128i b = _mm_slli_epi32(_mm_and_si128(dots, maskB), 9);
+        const __m128i msb = _mm_slli_epi32(_mm_and_si128(dots, maskMSB), 16);
+        return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, msb));
+    };
+    for (; i + 8 <= count; i += 8) {
+        __m128i dots = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&src[i * sizeof(uint16)]));
+
+        // Swap bytes
+        dots = _mm_or_si128(_mm_slli_epi16(dots, 8), _mm_srli_epi16(dots, 8));
+
+        const __m128i lo = _mm_unpacklo_epi16(dots, _mm_setzero_si128());
+        const __m128i hi = _mm_unpackhi_epi16(dots, _mm_setzero_si128());
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dst[i + 0]), expand(lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dst[i + 4]), expand(hi));
+    }
+    #endif
+
+#elif defined(_M_ARM64) || defined(__aarch64__)
+    // 8 at a time
+    auto expand = [](uint32x4_t dots) {
+        const uint32x4_t r = vshlq_n_u32(vandq_u32(dots, vdupq_n_u32(0x001F)), 3);
+        const uint32x4_t g = vshlq_n_u32(vandq_u32(dots, vdupq_n_u32(0x03E0)), 6);
+        const uint32x4_t b = vshlq_n_u32(vandq_u32(dots, vdupq_n_u32(0x7C00)), 9);
+        const uint32x4_t msb = vshlq_n_u32(vandq_u32(dots, vdupq_n_u32(0x8000)), 16);
+        return vorrq_u32(vorrq_u32(r, g), vorrq_u32(b, msb));
+    };
+    for (; i + 8 <= count; i += 8) {
+        // Load and swap bytes
+        const uint16x8_t dots = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(&src[i * sizeof(uint16)])));
+
+        vst1q_u32(reinterpret_cast<uint32 *>(&dst[i + 0]), expand(vmovl_u16(vget_low_u16(dots))));
+        vst1q_u32(reinterpret_cast<uint32 *>(&dst[i + 4]), expand(vmovl_u16(vget_high_u16(dots))));
+    }
+#endif
+
+    for (; i < count; i++) {
+        dst[i] = ConvertRGB555to888(Color555{.u16 = util::ReadBE<uint16>(&src[i * sizeof(uint16)])});
+    }
+}
+
+template <ColorFormat colorFormat, uint32 colorMode>
+NO_INLINE void SoftwareVDPRenderer::VDP2DrawNormalBitmapLine(const VDP2Regs &regs2, const BGParams &bgParams,
+                                                             LayerOutput &layerOut, VRAMFetcher &vramFetcher,
+                                                             const LineMask &windowState, uint32 scrollX,
+                                                             uint32 scrollY, bool altField) {
+    static_assert(static_cast<uint32>(colorFormat) <= 4, "Invalid xxCHCN value");
+
+    auto &pixels = layerOut.pixels;
+
+    // Find the range of pixels outside the window; only those are fetched
+    uint32 firstX = 0;
+    while (firstX < m_HRes && windowState[firstX]) {
+        pixels.priority[firstX] = 0;
+        firstX++;
+    }
+    if (firstX >= m_HRes) {
+        return;
+    }
+    uint32 lastX = m_HRes - 1;
+    while (windowState[lastX]) {
+        lastX--;
+    }
+
+    // Bitmap data wraps around infinitely
+    const uint32 sizeH = bgParams.bitmapSizeH;
+    const uint32 lineOffset = (scrollY & (bgParams.bitmapSizeV - 1)) * sizeH;
+
+    auto dotAddress = [&](uint32 x) -> uint32 {
+        const uint32 dotOffset = ((scrollX + x) & (sizeH - 1)) + lineOffset;
+        if constexpr (colorFormat == ColorFormat::Palette16) {
+            return bgParams.bitmapBaseAddress + (dotOffset >> 1u);
+        } else if constexpr (colorFormat == ColorFormat::Palette256) {
+            return bgParams.bitmapBaseAddress + dotOffset;
+        } else if constexpr (colorFormat == ColorFormat::Palette2048 || colorFormat == ColorFormat::RGB555) {
+            return bgParams.bitmapBaseAddress + dotOffset * sizeof(uint16);
+        } else { // colorFormat == ColorFormat::RGB888
+            return bgParams.bitmapBaseAddress + dotOffset * sizeof(uint32);
+        }
+    };
+
+    // The per-pixel path reuses the fetcher's character data when the first fetch lands on the same 8-byte chunk as
+    // the last fetch of the previous line, so that chunk must come from the fetcher rather than VRAM.
+    const uint32 firstChunk = dotAddress(firstX) & ~7u;
+    const uint32 lastChunk = dotAddress(lastX) & ~7u;
+    const bool reuseFirstChunk = firstChunk == vramFetcher.charDataAddress;
+
+    // Precompute per-line values for the special color calculation flag and priority
+    const auto &specFuncCode = regs2.specialFunctionCodes[bgParams.specialFunctionSelect];
+    const bool specColorCalc = bgParams.supplBitmapSpecialColorCalc;
+    const bool specPriority = bgParams.supplBitmapSpecialPriority;
+    auto getSpecialColorCalcFlag = [&](uint8 specColorCode, bool colorMSB) {
+        using enum SpecialColorCalcMode;
+        switch (bgParams.specialColorCalcMode) {
+        case PerScreen: return bgParams.colorCalcEnable;
+        case PerCharacter: return bgParams.colorCalcEnable && specColorCalc;
+        case PerDot: return bgParams.colorCalcEnable && specColorCalc && specFuncCode.colorMatches[specColorCode];
+        case ColorDataMSB: return bgParams.colorCalcEnable && colorMSB;
+        }
+        util::unreachable();
+    };
+
+    uint8 basePriority = bgParams.priorityNumber;
+    if (bgParams.priorityMode == PriorityMode::PerCharacter) {
+        basePriority &= ~1;
+        basePriority |= (uint8)specPriority;
+    } else if (bgParams.priorityMode == PriorityMode::PerDot) {
+        basePriority &= ~1;
+    }
+    const bool perDotPriority = bgParams.priorityMode == PriorityMode::PerDot && specPriority;
+
+    auto &vram = VDP2GetRendererVRAM();
+
+    // Raw dot data for one segment, staged in 8-byte chunks
+    auto &lineData = m_bitmapLineBuffers[altField].lineData;
+    auto &rgbColors = m_bitmapLineBuffers[altField].rgbColors;
+
+    // Draw the line in segments of consecutive dots, splitting where the bitmap wraps around horizontally
+    uint32 x = firstX;
+    while (x <= lastX) {
+        const uint32 dotX = (scrollX + x) & (sizeH - 1);
+        const uint32 count = std::min(lastX + 1 - x, sizeH - dotX);
+
+        // Stage all chunks covered by the segment
+        const uint32 startChunk = dotAddress(x) & ~7u;
+        const uint32 endChunk = dotAddress(x + count - 1) & ~7u;
+        for (uint32 chunk = startChunk, offset = 0; chunk <= endChunk; chunk += 8, offset += 8) {
+            uint64 data;
+            if (x == firstX && chunk == firstChunk && reuseFirstChunk) {
+                data = util::ReadNE<uint64>(vramFetcher.charData.data());
+            } else {
+                const uint32 bank = (chunk >> 17u) & 3u;
+                if (!bgParams.charPatAccess[bank]) {
+                    data = 0;
+                } else {
+                    // TODO: handle VRSIZE.VRAMSZ
+                    data = util::ReadNE<uint64>(&vram[(chunk + bgParams.vramDataOffset[bank]) & 0x7FFF8]);
+                }
+            }
+            util::WriteNE<uint64>(&lineData[offset], data);
+
+            // Leave the fetcher in the same state as the per-pixel path
+            if (x + count > lastX && chunk == lastChunk) {
+                vramFetcher.charDataAddress = chunk;
+                util::WriteNE<uint64>(vramFetcher.charData.data(), data);
+            }
+        }
+
+        auto plot = [&](uint32 px, bool transparent, Color888 color, bool specialColorCalc, uint8 priority) {
+            if (windowState[px]) {
+                // Make pixel transparent if inside active window area
+                pixels.priority[px] = 0;
+            } else if (transparent) {
+                pixels.SetPixel(px, Pixel{.color = {}, .priority = 0, .specialColorCalc = false});
+            } else {
+                pixels.SetPixel(px, Pixel{.color = color, .priority = priority, .specialColorCalc = specialColorCalc});
+            }
+        };
+
+        // Expand dots into pixels
+        // Dots are read at their natural alignment within each chunk
+        static constexpr uint32 kDotAlignMask = colorFormat == ColorFormat::RGB888 ? ~3u
+                                                : colorFormat == ColorFormat::Palette2048 ||
+                                                        colorFormat == ColorFormat::RGB555
+                                                    ? ~1u
+                                                    : ~0u;
+        const uint8 *data = &lineData[(dotAddress(x) & kDotAlignMask) - startChunk];
+        if constexpr (IsPaletteColorFormat(colorFormat)) {
+            for (uint32 i = 0; i < count; i++) {
+                uint16 dotData;
+                uint32 colorIndex;
+                bool transparent;
+                if constexpr (colorFormat == ColorFormat::Palette16) {
+                    dotData = (data[((dotX & 1) + i) >> 1u] >> ((~(dotX + i) & 1) * 4)) & 0xF;
+                    colorIndex = bgParams.supplBitmapPalNum | dotData;
+                    transparent = dotData == 0;
+                } else if constexpr (colorFormat == ColorFormat::Palette256) {
+                    dotData = data[i];
+                    colorIndex = (bgParams.supplBitmapPalNum & 0x700) | dotData;
+                    transparent = dotData == 0;
+                } else { // colorFormat == ColorFormat::Palette2048
+                    dotData = util::ReadBE<uint16>(&data[i * sizeof(uint16)]);
+                    colorIndex = dotData & 0x7FF;
+                    transparent = colorIndex == 0;
+                }
+                transparent &= bgParams.enableTransparency;
+                const uint8 colorData = bit::extract<1, 3>(dotData);
+                const Color888 color = VDP2FetchCRAMColor<colorMode>(bgParams.cramOffset, colorIndex);
+                uint8 priority = basePriority;
+                if (perDotPriority) {
+                    priority |= static_cast<uint8>(specFuncCode.colorMatches[colorData]);
+                }
+                plot(x + i, transparent, color, getSpecialColorCalcFlag(colorData, color.msb), priority);
+            }
+        } else {
+            const bool specialColorCalc = getSpecialColorCalcFlag(0b111, true);
+            if constexpr (colorFormat == ColorFormat::RGB555) {
+                ConvertRGB555to888BE(data, rgbColors.data(), count);
+            } else { // colorFormat == ColorFormat::RGB888
+                for (uint32 i = 0; i < count; i++) {
+                    rgbColors[i].u32 = util::ReadBE<uint32>(&data[i * sizeof(uint32)]);
+                }
+            }
+            for (uint32 i = 0; i < count; i++) {
+                const bool transparent = bgParams.enableTransparency && !rgbColors[i].msb;
+                plot(x + i, transparent, rgbColors[i], specialColorCalc, basePriority);
+            }
+        }
+
+        x += count;
+    }
+
+    // Clear the remaining pixels inside the window
+    for (x = lastX + 1; x < m_HRes; x++) {
+        pixels.priority[x] = 0;
+    }
+}
+
 template <uint32 bgIndex, SoftwareVDPRenderer::CharacterMode charMode, bool fourCellChar, ColorFormat colorFormat,
           uint32 colorMode>
 NO_INLINE void SoftwareVDPRenderer::VDP2DrawRotationScrollBG(const VDP2Regs &regs2, const BGParams &bgParams,
                                                              LayerOutput &layerOut, VRAMFetcher &vramFetcher,
-                                                             std::span<const bool> windowState, bool altField) {
+                                                             const LineMask &windowState, bool altField) {
     static constexpr bool selRotParam = bgIndex == 0;
 
     const VDP2State &state2 = m_state.state2;
@@ -4686,7 +5341,7 @@ NO_INLINE void SoftwareVDPRenderer::VDP2DrawRotationScrollBG(const VDP2Regs &reg
 
 template <uint32 bgIndex, ColorFormat colorFormat, uint32 colorMode>
 NO_INLINE void SoftwareVDPRenderer::VDP2DrawRotationBitmapBG(const VDP2Regs &regs2, const BGParams &bgParams,
-                                                             LayerOutput &layerOut, std::span<const bool> windowState,
+                                                             LayerOutput &layerOut, const LineMask &windowState,
                                                              bool altField) {
     static constexpr bool selRotParam = bgIndex == 0;
 
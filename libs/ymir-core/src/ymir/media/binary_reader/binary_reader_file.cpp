@@ -0,0 +1,319 @@
+#include <ymir/media/binary_reader/binary_reader_file.hpp>
+
+#include <ymir/util/thread_name.hpp>
+
+#ifdef WIN32
+
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <Windows.h>
+
+#else // POSIX
+
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+
+#endif
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ymir::media {
+
+// Size of each read-ahead block. Fits 27 raw 2352-byte sectors.
+static constexpr uintmax_t kBlockSize = 64 * 1024;
+
+// Number of blocks in the read-ahead ring.
+static constexpr size_t kNumBlocks = 8;
+
+// Number of consecutive sequential reads needed to enable read-ahead.
+static constexpr uint32 kSequentialThreshold = 2;
+
+// Tag value for a block slot that contains no valid data.
+static constexpr uintmax_t kInvalidBlock = std::numeric_limits<uintmax_t>::max();
+
+struct FileBinaryReader::Internal {
+#ifdef WIN32
+    HANDLE hFile = INVALID_HANDLE_VALUE;
+#else // POSIX
+    int fd = -1;
+#endif
+    uintmax_t size = 0;
+    bool readAheadEnabled = false;
+
+    // A slot in the read-ahead ring.
+    // Block N of the file is always stored in slot N % kNumBlocks.
+    struct Block {
+        uintmax_t index = kInvalidBlock; // block index in the file, or kInvalidBlock if not loaded
+        uintmax_t length = 0;            // valid bytes in the buffer (the last block of the file may be short)
+        std::vector<uint8> data;
+    };
+    std::array<Block, kNumBlocks> blocks;
+
+    // Access pattern tracking, read-ahead window and thread coordination.
+    // All of these, as well as the block tags, are protected by the mutex.
+    // The block buffers are only written by the read-ahead thread while the block tag is invalid.
+    std::mutex mtx;
+    std::condition_variable cv;
+    uintmax_t lastReadEnd = kInvalidBlock;
+    uint32 sequentialCount = 0;
+    uintmax_t windowStart = kInvalidBlock; // first block index of the read-ahead window
+    bool shutdown = false;
+    std::thread readAheadThread; // started on the first sequential run
+
+    ~Internal() {
+        if (readAheadThread.joinable()) {
+            {
+                std::unique_lock lock{mtx};
+                shutdown = true;
+            }
+            cv.notify_one();
+            readAheadThread.join();
+        }
+        Close();
+    }
+
+    bool Open(const std::filesystem::path &path, std::error_code &error) {
+#ifdef WIN32
+        hFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE) {
+            error.assign(GetLastError(), std::system_category());
+            return false;
+        }
+#else // POSIX
+        fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            error.assign(errno, std::generic_category());
+            return false;
+        }
+#endif
+        return true;
+    }
+
+    void Close() {
+#ifdef WIN32
+        if (hFile != INVALID_HANDLE_VALUE) {
+            CloseHandle(hFile);
+            hFile = INVALID_HANDLE_VALUE;
+        }
+#else // POSIX
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+#endif
+    }
+
+    // Reads up to size bytes from the specified offset without touching any shared file position.
+    // Returns the number of bytes read.
+    uintmax_t PositionalRead(uintmax_t offset, uintmax_t size, uint8 *output) const {
+        uintmax_t total = 0;
+        while (total < size) {
+#ifdef WIN32
+            OVERLAPPED overlapped{};
+            const uintmax_t pos = offset + total;
+            overlapped.Offset = static_cast<DWORD>(pos);
+            overlapped.OffsetHigh = static_cast<DWORD>(pos >> 32ull);
+            const DWORD chunkSize = static_cast<DWORD>(std::min<uintmax_t>(size - total, 0x40000000));
+            DWORD bytesRead = 0;
+            if (!ReadFile(hFile, output + total, chunkSize, &bytesRead, &overlapped) || bytesRead == 0) {
+                break;
+            }
+#else // POSIX
+            const ssize_t bytesRead = pread(fd, output + total, size - total, offset + total);
+            if (bytesRead < 0 && errno == EINTR) {
+                continue;
+            }
+            if (bytesRead <= 0) {
+                break;
+            }
+#endif
+            total += bytesRead;
+        }
+        return total;
+    }
+
+    // Copies the requested range out of the read-ahead ring if it is entirely present.
+    // Must be called with the mutex held.
+    bool TryReadFromBlocks(uintmax_t offset, uintmax_t size, uint8 *output) const {
+        const uintmax_t firstBlock = offset / kBlockSize;
+        const uintmax_t lastBlock = (offset + size - 1) / kBlockSize;
+        if (lastBlock - firstBlock >= kNumBlocks) {
+            return false;
+        }
+        for (uintmax_t blockIndex = firstBlock; blockIndex <= lastBlock; ++blockIndex) {
+            const Block &block = blocks[blockIndex % kNumBlocks];
+            if (block.index != blockIndex) {
+                return false;
+            }
+            const uintmax_t blockEnd = blockIndex * kBlockSize + block.length;
+            if (blockEnd < std::min(offset + size, (blockIndex + 1) * kBlockSize)) {
+                return false;
+            }
+        }
+
+        uintmax_t pos = offset;
+        uintmax_t remaining = size;
+        while (remaining > 0) {
+            const uintmax_t blockIndex = pos / kBlockSize;
+            const uintmax_t blockOffset = pos % kBlockSize;
+            const uintmax_t count = std::min(remaining, kBlockSize - blockOffset);
+            const Block &block = blocks[blockIndex % kNumBlocks];
+            std::copy_n(block.data.begin() + blockOffset, count, output + (pos - offset));
+            pos += count;
+            remaining -= count;
+        }
+        return true;
+    }
+
+    // Updates the access pattern and moves the read-ahead window forward on sequential access.
+    // Must be called with the mutex held. Returns true if the read-ahead thread needs to be woken up.
+    bool TrackAccess(uintmax_t offset, uintmax_t size) {
+        if (offset == lastReadEnd) {
+            if (sequentialCount < kSequentialThreshold) {
+                ++sequentialCount;
+            }
+        } else {
+            sequentialCount = 0;
+        }
+        lastReadEnd = offset + size;
+
+        if (sequentialCount < kSequentialThreshold) {
+            return false;
+        }
+        const uintmax_t nextBlock = lastReadEnd / kBlockSize;
+        if (nextBlock == windowStart) {
+            return false;
+        }
+        windowStart = nextBlock;
+        if (!readAheadThread.joinable()) {
+            for (auto &block : blocks) {
+                block.data.resize(kBlockSize);
+            }
+            readAheadThread = std::thread{[this] { ReadAheadThread(); }};
+        }
+        return true;
+    }
+
+    void ReadAheadThread() {
+        util::SetCurrentThreadName("File read-ahead thread");
+
+        const uintmax_t numFileBlocks = (size + kBlockSize - 1) / kBlockSize;
+
+        std::unique_lock lock{mtx};
+        while (!shutdown) {
+            // Find the first block in the window that has not been loaded yet
+            uintmax_t blockIndex = kInvalidBlock;
+            if (windowStart != kInvalidBlock) {
+                const uintmax_t windowEnd = std::min<uintmax_t>(windowStart + kNumBlocks, numFileBlocks);
+                for (uintmax_t i = windowStart; i < windowEnd; ++i) {
+                    if (blocks[i % kNumBlocks].index != i) {
+                        blockIndex = i;
+                        break;
+                    }
+                }
+            }
+
+            if (blockIndex == kInvalidBlock) {
+                cv.wait(lock);
+                continue;
+            }
+
+            // Invalidate the slot so that readers stay away from it while it is being filled
+            Block &block = blocks[blockIndex % kNumBlocks];
+            block.index = kInvalidBlock;
+            lock.unlock();
+
+            const uintmax_t length = PositionalRead(blockIndex * kBlockSize, kBlockSize, block.data.data());
+
+            lock.lock();
+            if (length > 0) {
+                block.index = blockIndex;
+                block.length = length;
+            } else {
+                // Read failed; stop reading ahead until the access pattern moves on
+                windowStart = kInvalidBlock;
+            }
+        }
+    }
+};
+
+FileBinaryReader::FileBinaryReader()
+    : m_internal(std::make_unique<Internal>()) {}
+
+FileBinaryReader::FileBinaryReader(std::filesystem::path path, std::error_code &error)
+    : m_internal(std::make_unique<Internal>()) {
+    error.clear();
+
+    // Get the file size
+    const uintmax_t size = std::filesystem::file_size(path, error);
+    if (error) {
+        return;
+    }
+
+    // Try opening the file for read
+    if (!m_internal->Open(path, error)) {
+        return;
+    }
+    m_internal->size = size;
+
+    // Only bother reading ahead if the file is larger than the read-ahead ring.
+    // The buffers and the thread are only created once sequential access is detected.
+    m_internal->readAheadEnabled = size > kBlockSize * kNumBlocks;
+}
+
+FileBinaryReader::FileBinaryReader(FileBinaryReader &&) = default;
+
+FileBinaryReader::~FileBinaryReader() = default;
+
+FileBinaryReader &FileBinaryReader::operator=(FileBinaryReader &&) = default;
+
+uintmax_t FileBinaryReader::Size() const {
+    return m_internal->size;
+}
+
+uintmax_t FileBinaryReader::Read(uintmax_t offset, uintmax_t size, std::span<uint8> output) const {
+    Internal &internal = *m_internal;
+    if (offset >= internal.size) {
+        return 0;
+    }
+    // Limit size to the smallest of the requested size, the output buffer size and the amount of bytes available in
+    // the file starting from offset
+    size = std::min(size, internal.size - offset);
+    size = std::min<uintmax_t>(size, output.size());
+    if (size == 0) {
+        return 0;
+    }
+
+    if (!internal.readAheadEnabled) {
+        return internal.PositionalRead(offset, size, output.data());
+    }
+
+    bool served;
+    bool wake;
+    {
+        std::unique_lock lock{internal.mtx};
+        served = internal.TryReadFromBlocks(offset, size, output.data());
+        wake = internal.TrackAccess(offset, size);
+    }
+    if (wake) {
+        internal.cv.notify_one();
+    }
+    if (served) {
+        return size;
+    }
+    return internal.PositionalRead(offset, size, output.data());
+}
+
+} // namespace ymir::media
@@ -352,7 +352,7 @@ bool Load(std::filesystem::path cuePath, Disc &disc, bool preloadToRAM, CbLoader
             if (preloadToRAM) {
                 reader = std::make_shared<MemoryBinaryReader>(file.path, err);
             } else {
-                reader = std::make_shared<MemoryMappedBinaryReader>(file.path, err);
+                reader = std::make_shared<FileBinaryReader>(file.path, err);
             }
             if (err) {
                 errorMsg(fmt::format("BIN/CUE: Failed to load {} - {}", file.path, err.message()));
@@ -369,7 +369,7 @@ bool Load(std::filesystem::path cuePath, Disc &disc, bool preloadToRAM, CbLoader
                 if (preloadToRAM) {
                     fileReader = std::make_shared<MemoryBinaryReader>(file.path, err);
                 } else {
-                    fileReader = std::make_shared<MemoryMappedBinaryReader>(file.path, err);
+                    fileReader = std::make_shared<FileBinaryReader>(file.path, err);
                 }
                 if (file.format == "WAVE") {
                     // Check if wave file is raw, uncompressed 16-bit PCM stereo at 44100 Hz and grab a subview if so
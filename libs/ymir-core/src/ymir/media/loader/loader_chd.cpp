@@ -1,5 +1,6 @@
 #include <ymir/media/loader/loader_chd.hpp>
 
+#include <ymir/media/binary_reader/binary_reader_mem.hpp>
 #include <ymir/media/binary_reader/binary_reader_subview.hpp>
 #include <ymir/media/frame_address.hpp>
 
@@ -7,16 +8,19 @@
 
 #include <ymir/util/arith_ops.hpp>
 #include <ymir/util/scope_guard.hpp>
+#include <ymir/util/thread_name.hpp>
 
 #include <fmt/format.h>
 #include <fmt/std.h>
 
 #include <libchdr/chd.h>
 
+#include <atomic>
 #include <charconv>
 #include <map>
 #include <span>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -93,6 +97,82 @@ private:
     mutable std::map<uintmax_t, std::vector<uint8>> m_hunkCache;
 };
 
+// Decompresses the entire CHD file into a contiguous buffer using a pool of worker threads.
+// libchdr file handles are not thread-safe, so every worker other than the first opens its own handle to the file.
+// Workers grab hunks from a shared counter and decompress them straight into their final location in the buffer.
+// Returns an empty vector if any hunk could not be decompressed.
+static std::vector<uint8> DecompressAllHunks(const std::filesystem::path &chdPath, chd_file *file) {
+    const chd_header *header = chd_get_header(file);
+    const uint32 hunkSize = header->hunkbytes;
+    const uint32 hunkCount = header->hunkcount;
+    const uintmax_t size = std::min<uintmax_t>(header->logicalbytes, (uintmax_t)hunkSize * hunkCount);
+    if (hunkSize == 0 || hunkCount == 0 || size == 0) {
+        return {};
+    }
+
+    std::vector<uint8> data{};
+    data.resize(size);
+
+    std::atomic<uint32> nextHunk = 0;
+    std::atomic_bool failed = false;
+
+    auto worker = [&](chd_file *workerFile) {
+        // The last hunk may extend past the logical end of the disc; decompress it into a scratch buffer
+        std::vector<uint8> scratch{};
+        while (!failed.load(std::memory_order_relaxed)) {
+            const uint32 hunkIndex = nextHunk.fetch_add(1, std::memory_order_relaxed);
+            if (hunkIndex >= hunkCount) {
+                break;
+            }
+            const uintmax_t offset = (uintmax_t)hunkIndex * hunkSize;
+            if (offset >= size) {
+                break;
+            }
+            const uintmax_t available = size - offset;
+            chd_error error;
+            if (available >= hunkSize) {
+                error = chd_read(workerFile, hunkIndex, &data[offset]);
+            } else {
+                scratch.resize(hunkSize);
+                error = chd_read(workerFile, hunkIndex, scratch.data());
+                std::copy_n(scratch.begin(), available, data.begin() + offset);
+            }
+            if (error != CHDERR_NONE) {
+                failed = true;
+            }
+        }
+    };
+
+    const uint32 numThreads = std::clamp<uint32>(std::thread::hardware_concurrency(), 1u, hunkCount);
+    std::vector<std::thread> threads{};
+    threads.reserve(numThreads - 1);
+    for (uint32 i = 1; i < numThreads; ++i) {
+        threads.emplace_back([&] {
+            util::SetCurrentThreadName("CHD decompression thread");
+
+            chd_file *workerFile = nullptr;
+            if (chd_open(chdPath.string().c_str(), CHD_OPEN_READ, nullptr, &workerFile) != CHDERR_NONE) {
+                // Leave the work to the remaining threads
+                return;
+            }
+            worker(workerFile);
+            chd_close(workerFile);
+        });
+    }
+
+    // The calling thread also takes part in the work using the already opened handle
+    worker(file);
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    if (failed) {
+        return {};
+    }
+    return data;
+}
+
 static bool SetTrackInfo(const chd_header *header, std::string_view typestring, Track &track) {
     // NOTE: This loader uses raw sector sizes which is determined by the unit size from the CHD header
     if (typestring == "MODE1") {
@@ -201,12 +281,23 @@ bool Load(std::filesystem::path chdPath, Disc &disc, bool preloadToRAM, CbLoader
     }
     const chd_header *header = chd_get_header(file);
 
+    // When preloading, decompress the whole disc up front and serve it from memory.
+    // The CHD file is only needed for metadata afterwards.
+    // Otherwise, the CHD reader takes ownership of the file and decompresses hunks on demand.
+    std::shared_ptr<IBinaryReader> binaryReader;
+    util::ScopeGuard sgCloseFile{[&] { chd_close(file); }};
     if (preloadToRAM) {
-        chd_precache(file);
+        std::vector<uint8> data = DecompressAllHunks(chdPath, file);
+        if (data.empty()) {
+            errorMsg("CHD: Failed to decompress disc image");
+            return false;
+        }
+        binaryReader = std::make_shared<MemoryBinaryReader>(std::move(data));
+    } else {
+        binaryReader = std::make_shared<CHDBinaryReader>(file);
+        sgCloseFile.Cancel();
     }
 
-    auto binaryReader = std::make_shared<CHDBinaryReader>(file);
-
     auto &session = disc.sessions.emplace_back();
 
     std::vector<char> metabuf;
@@ -242,7 +242,7 @@ bool Load(std::filesystem::path ccdPath, Disc &disc, bool preloadToRAM, CbLoader
     if (preloadToRAM) {
         imgFile = std::make_shared<MemoryBinaryReader>(imgPath, err);
     } else {
-        imgFile = std::make_shared<MemoryMappedBinaryReader>(imgPath, err);
+        imgFile = std::make_shared<FileBinaryReader>(imgPath, err);
     }
     if (err) {
         errorMsg(fmt::format("IMG/CCD: Failed to load image file {}: {}", imgPath, err.message()));
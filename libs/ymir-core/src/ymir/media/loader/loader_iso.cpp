@@ -94,7 +94,7 @@ bool Load(std::filesystem::path isoPath, Disc &disc, bool preloadToRAM, CbLoader
     if (preloadToRAM) {
         track.binaryReader = std::make_unique<MemoryBinaryReader>(isoPath, err);
     } else {
-        track.binaryReader = std::make_unique<MemoryMappedBinaryReader>(isoPath, err);
+        track.binaryReader = std::make_unique<FileBinaryReader>(isoPath, err);
     }
     if (err) {
         errorMsg(fmt::format("ISO: Could not create file reader: {}", err.message()));
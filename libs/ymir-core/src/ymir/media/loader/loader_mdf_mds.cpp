@@ -293,7 +293,7 @@ bool Load(std::filesystem::path mdsPath, Disc &disc, bool preloadToRAM, CbLoader
                     if (preloadToRAM) {
                         files.insert({mdfPath, std::make_shared<MemoryBinaryReader>(mdfPath, err)});
                     } else {
-                        files.insert({mdfPath, std::make_shared<MemoryMappedBinaryReader>(mdfPath, err)});
+                        files.insert({mdfPath, std::make_shared<FileBinaryReader>(mdfPath, err)});
                     }
                     if (err) {
                         errorMsg(fmt::format("MDF/MDS: Failed to load MDF file {} - {}", mdfPath, err.message()));
@@ -2,25 +2,49 @@
 
 #include "null_program.hpp"
 
+#include <vector>
+
 namespace ymir::sys {
 
-SystemMemory::SystemMemory() {
+// Returns the Work RAM array stored in the given virtual memory block, or allocates a fallback array if the block could
+// not be allocated.
+template <size_t N>
+static std::array<uint8, N> *GetWRAMStorage(const util::VirtualMemory &memory,
+                                            std::unique_ptr<std::array<uint8, N>> &fallback) {
+    if (memory.IsAllocated()) {
+        return static_cast<std::array<uint8, N> *>(memory.GetMemory());
+    }
+    fallback = std::make_unique<std::array<uint8, N>>();
+    return fallback.get();
+}
+
+SystemMemory::SystemMemory()
+    : m_WRAMLow(GetWRAMStorage(m_WRAMLowMemory, m_WRAMLowFallback))
+    , m_WRAMHigh(GetWRAMStorage(m_WRAMHighMemory, m_WRAMHighFallback)) {
     nullprog::CopyNullProgram(IPL);
     Reset(true);
 }
 
 void SystemMemory::Reset(bool hard) {
     if (hard) {
-        WRAMLow.fill(0);
-        WRAMHigh.fill(0);
+        WRAMLow().fill(0);
+        WRAMHigh().fill(0);
     }
 }
 
 void SystemMemory::MapMemory(SH2Bus &bus) {
     bus.MapArray(0x000'0000, 0x00F'FFFF, IPL, false);
     m_internalBackupRAM.MapMemory(bus, 0x018'0000, 0x01F'FFFF);
-    bus.MapArray(0x020'0000, 0x02F'FFFF, WRAMLow, true);
-    bus.MapArray(0x600'0000, 0x7FF'FFFF, WRAMHigh, true);
+    if (m_WRAMLowMemory.IsAllocated()) {
+        bus.MapVirtualMemory(0x020'0000, 0x02F'FFFF, m_WRAMLowMemory, true, kHostEndianMemory);
+    } else {
+        bus.MapArray(0x020'0000, 0x02F'FFFF, *m_WRAMLow, true, kHostEndianMemory);
+    }
+    if (m_WRAMHighMemory.IsAllocated()) {
+        bus.MapVirtualMemory(0x600'0000, 0x7FF'FFFF, m_WRAMHighMemory, true, kHostEndianMemory);
+    } else {
+        bus.MapArray(0x600'0000, 0x7FF'FFFF, *m_WRAMHigh, true, kHostEndianMemory);
+    }
 
     // TODO: make this configurable
     // VA0/VA1: 030'0000 is unmapped; reads return all ones
@@ -44,17 +68,21 @@ void SystemMemory::LoadInternalBackupMemoryImage(std::filesystem::path path, boo
 }
 
 void SystemMemory::DumpWRAMLow(std::ostream &out) const {
-    out.write((const char *)WRAMLow.data(), WRAMLow.size());
+    std::vector<uint8> buf(WRAMLow().size());
+    CopyToGuestOrder(buf, WRAMLow());
+    out.write((const char *)buf.data(), buf.size());
 }
 
 void SystemMemory::DumpWRAMHigh(std::ostream &out) const {
-    out.write((const char *)WRAMHigh.data(), WRAMHigh.size());
+    std::vector<uint8> buf(WRAMHigh().size());
+    CopyToGuestOrder(buf, WRAMHigh());
+    out.write((const char *)buf.data(), buf.size());
 }
 
 void SystemMemory::SaveState(savestate::SystemSaveState &state) const {
     state.iplRomHash = m_iplHash;
-    state.WRAMLow = WRAMLow;
-    state.WRAMHigh = WRAMHigh;
+    CopyToGuestOrder(state.WRAMLow, WRAMLow());
+    CopyToGuestOrder(state.WRAMHigh, WRAMHigh());
 }
 
 bool SystemMemory::ValidateState(const savestate::SystemSaveState &state, bool skipROMChecks) const {
@@ -65,8 +93,8 @@ bool SystemMemory::ValidateState(const savestate::SystemSaveState &state, bool s
 }
 
 void SystemMemory::LoadState(const savestate::SystemSaveState &state) {
-    WRAMLow = state.WRAMLow;
-    WRAMHigh = state.WRAMHigh;
+    CopyFromGuestOrder(WRAMLow(), state.WRAMLow);
+    CopyFromGuestOrder(WRAMHigh(), state.WRAMHigh);
 }
 
 } // namespace ymir::sys
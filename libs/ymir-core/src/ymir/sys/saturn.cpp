@@ -159,6 +159,7 @@ Saturn::Saturn()
         [&](const std::vector<core::config::sys::Region> &regions) { UpdatePreferredRegionOrder(regions); });
     configuration.system.debugTracing.Observe([&](bool enabled) { UpdateDebugTracing(enabled); });
     configuration.system.emulateSH2Cache.Observe([&](bool enabled) { UpdateSH2CacheEmulation(enabled); });
+    configuration.system.fastMemory.Observe([&](bool enabled) { mainBus.EnableFastMemory(enabled); });
     configuration.system.sh2ClockFactor.Observe([&](RatioU32 factor) { UpdateSH2ClockFactor(factor); });
     configuration.system.videoStandard.Observe(
         [&](core::config::sys::VideoStandard videoStandard) { UpdateVideoStandard(videoStandard); });
@@ -177,7 +178,7 @@ void Saturn::Reset(bool hard) {
 
     masterSH2.Reset(hard);
     slaveSH2.Reset(hard);
-    slaveSH2Enabled = false;
+    SetSlaveSH2Enabled(false);
     m_msh2SpilloverCycles = 0;
     m_ssh2SpilloverCycles = 0;
     m_sh1SpilloverCycles = 0;
@@ -372,7 +373,7 @@ void Saturn::SaveState(savestate::SaveState &state) const {
     m_scheduler.SaveState(state.scheduler);
     m_system.SaveState(state.system);
     mem.SaveState(state.system);
-    state.system.slaveSH2Enabled = slaveSH2Enabled;
+    state.system.slaveSH2Enabled = m_slaveSH2Enabled;
     state.msh2SpilloverCycles = m_msh2SpilloverCycles;
     state.ssh2SpilloverCycles = m_ssh2SpilloverCycles;
     masterSH2.SaveState(state.msh2);
@@ -449,7 +450,7 @@ bool Saturn::LoadState(const savestate::SaveState &state, bool skipROMChecks) {
     m_scheduler.LoadState(state.scheduler);
     m_system.LoadState(state.system);
     mem.LoadState(state.system);
-    slaveSH2Enabled = state.system.slaveSH2Enabled;
+    SetSlaveSH2Enabled(state.system.slaveSH2Enabled);
     m_msh2SpilloverCycles = state.msh2SpilloverCycles;
     m_ssh2SpilloverCycles = state.ssh2SpilloverCycles;
     masterSH2.LoadState(state.msh2);
@@ -499,24 +500,33 @@ void Saturn::DumpCDBlockDRAM(std::ostream &out) {
 // Note:
 // - Step out/return can be implemented in terms of single-stepping and instruction tracing events
 
-template <bool debug, bool enableSH2Cache, bool cdblockLLE>
-void Saturn::RunFrameImpl() {
+template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
+bool Saturn::RunFrameImpl() {
     // Run until we reach the vertical blanking area.
     // At that point, the frame is fully rendered and dispatched to the frontend.
+    // If the execution functions are switched midway (e.g. the SMPC turned the slave SH-2 on or off), bail out and let
+    // RunFrame() pick up where we left off with the new implementation.
     while (VDP.GetVerticalPhase() == vdp::VerticalPhase::BlankingAndSync) {
-        if (!Run<debug, enableSH2Cache, cdblockLLE>()) {
-            return;
+        if (!Run<debug, enableSH2Cache, cdblockLLE, slaveSH2Enabled>()) {
+            return true;
+        }
+        if (m_functionPointersChanged) [[unlikely]] {
+            return false;
         }
     }
     while (VDP.GetVerticalPhase() != vdp::VerticalPhase::BlankingAndSync) {
-        if (!Run<debug, enableSH2Cache, cdblockLLE>()) {
-            return;
+        if (!Run<debug, enableSH2Cache, cdblockLLE, slaveSH2Enabled>()) {
+            return true;
+        }
+        if (m_functionPointersChanged && VDP.GetVerticalPhase() != vdp::VerticalPhase::BlankingAndSync) [[unlikely]] {
+            return false;
         }
     }
     SCSP.SyncSCSPThreadPublic();
+    return true;
 }
 
-template <bool debug, bool enableSH2Cache, bool cdblockLLE>
+template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
 bool Saturn::Run() {
     static constexpr uint64 kSH2SyncMaxStep = 32;
 
@@ -530,7 +540,7 @@ bool Saturn::Run() {
     } else {
         execCycles = m_msh2SpilloverCycles;
         m_msh2SpilloverCycles = 0;
-        if (slaveSH2Enabled) {
+        if constexpr (slaveSH2Enabled) {
             uint64 slaveCycles = m_ssh2SpilloverCycles;
             do {
                 const uint64 prevExecCycles = execCycles;
@@ -598,7 +608,7 @@ bool Saturn::Run() {
     return true;
 }
 
-template <bool debug, bool enableSH2Cache, bool cdblockLLE>
+template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
 uint64 Saturn::StepMasterSH2Impl() {
     while (SCU.IsDMAActive()) {
         const uint64 cycles = 64;
@@ -617,7 +627,7 @@ uint64 Saturn::StepMasterSH2Impl() {
     if (masterCycles >= m_msh2SpilloverCycles) {
         masterCycles -= m_msh2SpilloverCycles;
         m_msh2SpilloverCycles = 0;
-        if (slaveSH2Enabled) {
+        if constexpr (slaveSH2Enabled) {
             const uint64 slaveCycles = slaveSH2.Advance<debug, enableSH2Cache>(masterCycles, m_ssh2SpilloverCycles);
             m_ssh2SpilloverCycles = slaveCycles - masterCycles;
         }
@@ -636,9 +646,9 @@ uint64 Saturn::StepMasterSH2Impl() {
     return masterCycles;
 }
 
-template <bool debug, bool enableSH2Cache, bool cdblockLLE>
+template <bool debug, bool enableSH2Cache, bool cdblockLLE, bool slaveSH2Enabled>
 uint64 Saturn::StepSlaveSH2Impl() {
-    if (!slaveSH2Enabled) {
+    if constexpr (!slaveSH2Enabled) {
         return 0;
     }
 
@@ -677,7 +687,8 @@ uint64 Saturn::StepSlaveSH2Impl() {
 }
 
 void Saturn::UpdateFunctionPointers() {
-    UpdateFunctionPointersTemplate(m_enableDebugTracing, m_emulateSH2Caches, m_cdblockLLE);
+    UpdateFunctionPointersTemplate(m_enableDebugTracing, m_emulateSH2Caches, m_cdblockLLE, m_slaveSH2Enabled);
+    m_functionPointersChanged = true;
 }
 
 template <bool... t_features>
@@ -825,6 +836,13 @@ void Saturn::UpdateVideoStandard(core::config::sys::VideoStandard videoStandard)
     m_system.UpdateClockRatios();
 }
 
+void Saturn::SetSlaveSH2Enabled(bool enable) {
+    if (m_slaveSH2Enabled != enable) {
+        m_slaveSH2Enabled = enable;
+        UpdateFunctionPointers();
+    }
+}
+
 void Saturn::SetCDBlockLLE(bool enabled) {
     if (m_cdblockLLE != enabled) {
         m_cdblockLLE = enabled;
@@ -853,12 +871,12 @@ void Saturn::SMPCOperations::RaiseNMI() {
 }
 
 void Saturn::SMPCOperations::EnableAndResetSlaveSH2() {
-    m_saturn.slaveSH2Enabled = true;
+    m_saturn.SetSlaveSH2Enabled(true);
     m_saturn.slaveSH2.Reset(true);
 }
 
 void Saturn::SMPCOperations::DisableSlaveSH2() {
-    m_saturn.slaveSH2Enabled = false;
+    m_saturn.SetSlaveSH2Enabled(false);
 }
 
 void Saturn::SMPCOperations::EnableAndResetM68K() {
@@ -11,7 +11,12 @@
 
 #else // POSIX
 
+    #include <fcntl.h>
     #include <sys/mman.h>
+    #include <unistd.h>
+
+    #include <atomic>
+    #include <cstdio>
 
 #endif
 
@@ -21,9 +26,39 @@ struct VirtualMemory::Internal {
 #ifdef WIN32
     HANDLE hSection;
 #else // POSIX
+    int fd = -1; // shared memory object backing the block; -1 if it cannot be aliased
 #endif
 };
 
+#ifndef WIN32
+
+// Creates an anonymous shared memory object of the specified size.
+// Returns the file descriptor or -1 if the object could not be created.
+static int CreateSharedMemoryObject(size_t size) {
+    #ifdef __linux__
+    const int fd = memfd_create("ymir-vm", MFD_CLOEXEC);
+    #else
+    // Use a unique name and unlink it right away to leave an anonymous object behind
+    static std::atomic<uint32> counter = 0;
+    char name[32];
+    std::snprintf(name, sizeof(name), "/ymir-vm-%d-%u", static_cast<int>(getpid()), counter++);
+    const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+        shm_unlink(name);
+    }
+    #endif
+    if (fd < 0) {
+        return -1;
+    }
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+#endif
+
 VirtualMemory::VirtualMemory()
     : m_internal(std::make_unique<Internal>()) {}
 
@@ -60,7 +95,15 @@ void VirtualMemory::Map(size_t size) {
                                               bit::extract<0, 31>(size), nullptr);
     m_mem = MapViewOfFile(m_internal->hSection, FILE_MAP_ALL_ACCESS, 0, 0, size);
 #else // POSIX
-    m_mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_SHARED, -1, 0);
+    m_internal->fd = CreateSharedMemoryObject(size);
+    if (m_internal->fd >= 0) {
+        m_mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_internal->fd, 0);
+    } else {
+        m_mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_SHARED, -1, 0);
+    }
+    if (m_mem == MAP_FAILED) {
+        m_mem = nullptr;
+    }
 #endif
     m_size = size;
 }
@@ -72,9 +115,67 @@ void VirtualMemory::Unmap() {
     m_internal->hSection = INVALID_HANDLE_VALUE;
 #else // POSIX
     munmap(m_mem, m_size);
+    if (m_internal->fd >= 0) {
+        close(m_internal->fd);
+        m_internal->fd = -1;
+    }
 #endif
     m_mem = nullptr;
     m_size = 0;
 }
 
+#ifndef WIN32
+
+// -----------------------------------------------------------------------------
+
+VirtualAddressWindow::~VirtualAddressWindow() {
+    Release();
+}
+
+bool VirtualAddressWindow::Reserve(size_t size) {
+    Release();
+    void *base = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    m_base = static_cast<uint8 *>(base);
+    m_size = size;
+    return true;
+}
+
+void VirtualAddressWindow::Release() {
+    if (m_base == nullptr) {
+        return;
+    }
+    munmap(m_base, m_size);
+    m_base = nullptr;
+    m_size = 0;
+}
+
+bool VirtualAddressWindow::MapView(size_t offset, const VirtualMemory &memory, size_t memOffset, size_t size,
+                                   bool writable) {
+    if (m_base == nullptr || offset + size > m_size || memOffset + size > memory.GetAllocatedSize()) {
+        return false;
+    }
+    if (memory.m_internal->fd < 0) {
+        return false;
+    }
+    const int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *view = mmap(m_base + offset, size, prot, MAP_SHARED | MAP_FIXED, memory.m_internal->fd, memOffset);
+    if (view == MAP_FAILED) {
+        UnmapView(offset, size);
+        return false;
+    }
+    return true;
+}
+
+void VirtualAddressWindow::UnmapView(size_t offset, size_t size) {
+    if (m_base == nullptr || offset + size > m_size) {
+        return;
+    }
+    mmap(m_base + offset, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+}
+
+#endif
+
 } // namespace util
@@ -53,6 +53,17 @@ public:
         }
     }
 
+    // Returns true if bytes of an unterminated line have been received, including a line that is being dropped
+    bool HasPartialLine() const {
+        return !m_buffer.empty() || m_droppingOversizedLine;
+    }
+
+    // Discards the partial line and all bytes up to the next line terminator
+    void DropPartialLine() {
+        m_buffer.clear();
+        m_droppingOversizedLine = true;
+    }
+
 private:
     void EmitLine() {
         if (m_droppingOversizedLine) {
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "line_framer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ymir::debug {
+
+inline constexpr std::string_view kStdioJsonRpcLinesBinaryTransport = "stdio-jsonrpc-lines+binary";
+
+// Binary frames carry bulk payloads (memory snapshots, changed pages) on the same stream as the JSON-RPC lines.
+// A frame may only start between lines. It begins with a NUL byte, which never appears in JSON text, followed by a
+// little-endian header and the payload:
+//
+//   offset  size  field
+//   0       1     marker (0x00)
+//   1       4     blob ID, matching the "blob_id" of the JSON message that announced the payload
+//   5       4     payload length in bytes
+//   9       n     payload
+//
+// The JSON message is always sent before its payload. A marker found in the middle of a line is reported as an error
+// and the rest of that line is discarded.
+inline constexpr char kBinaryFrameMarker = '\0';
+inline constexpr size_t kBinaryFrameHeaderSize = 9;
+
+inline void AppendBinaryFrame(std::string &out, uint32_t blobId, std::span<const uint8_t> payload) {
+    auto appendU32 = [&](uint32_t value) {
+        for (uint32_t i = 0; i < 4; ++i) {
+            out += static_cast<char>((value >> (i * 8u)) & 0xFF);
+        }
+    };
+
+    out.reserve(out.size() + kBinaryFrameHeaderSize + payload.size());
+    out += kBinaryFrameMarker;
+    appendU32(blobId);
+    appendU32(static_cast<uint32_t>(payload.size()));
+    out.append(reinterpret_cast<const char *>(payload.data()), payload.size());
+}
+
+enum class StreamFramerError {
+    LineTooLong,
+    PayloadTooLarge,
+    MarkerInsideLine,
+};
+
+// Splits a stream into JSON-RPC lines and binary frames.
+class StreamFramer {
+public:
+    static constexpr size_t kMaxPayloadLength = 64 * 1024 * 1024; // 64 MiB
+
+    using LineCallback = std::function<void(std::string_view)>;
+    using BinaryCallback = std::function<void(uint32_t blobId, std::span<const uint8_t> payload)>;
+    using ErrorCallback = std::function<void(StreamFramerError)>;
+
+    StreamFramer(LineCallback onLine, BinaryCallback onBinary, ErrorCallback onError)
+        : m_lineFramer(std::move(onLine),
+                       [this](LineFramerError) {
+                           if (m_onError) {
+                               m_onError(StreamFramerError::LineTooLong);
+                           }
+                       })
+        , m_onBinary(std::move(onBinary))
+        , m_onError(std::move(onError)) {}
+
+    // The line framer's error callback refers back to this object
+    StreamFramer(const StreamFramer &) = delete;
+    StreamFramer &operator=(const StreamFramer &) = delete;
+
+    void Push(const char *data, size_t length) {
+        size_t i = 0;
+        while (i < length) {
+            switch (m_state) {
+            case State::Text: {
+                size_t end = i;
+                while (end < length && data[end] != kBinaryFrameMarker) {
+                    ++end;
+                }
+                m_lineFramer.Push(data + i, end - i);
+                i = end;
+                if (i < length) {
+                    // Skip marker
+                    ++i;
+                    if (m_lineFramer.HasPartialLine()) {
+                        if (m_onError) {
+                            m_onError(StreamFramerError::MarkerInsideLine);
+                        }
+                        m_lineFramer.DropPartialLine();
+                    } else {
+                        m_state = State::Header;
+                        m_headerSize = 0;
+                    }
+                }
+                break;
+            }
+            case State::Header:
+                m_header[m_headerSize++] = static_cast<uint8_t>(data[i++]);
+                if (m_headerSize == m_header.size()) {
+                    BeginPayload();
+                }
+                break;
+            case State::Payload: [[fallthrough]];
+            case State::DroppingPayload: {
+                const size_t count = std::min(length - i, m_remaining);
+                if (m_state == State::Payload) {
+                    m_payload.insert(m_payload.end(), data + i, data + i + count);
+                }
+                i += count;
+                m_remaining -= count;
+                if (m_remaining == 0) {
+                    EndPayload();
+                }
+                break;
+            }
+            }
+        }
+    }
+
+private:
+    enum class State { Text, Header, Payload, DroppingPayload };
+
+    void BeginPayload() {
+        auto readU32 = [&](size_t offset) {
+            uint32_t value = 0;
+            for (uint32_t i = 0; i < 4; ++i) {
+                value |= static_cast<uint32_t>(m_header[offset + i]) << (i * 8u);
+            }
+            return value;
+        };
+
+        m_blobId = readU32(0);
+        m_remaining = readU32(4);
+        m_payload.clear();
+        if (m_remaining > kMaxPayloadLength) {
+            if (m_onError) {
+                m_onError(StreamFramerError::PayloadTooLarge);
+            }
+            m_state = State::DroppingPayload;
+        } else {
+            m_payload.reserve(m_remaining);
+            m_state = State::Payload;
+        }
+        if (m_remaining == 0) {
+            EndPayload();
+        }
+    }
+
+    void EndPayload() {
+        if (m_state == State::Payload && m_onBinary) {
+            m_onBinary(m_blobId, m_payload);
+        }
+        m_payload.clear();
+        m_state = State::Text;
+    }
+
+    LineFramer m_lineFramer;
+    BinaryCallback m_onBinary;
+    ErrorCallback m_onError;
+
+    State m_state{State::Text};
+    std::array<uint8_t, kBinaryFrameHeaderSize - 1> m_header{};
+    size_t m_headerSize{};
+    uint32_t m_blobId{};
+    size_t m_remaining{};
+    std::vector<uint8_t> m_payload;
+};
+
+} // namespace ymir::debug
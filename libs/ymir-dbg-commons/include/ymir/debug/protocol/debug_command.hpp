@@ -20,6 +20,9 @@ enum class CommandMethod {
     ExecReset,
     RegsRead,
     MemPeek,
+    MemReadBulk,
+    MemSubscribe,
+    MemUnsubscribe,
     DisasmAt,
     BreakpointSet,
     BreakpointList,
@@ -38,6 +41,9 @@ constexpr std::string_view ToString(CommandMethod m) {
     case CommandMethod::ExecReset: return "exec.reset";
     case CommandMethod::RegsRead: return "regs.read";
     case CommandMethod::MemPeek: return "mem.peek";
+    case CommandMethod::MemReadBulk: return "mem.read_bulk";
+    case CommandMethod::MemSubscribe: return "mem.subscribe";
+    case CommandMethod::MemUnsubscribe: return "mem.unsubscribe";
     case CommandMethod::DisasmAt: return "disasm.at";
     case CommandMethod::BreakpointSet: return "breakpoint.set";
     case CommandMethod::BreakpointList: return "breakpoint.list";
@@ -60,6 +66,26 @@ struct MemPeekParams {
     uint32_t count{0};
 };
 
+// Reads a block of memory. The data is delivered in a binary frame that follows the response.
+struct MemReadBulkParams {
+    MemorySpace space{MemorySpace::Sh2Bus};
+    uint32_t address{0};
+    uint32_t size{0};
+};
+
+// Watches a block of memory. Pages that changed are pushed once per frame with a MemPagesChangedEvent; the first
+// event after subscribing contains every page.
+struct MemSubscribeParams {
+    MemorySpace space{MemorySpace::Sh2Bus};
+    uint32_t address{0};
+    uint32_t size{0};
+    uint32_t page_size{4096};
+};
+
+struct MemUnsubscribeParams {
+    std::string subscription_id;
+};
+
 struct DisasmAtParams {
     DebugTarget target{DebugTarget::Sh2Master};
     uint32_t address{0};
@@ -85,8 +111,10 @@ struct ExecStepIParams {
     DebugTarget target{DebugTarget::Sh2Master};
 };
 
-using DebugCommandParams = std::variant<std::monostate, RegsReadParams, MemPeekParams, DisasmAtParams,
-                                        BreakpointSetParams, BreakpointListParams, BreakpointIdParams, ExecStepIParams>;
+using DebugCommandParams =
+    std::variant<std::monostate, RegsReadParams, MemPeekParams, MemReadBulkParams, MemSubscribeParams,
+                 MemUnsubscribeParams, DisasmAtParams, BreakpointSetParams, BreakpointListParams, BreakpointIdParams,
+                 ExecStepIParams>;
 
 struct DebugCommand {
     DebugRequestId request_id;
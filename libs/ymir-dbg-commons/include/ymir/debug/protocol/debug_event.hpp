@@ -34,7 +34,16 @@ struct InstanceReadyEvent {
     std::vector<TargetInfo> targets;
 };
 
-using DebugEventPayload = std::variant<DebugStoppedEvent, InstanceReadyEvent>;
+// Pushed once per frame for each subscription with changed pages. The binary frame with the same blob ID contains the
+// listed pages in order.
+struct MemPagesChangedEvent {
+    std::string subscription_id;
+    uint64_t frame{};
+    std::vector<uint32_t> pages;
+    uint32_t blob_id{};
+};
+
+using DebugEventPayload = std::variant<DebugStoppedEvent, InstanceReadyEvent, MemPagesChangedEvent>;
 
 struct DebugEvent {
     DebugEventPayload payload;
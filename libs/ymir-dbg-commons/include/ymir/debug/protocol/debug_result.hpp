@@ -56,6 +56,20 @@ struct MemPeekResult {
     std::vector<uint8_t> data;
 };
 
+// The data follows in the binary frame with the same blob ID.
+struct MemReadBulkResult {
+    MemorySpace space{MemorySpace::Sh2Bus};
+    uint32_t address{};
+    uint32_t size{};
+    uint32_t blob_id{};
+};
+
+struct MemSubscribeResult {
+    std::string subscription_id;
+    uint32_t page_size{};
+    uint32_t page_count{};
+};
+
 struct DisasmLine {
     uint32_t address{};
     uint16_t opcode{};
@@ -99,7 +113,8 @@ struct ExecStepIResult {
 
 using DebugResultPayload =
     std::variant<std::monostate, DebugVersionResult, InstanceStatusResult, RegsReadResult, MemPeekResult,
-                 DisasmAtResult, BreakpointSetResult, BreakpointListResult, ExecStepIResult>;
+                 MemReadBulkResult, MemSubscribeResult, DisasmAtResult, BreakpointSetResult, BreakpointListResult,
+                 ExecStepIResult>;
 
 // Variant enforces success XOR error at the type level; a result cannot carry both.
 using DebugResult = std::variant<DebugResultPayload, ErrorInfo>;
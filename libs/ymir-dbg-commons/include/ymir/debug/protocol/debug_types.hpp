@@ -19,6 +19,30 @@ constexpr std::string_view ToString(DebugTarget t) {
     return "unknown";
 }
 
+enum class MemorySpace {
+    Sh2Bus,
+    WorkRamLow,
+    WorkRamHigh,
+    Vdp1Vram,
+    Vdp1Framebuffer,
+    Vdp2Vram,
+    Vdp2Cram,
+    ScspRam,
+};
+constexpr std::string_view ToString(MemorySpace s) {
+    switch (s) {
+    case MemorySpace::Sh2Bus: return "sh2.bus";
+    case MemorySpace::WorkRamLow: return "wram.low";
+    case MemorySpace::WorkRamHigh: return "wram.high";
+    case MemorySpace::Vdp1Vram: return "vdp1.vram";
+    case MemorySpace::Vdp1Framebuffer: return "vdp1.fb";
+    case MemorySpace::Vdp2Vram: return "vdp2.vram";
+    case MemorySpace::Vdp2Cram: return "vdp2.cram";
+    case MemorySpace::ScspRam: return "scsp.ram";
+    }
+    return "unknown";
+}
+
 enum class ExecutionState {
     Starting,
     Paused,
@@ -79,6 +103,7 @@ enum class ErrorCode {
     MemoryOutOfRange,
     Unsupported,
     InternalError,
+    SubscriptionNotFound,
 };
 constexpr std::string_view ToString(ErrorCode e) {
     switch (e) {
@@ -97,6 +122,7 @@ constexpr std::string_view ToString(ErrorCode e) {
     case ErrorCode::MemoryOutOfRange: return "memory_out_of_range";
     case ErrorCode::Unsupported: return "unsupported";
     case ErrorCode::InternalError: return "internal_error";
+    case ErrorCode::SubscriptionNotFound: return "subscription_not_found";
     }
     return "unknown";
 }
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "debug_command.hpp"
+
+namespace ymir::debug {
+
+// Tracks the pages of a memory block watched through mem.subscribe.
+// Keeps a shadow copy of the block to find which pages changed since the last update.
+class MemorySubscription {
+public:
+    explicit MemorySubscription(const MemSubscribeParams &params)
+        : m_params(params)
+        , m_shadow(params.size) {
+        if (m_params.page_size == 0) {
+            m_params.page_size = 4096;
+        }
+    }
+
+    const MemSubscribeParams &Params() const {
+        return m_params;
+    }
+
+    uint32_t PageCount() const {
+        return (m_params.size + m_params.page_size - 1) / m_params.page_size;
+    }
+
+    // Compares the current contents of the block against the shadow copy.
+    // Appends the indices of changed pages to outPages and their contents to outPayload, then updates the shadow copy.
+    // Every page is reported on the first update.
+    // Returns true if any page changed.
+    bool Update(std::span<const uint8_t> current, std::vector<uint32_t> &outPages, std::vector<uint8_t> &outPayload) {
+        const size_t size = std::min<size_t>(current.size(), m_shadow.size());
+        const size_t pageSize = m_params.page_size;
+        bool changed = false;
+        for (size_t offset = 0; offset < size; offset += pageSize) {
+            const size_t length = std::min(pageSize, size - offset);
+            if (m_primed && std::memcmp(&m_shadow[offset], &current[offset], length) == 0) {
+                continue;
+            }
+            std::memcpy(&m_shadow[offset], &current[offset], length);
+            outPages.push_back(static_cast<uint32_t>(offset / pageSize));
+            outPayload.insert(outPayload.end(), current.begin() + offset, current.begin() + offset + length);
+            changed = true;
+        }
+        m_primed = true;
+        return changed;
+    }
+
+private:
+    MemSubscribeParams m_params;
+    std::vector<uint8_t> m_shadow;
+    bool m_primed{false};
+};
+
+} // namespace ymir::debug
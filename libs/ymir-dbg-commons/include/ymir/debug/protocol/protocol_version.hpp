@@ -5,6 +5,6 @@
 namespace ymir::debug {
 
 inline constexpr std::string_view kProtocolName = "ymir-debug";
-inline constexpr std::string_view kProtocolVersion = "0.1.0";
+inline constexpr std::string_view kProtocolVersion = "0.2.0";
 
 } // namespace ymir::debug
@@ -0,0 +1,575 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/hw/cdblock/ygr.hpp>
+#include <ymir/hw/sh1/sh1.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Test subject class
+
+using namespace ymir;
+
+namespace sh1_dmac {
+
+// Data port of the YGR FIFO (mocked or real) on the CD block bus
+inline constexpr uint32 kFIFOAddress = 0xA000000;
+
+// Start of the DMA transfer area in DRAM
+inline constexpr uint32 kDRAMAddress = 0x9000100;
+
+inline constexpr size_t kFIFOCapacity = 6;
+
+inline constexpr uint16 kTransferCount = 300;
+
+struct DREQToggle {
+    uint64 cycle;
+    bool level;
+
+    bool operator==(const DREQToggle &) const = default;
+};
+
+// Loads a ROM whose reset vector points to an infinite loop:
+//   0400: bra 0400
+//   0402: nop
+static void LoadIdleLoop(sh1::SH1 &sh1, std::array<uint8, sh1::kROMSize> &rom) {
+    util::WriteBE<uint32>(&rom[0x0], 0x400);
+    util::WriteBE<uint32>(&rom[0x4], 0xF001000);
+    util::WriteBE<uint16>(&rom[0x400], 0xAFFE);
+    util::WriteBE<uint16>(&rom[0x402], 0x0009);
+    sh1.LoadROM(rom);
+}
+
+// Outcome of a transfer, compared between the burst and single-unit paths
+struct TransferResult {
+    std::vector<uint16> dram;
+    std::vector<uint16> hostWords;
+    std::vector<DREQToggle> dreqToggles;
+    savestate::SH1SaveState::DMAC::Channel channel;
+    uint64 endCycle;
+    uint32 multiUnitBursts;
+};
+
+// SH-1 with DRAM and a mock of the YGR FIFO driving DREQ1#. The SH-1 spins in an idle loop while the test acts as the
+// host side of the FIFO and as the CD block program that sets up DMAC channel 1.
+struct TestSubject {
+    sys::SH1Bus bus{};
+    sh1::SH1 sh1{bus};
+    sh1::SH1::Probe &probe{sh1.GetProbe()};
+
+    std::array<uint8, sh1::kROMSize> rom{};
+    std::array<uint8, 512 * 1024> dram{};
+
+    // true:  host -> FIFO -> DRAM (the SH-1 reads from the FIFO)
+    // false: DRAM -> FIFO -> host (the SH-1 writes to the FIFO)
+    const bool toMemory;
+
+    std::deque<uint16> fifo;
+    bool nDREQ1 = true;
+
+    std::vector<uint16> hostWords;
+    std::vector<DREQToggle> dreqToggles;
+    uint64 cycles = 0;
+
+    // Number of bursts that moved more than one word
+    uint32 multiUnitBursts = 0;
+
+    TestSubject(bool burst, bool toMemory)
+        : toMemory(toMemory) {
+        LoadIdleLoop(sh1, rom);
+
+        bus.MapArray(0x9000000, 0x9FFFFFF, dram, true);
+
+        auto read = [](uint32 address, void *ctx) -> uint16 { return static_cast<TestSubject *>(ctx)->Read(); };
+        auto write = [](uint32 address, uint16 value, void *ctx) { static_cast<TestSubject *>(ctx)->Write(value); };
+        if (burst) {
+            bus.MapNormal(
+                0xA000000, 0xAFFFFFF, this, read, write,
+                [](uint32 address, uint16 *out, uint32 count, void *ctx) -> uint32 {
+                    return static_cast<TestSubject *>(ctx)->ReadBurst(out, count);
+                },
+                [](uint32 address, const uint16 *in, uint32 count, void *ctx) -> uint32 {
+                    return static_cast<TestSubject *>(ctx)->WriteBurst(in, count);
+                });
+        } else {
+            bus.MapNormal(0xA000000, 0xAFFFFFF, this, read, write);
+        }
+
+        sh1.Reset(true);
+        UpdateDREQ();
+    }
+
+    // Sets up DMAC channel 1 to transfer between the FIFO and DRAM on DREQ1#
+    void StartTransfer() {
+        if (toMemory) {
+            probe.MemWriteLong(0x5FFFF50, kFIFOAddress); // SAR1
+            probe.MemWriteLong(0x5FFFF54, kDRAMAddress); // DAR1
+        } else {
+            probe.MemWriteLong(0x5FFFF50, kDRAMAddress); // SAR1
+            probe.MemWriteLong(0x5FFFF54, kFIFOAddress); // DAR1
+        }
+        probe.MemWriteWord(0x5FFFF5A, kTransferCount); // TCR1
+        // CHCR1: DM/SM = increment DRAM side, fixed FIFO side; RS = DREQ# dual address; TS = word; IE = 1; DE = 1
+        probe.MemWriteWord(0x5FFFF5E, toMemory ? 0x400D : 0x100D);
+        probe.MemWriteWord(0x5FFFF48, 0x0001); // DMAOR: DME = 1
+    }
+
+    bool TransferEnded() const {
+        return probe.MemPeekWord(0x5FFFF5E) & 2;
+    }
+
+    // -------------------------------------------------------------------------
+    // Host side of the FIFO
+
+    void HostWrite(uint16 value) {
+        if (fifo.size() >= kFIFOCapacity) {
+            // Force transfer if possible, like the YGR
+            sh1.CbStepDMAC1(sizeof(uint16));
+            if (fifo.size() >= kFIFOCapacity) {
+                return;
+            }
+        }
+        fifo.push_back(value);
+        hostWords.push_back(value);
+        UpdateDREQ();
+    }
+
+    void HostRead() {
+        if (fifo.empty()) {
+            // Force transfer if possible, like the YGR
+            sh1.CbStepDMAC1(sizeof(uint16));
+            if (fifo.empty()) {
+                return;
+            }
+        }
+        hostWords.push_back(fifo.front());
+        fifo.pop_front();
+        UpdateDREQ();
+    }
+
+    // -------------------------------------------------------------------------
+    // SH-1 side of the FIFO
+
+    bool IsDREQBlocked() const {
+        return toMemory ? fifo.empty() : fifo.size() >= kFIFOCapacity;
+    }
+
+    void UpdateDREQ() {
+        const bool level = IsDREQBlocked();
+        if (level != nDREQ1) {
+            dreqToggles.push_back({cycles, level});
+            nDREQ1 = level;
+        }
+        sh1.SetDREQ1n(level);
+    }
+
+    uint16 Read() {
+        if (!toMemory || fifo.empty()) {
+            return 0;
+        }
+        const uint16 value = fifo.front();
+        fifo.pop_front();
+        UpdateDREQ();
+        return value;
+    }
+
+    void Write(uint16 value) {
+        if (toMemory || fifo.size() >= kFIFOCapacity) {
+            return;
+        }
+        fifo.push_back(value);
+        UpdateDREQ();
+    }
+
+    // Same as a sequence of Read() calls, but DREQ1# is only updated once at the end
+    uint32 ReadBurst(uint16 *out, uint32 count) {
+        if (!toMemory) {
+            return 0;
+        }
+        uint32 units = 0;
+        while (units < count && !fifo.empty()) {
+            out[units++] = fifo.front();
+            fifo.pop_front();
+            if (IsDREQBlocked()) {
+                break;
+            }
+        }
+        multiUnitBursts += units > 1;
+        UpdateDREQ();
+        return units;
+    }
+
+    // Same as a sequence of Write() calls, but DREQ1# is only updated once at the end
+    uint32 WriteBurst(const uint16 *in, uint32 count) {
+        if (toMemory) {
+            return 0;
+        }
+        uint32 units = 0;
+        while (units < count && fifo.size() < kFIFOCapacity) {
+            fifo.push_back(in[units++]);
+            if (IsDREQBlocked()) {
+                break;
+            }
+        }
+        multiUnitBursts += units > 1;
+        UpdateDREQ();
+        return units;
+    }
+};
+
+// Runs a whole transfer with a randomized host and time slice schedule that only depends on the seed.
+// If stepping is true, the SH-1 is run one instruction at a time, otherwise in time slices of varying lengths.
+static TransferResult RunTransfer(bool burst, bool toMemory, bool stepping, uint32 seed) {
+    auto subject = std::make_unique<TestSubject>(burst, toMemory);
+
+    std::mt19937 rng{seed};
+    for (uint32 i = 0; i < kTransferCount; ++i) {
+        util::WriteBE<uint16>(&subject->dram[(kDRAMAddress & 0xFFFFF) + i * sizeof(uint16)], rng());
+    }
+
+    subject->StartTransfer();
+
+    TransferResult result{};
+    bool ended = false;
+    for (uint32 iter = 0; iter < 100000 && !ended; ++iter) {
+        const uint32 hostWords = rng() % 4;
+        for (uint32 i = 0; i < hostWords; ++i) {
+            const uint16 value = rng();
+            if (toMemory) {
+                subject->HostWrite(value);
+            } else {
+                subject->HostRead();
+            }
+        }
+
+        const uint64 sliceCycles = rng() % 48 + 1;
+        if (stepping) {
+            subject->cycles += subject->sh1.Step();
+        } else {
+            subject->cycles += subject->sh1.Advance(sliceCycles, 0);
+        }
+
+        if (subject->TransferEnded()) {
+            result.endCycle = subject->cycles;
+            ended = true;
+        }
+    }
+    REQUIRE(ended);
+
+    // Let the host collect the rest of the data
+    while (!toMemory && !subject->fifo.empty()) {
+        subject->HostRead();
+    }
+
+    for (uint32 i = 0; i < kTransferCount; ++i) {
+        result.dram.push_back(subject->bus.Peek<uint16>((kDRAMAddress & 0xFFFFFFF) + i * sizeof(uint16)));
+    }
+    result.hostWords = subject->hostWords;
+    result.dreqToggles = subject->dreqToggles;
+    result.multiUnitBursts = subject->multiUnitBursts;
+
+    savestate::SH1SaveState state{};
+    subject->sh1.SaveState(state);
+    result.channel = state.dmac.channels[1];
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+// YGR FIFO
+
+// Data port of the YGR FIFO on the host bus
+inline constexpr uint32 kHostFIFOAddress = 0x5890000;
+
+// YGR transfer control register (TRCTL) on the CD block bus
+inline constexpr uint32 kTRCTLAddress = 0xA000002;
+
+enum class YGRTransferMode {
+    HostToCDB, // host -> FIFO -> DRAM (TRCTL.DIR = 1)
+    CDBToHost, // DRAM -> FIFO -> host (TRCTL.DIR = 0)
+
+    // DRAM -> FIFO while the FIFO is set up for host -> CD block transfers (TRCTL.DIR = 1). Every word written by the
+    // SH-1 clears TRCTL.TE, which withdraws DREQ1# right after the first word of a burst. The CD block program then
+    // reads the FIFO back, and reading the last word sets TRCTL.TE again.
+    TEToggle,
+};
+
+struct YGRTransferResult {
+    std::vector<uint16> dram;
+    std::vector<uint16> hostWords;
+    std::vector<uint16> cdbWords;
+    std::vector<DREQToggle> dreqToggles;
+    savestate::SH1SaveState::DMAC::Channel channel;
+    savestate::YGRSaveState ygr;
+    uint64 endCycle;
+};
+
+// SH-1 with DRAM and a real YGR. The host side of the FIFO is accessed through an SH-2 bus with the YGR's host
+// registers mapped in. Without bursts, the YGR is mapped into a separate bus and the SH-1 bus only forwards 16-bit
+// accesses to it, which hides the YGR's burst handlers from the DMAC.
+struct YGRTestSubject {
+    sys::SH1Bus bus{};
+    sys::SH1Bus ygrBus{};
+    sys::SH2Bus hostBus{};
+    sh1::SH1 sh1{bus};
+    sh1::SH1::Probe &probe{sh1.GetProbe()};
+    cdblock::YGR ygr{};
+
+    std::array<uint8, sh1::kROMSize> rom{};
+    std::array<uint8, 512 * 1024> dram{};
+
+    const YGRTransferMode mode;
+
+    bool nDREQ1 = true;
+
+    std::vector<uint16> hostWords;
+    std::vector<uint16> cdbWords;
+    std::vector<DREQToggle> dreqToggles;
+    uint64 cycles = 0;
+
+    YGRTestSubject(bool burst, YGRTransferMode mode)
+        : mode(mode) {
+        LoadIdleLoop(sh1, rom);
+
+        bus.MapArray(0x9000000, 0x9FFFFFF, dram, true);
+        if (burst) {
+            ygr.MapMemory(bus);
+        } else {
+            ygr.MapMemory(ygrBus);
+            bus.MapNormal(
+                0xA000000, 0xCFFFFFF, &ygrBus,
+                [](uint32 address, void *ctx) -> uint16 {
+                    return static_cast<sys::SH1Bus *>(ctx)->Read<uint16>(address);
+                },
+                [](uint32 address, uint16 value, void *ctx) {
+                    static_cast<sys::SH1Bus *>(ctx)->Write<uint16>(address, value);
+                });
+        }
+        ygr.MapMemory(hostBus);
+
+        ygr.MapCallbacks(sh1.CbAssertIRQ6, sh1.CbAssertIRQ7, sh1.CbSetDREQ0n,
+                         util::MakeClassMemberRequiredCallback<&YGRTestSubject::SetDREQ1n>(this), sh1.CbStepDMAC1,
+                         util::MakeClassMemberRequiredCallback<&YGRTestSubject::TriggerExternalInterrupt0>(this));
+
+        sh1.Reset(true);
+        ygr.Reset();
+    }
+
+    void SetDREQ1n(bool level) {
+        if (level != nDREQ1) {
+            dreqToggles.push_back({cycles, level});
+            nDREQ1 = level;
+        }
+        sh1.SetDREQ1n(level);
+    }
+
+    void TriggerExternalInterrupt0() {}
+
+    // Enables FIFO transfers and sets up DMAC channel 1 to transfer between the FIFO and DRAM on DREQ1#
+    void StartTransfer() {
+        // TRCTL: reset the FIFO, then set TE and DIR
+        probe.MemWriteWord(kTRCTLAddress, 0x0002);
+        probe.MemWriteWord(kTRCTLAddress, mode == YGRTransferMode::CDBToHost ? 0x0004 : 0x0005);
+
+        const bool toMemory = mode == YGRTransferMode::HostToCDB;
+        if (toMemory) {
+            probe.MemWriteLong(0x5FFFF50, kFIFOAddress); // SAR1
+            probe.MemWriteLong(0x5FFFF54, kDRAMAddress); // DAR1
+        } else {
+            probe.MemWriteLong(0x5FFFF50, kDRAMAddress); // SAR1
+            probe.MemWriteLong(0x5FFFF54, kFIFOAddress); // DAR1
+        }
+        probe.MemWriteWord(0x5FFFF5A, kTransferCount); // TCR1
+        // CHCR1: DM/SM = increment DRAM side, fixed FIFO side; RS = DREQ# dual address; TS = word; IE = 1; DE = 1
+        probe.MemWriteWord(0x5FFFF5E, toMemory ? 0x400D : 0x100D);
+        probe.MemWriteWord(0x5FFFF48, 0x0001); // DMAOR: DME = 1
+    }
+
+    bool TransferEnded() const {
+        return probe.MemPeekWord(0x5FFFF5E) & 2;
+    }
+
+    savestate::YGRSaveState YGRState() const {
+        savestate::YGRSaveState state{};
+        ygr.SaveState(state);
+        return state;
+    }
+};
+
+// Runs a whole transfer through a real YGR with a randomized host and time slice schedule that only depends on the
+// seed. If stepping is true, the SH-1 is run one instruction at a time, otherwise in time slices of varying lengths.
+static YGRTransferResult RunYGRTransfer(bool burst, YGRTransferMode mode, bool stepping, uint32 seed) {
+    auto subject = std::make_unique<YGRTestSubject>(burst, mode);
+    REQUIRE(subject->bus.HasBurstRead16(kFIFOAddress) == burst);
+    REQUIRE(subject->bus.HasBurstWrite16(kFIFOAddress) == burst);
+
+    std::mt19937 rng{seed};
+    for (uint32 i = 0; i < kTransferCount; ++i) {
+        util::WriteBE<uint16>(&subject->dram[(kDRAMAddress & 0xFFFFF) + i * sizeof(uint16)], rng());
+    }
+
+    subject->StartTransfer();
+
+    YGRTransferResult result{};
+    bool ended = false;
+    for (uint32 iter = 0; iter < 100000 && !ended; ++iter) {
+        const uint32 hostWords = rng() % 4;
+        for (uint32 i = 0; i < hostWords; ++i) {
+            switch (mode) {
+            case YGRTransferMode::HostToCDB:
+                // A full FIFO forces a transfer, so the host never needs to wait
+                if (subject->hostWords.size() < kTransferCount) {
+                    const uint16 value = rng();
+                    subject->hostBus.Write<uint16>(kHostFIFOAddress, value);
+                    subject->hostWords.push_back(value);
+                }
+                break;
+            case YGRTransferMode::CDBToHost:
+                // An empty FIFO forces a transfer, so the host never needs to wait
+                if (subject->hostWords.size() < kTransferCount) {
+                    subject->hostWords.push_back(subject->hostBus.Read<uint16>(kHostFIFOAddress));
+                }
+                break;
+            case YGRTransferMode::TEToggle:
+                // Leave room for the word written by the SH-1
+                if (subject->YGRState().fifo.count < 4) {
+                    const uint16 value = rng();
+                    subject->hostBus.Write<uint16>(kHostFIFOAddress, value);
+                    subject->hostWords.push_back(value);
+                }
+                break;
+            }
+        }
+
+        const uint64 sliceCycles = rng() % 48 + 1;
+        if (stepping) {
+            subject->cycles += subject->sh1.Step();
+        } else {
+            subject->cycles += subject->sh1.Advance(sliceCycles, 0);
+        }
+
+        if (mode == YGRTransferMode::TEToggle && (subject->YGRState().regs.TRCTL & 4) == 0) {
+            // Read the FIFO back from the CD block side; reading the last word sets TE again
+            while (subject->YGRState().fifo.count > 0) {
+                subject->cdbWords.push_back(subject->probe.MemReadWord(kFIFOAddress));
+            }
+        }
+
+        if (subject->TransferEnded()) {
+            result.endCycle = subject->cycles;
+            ended = true;
+        }
+    }
+    REQUIRE(ended);
+
+    // Let the host collect the rest of the data
+    while (mode == YGRTransferMode::CDBToHost && subject->hostWords.size() < kTransferCount) {
+        subject->hostWords.push_back(subject->hostBus.Read<uint16>(kHostFIFOAddress));
+    }
+
+    for (uint32 i = 0; i < kTransferCount; ++i) {
+        result.dram.push_back(subject->bus.Peek<uint16>((kDRAMAddress & 0xFFFFFFF) + i * sizeof(uint16)));
+    }
+    result.hostWords = subject->hostWords;
+    result.cdbWords = subject->cdbWords;
+    result.dreqToggles = subject->dreqToggles;
+    result.ygr = subject->YGRState();
+
+    savestate::SH1SaveState state{};
+    subject->sh1.SaveState(state);
+    result.channel = state.dmac.channels[1];
+    return result;
+}
+
+} // namespace sh1_dmac
+
+using namespace sh1_dmac;
+
+TEST_CASE("SH-1 DMAC channel 1 bursts match single-unit transfers", "[sh1][dmac]") {
+    for (const bool toMemory : {true, false}) {
+        for (const bool stepping : {true, false}) {
+            for (const uint32 seed : {1u, 12345u, 987654u}) {
+                INFO(fmt::format("{}, {}, seed {}", toMemory ? "FIFO -> DRAM" : "DRAM -> FIFO",
+                                 stepping ? "stepping" : "time slices", seed));
+
+                const TransferResult single = RunTransfer(false, toMemory, stepping, seed);
+                const TransferResult burst = RunTransfer(true, toMemory, stepping, seed);
+
+                // Sanity check the reference
+                CHECK(single.channel.TCR == 0);
+                CHECK((single.channel.CHCR & 2) == 2);
+                CHECK(single.hostWords.size() >= kTransferCount);
+                CHECK(std::equal(single.dram.begin(), single.dram.end(), single.hostWords.begin()));
+
+                // Make sure the burst path is actually taken
+                CHECK(burst.multiUnitBursts > 0);
+
+                CHECK(burst.dram == single.dram);
+                CHECK(burst.hostWords == single.hostWords);
+                CHECK(burst.dreqToggles == single.dreqToggles);
+                CHECK(burst.channel.SAR == single.channel.SAR);
+                CHECK(burst.channel.DAR == single.channel.DAR);
+                CHECK(burst.channel.TCR == single.channel.TCR);
+                CHECK(burst.channel.CHCR == single.channel.CHCR);
+                CHECK(burst.endCycle == single.endCycle);
+            }
+        }
+    }
+}
+
+TEST_CASE("SH-1 DMAC channel 1 bursts through the YGR FIFO match single-unit transfers", "[sh1][dmac][ygr]") {
+    using enum YGRTransferMode;
+    for (const YGRTransferMode mode : {HostToCDB, CDBToHost, TEToggle}) {
+        for (const bool stepping : {true, false}) {
+            for (const uint32 seed : {1u, 12345u, 987654u}) {
+                static constexpr const char *kModeNames[] = {"host -> CDB", "CDB -> host", "TE toggle"};
+                INFO(fmt::format("{}, {}, seed {}", kModeNames[static_cast<uint32>(mode)],
+                                 stepping ? "stepping" : "time slices", seed));
+
+                const YGRTransferResult single = RunYGRTransfer(false, mode, stepping, seed);
+                const YGRTransferResult burst = RunYGRTransfer(true, mode, stepping, seed);
+
+                // Sanity check the reference
+                CHECK(single.channel.TCR == 0);
+                CHECK((single.channel.CHCR & 2) == 2);
+                switch (mode) {
+                case YGRTransferMode::HostToCDB: CHECK(single.dram == single.hostWords); break;
+                case YGRTransferMode::CDBToHost: CHECK(single.hostWords == single.dram); break;
+                case YGRTransferMode::TEToggle: {
+                    // The words written by the SH-1 are read back in order, interleaved with the host's words
+                    CHECK(single.cdbWords.size() == single.hostWords.size() + kTransferCount);
+                    auto it = single.cdbWords.begin();
+                    for (const uint16 value : single.dram) {
+                        it = std::find(it, single.cdbWords.end(), value);
+                        REQUIRE(it != single.cdbWords.end());
+                        ++it;
+                    }
+                    break;
+                }
+                }
+
+                CHECK(burst.dram == single.dram);
+                CHECK(burst.hostWords == single.hostWords);
+                CHECK(burst.cdbWords == single.cdbWords);
+                CHECK(burst.dreqToggles == single.dreqToggles);
+                CHECK(burst.channel.SAR == single.channel.SAR);
+                CHECK(burst.channel.DAR == single.channel.DAR);
+                CHECK(burst.channel.TCR == single.channel.TCR);
+                CHECK(burst.channel.CHCR == single.channel.CHCR);
+                CHECK(burst.ygr.fifo.data == single.ygr.fifo.data);
+                CHECK(burst.ygr.fifo.readPos == single.ygr.fifo.readPos);
+                CHECK(burst.ygr.fifo.writePos == single.ygr.fifo.writePos);
+                CHECK(burst.ygr.fifo.count == single.ygr.fifo.count);
+                CHECK(burst.ygr.regs.TRCTL == single.ygr.regs.TRCTL);
+                CHECK(burst.endCycle == single.endCycle);
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/hw/sh1/sh1.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <fmt/format.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Test subject class
+
+using namespace ymir;
+
+namespace sh1_itu {
+
+inline constexpr uint32 kITUBase = 0x5FFFF00;
+
+// Register offsets of the five timers from kITUBase
+inline constexpr std::array<uint32, 5> kTimerBase = {0x04, 0x0E, 0x18, 0x22, 0x32};
+
+// Register offsets within each timer
+inline constexpr uint32 kTCR = 0x0;
+inline constexpr uint32 kTIOR = 0x1;
+inline constexpr uint32 kTIER = 0x2;
+inline constexpr uint32 kTSR = 0x3;
+inline constexpr uint32 kTCNT = 0x4;
+inline constexpr uint32 kGRA = 0x6;
+inline constexpr uint32 kGRB = 0x8;
+inline constexpr uint32 kBRA = 0xA; // timers 3 and 4 only
+inline constexpr uint32 kBRB = 0xC; // timers 3 and 4 only
+
+// SH-1 spinning in an idle loop. The test programs the ITU between time slices.
+struct TestSubject {
+    sys::SH1Bus bus{};
+    sh1::SH1 sh1{bus};
+    sh1::SH1::Probe &probe{sh1.GetProbe()};
+
+    std::array<uint8, sh1::kROMSize> rom{};
+
+    TestSubject() {
+        // Reset vector points to an infinite loop:
+        //   0400: bra 0400
+        //   0402: nop
+        util::WriteBE<uint32>(&rom[0x0], 0x400);
+        util::WriteBE<uint32>(&rom[0x4], 0xF001000);
+        util::WriteBE<uint16>(&rom[0x400], 0xAFFE);
+        util::WriteBE<uint16>(&rom[0x402], 0x0009);
+        sh1.LoadROM(rom);
+        sh1.Reset(true);
+
+        // Give all ITU interrupts a priority so that they show up as pending interrupts.
+        // SR.I stays at 15, so none of them are ever serviced.
+        probe.MemWriteWord(0x5FFFF88, 0x5678); // IPRC
+        probe.MemWriteWord(0x5FFFF8A, 0x9ABC); // IPRD
+        probe.MemWriteWord(0x5FFFF8C, 0xDEF1); // IPRE
+    }
+
+    // Applies a random register write or input capture
+    void RandomAccess(std::mt19937 &rng) {
+        const uint32 timer = kTimerBase[rng() % kTimerBase.size()];
+        const uint32 value = rng();
+        switch (value % 10) {
+        case 0: probe.MemWriteByte(kITUBase + 0x00, 0xE0 | (rng() & 0x1F)); break; // TSTR
+        case 1: probe.MemWriteByte(kITUBase + 0x02, rng() & 0x7F); break;          // TMDR
+        case 2: probe.MemWriteByte(kITUBase + 0x03, rng() & 0x3F); break;          // TFCR
+        case 3: probe.MemWriteByte(kITUBase + timer + kTCR, rng() & 0x7F); break;
+        case 4: probe.MemWriteByte(kITUBase + timer + kTIOR, rng() & 0x7F); break;
+        case 5: probe.MemWriteByte(kITUBase + timer + kTIER, rng() & 0x07); break;
+        case 6: // Clear random flags
+        {
+            const uint8 tsr = probe.MemReadByte(kITUBase + timer + kTSR);
+            probe.MemWriteByte(kITUBase + timer + kTSR, tsr & rng());
+            break;
+        }
+        case 7: probe.MemWriteWord(kITUBase + timer + kTCNT, rng()); break;
+        case 8: // Keep compare values small so that compare matches happen often
+            probe.MemWriteWord(kITUBase + timer + (rng() % 2 ? kGRA : kGRB), rng() % 0x400);
+            break;
+        case 9: sh1.SetTIOCB3(rng() % 2); break;
+        }
+    }
+
+    // Reads all ITU registers along with the pending interrupt.
+    // Reading TSR has side effects, so this must be done at the same points in both subjects.
+    std::vector<uint32> ReadState() {
+        std::vector<uint32> state;
+        state.push_back(probe.MemReadByte(kITUBase + 0x00));
+        state.push_back(probe.MemReadByte(kITUBase + 0x01));
+        state.push_back(probe.MemReadByte(kITUBase + 0x02));
+        state.push_back(probe.MemReadByte(kITUBase + 0x03));
+        state.push_back(probe.MemReadByte(kITUBase + 0x31));
+        for (uint32 i = 0; i < kTimerBase.size(); ++i) {
+            const uint32 base = kITUBase + kTimerBase[i];
+            state.push_back(probe.MemReadByte(base + kTCR));
+            state.push_back(probe.MemReadByte(base + kTIOR));
+            state.push_back(probe.MemReadByte(base + kTIER));
+            state.push_back(probe.MemReadByte(base + kTSR));
+            state.push_back(probe.MemReadWord(base + kTCNT));
+            state.push_back(probe.MemReadWord(base + kGRA));
+            state.push_back(probe.MemReadWord(base + kGRB));
+            if (i >= 3) {
+                state.push_back(probe.MemReadWord(base + kBRA));
+                state.push_back(probe.MemReadWord(base + kBRB));
+            }
+        }
+
+        savestate::SH1SaveState saveState{};
+        sh1.SaveState(saveState);
+        state.push_back(saveState.intc.pendingSource);
+        state.push_back(saveState.intc.pendingLevel);
+        return state;
+    }
+};
+
+} // namespace sh1_itu
+
+using namespace sh1_itu;
+
+TEST_CASE("SH-1 ITU lazy updates match updating the timers on every time slice", "[sh1][itu]") {
+    for (const uint32 seed : {1u, 2024u, 31337u}) {
+        INFO(fmt::format("seed {}", seed));
+
+        // The reference subject synchronizes the ITU after every time slice, which brings the timers up to the start
+        // of the slice like the SH-1 used to do before running each slice. The lazy subject is left alone between
+        // checkpoints, where the same register accesses are made on both.
+        auto reference = std::make_unique<TestSubject>();
+        auto lazy = std::make_unique<TestSubject>();
+
+        std::mt19937 rng{seed};
+        std::mt19937 refRng{seed};
+        std::mt19937 lazyRng{seed};
+
+        uint64 cycles = 0;
+        for (uint32 checkpoint = 0; checkpoint < 2000; ++checkpoint) {
+            const uint32 accesses = rng() % 3;
+            for (uint32 i = 0; i < accesses; ++i) {
+                reference->RandomAccess(refRng);
+                lazy->RandomAccess(lazyRng);
+            }
+
+            const uint32 slices = rng() % 8 + 1;
+            for (uint32 i = 0; i < slices; ++i) {
+                const uint64 sliceCycles = rng() % 200 + 1;
+                const uint64 refCycles = reference->sh1.Advance(sliceCycles, 0);
+                const uint64 lazyCycles = lazy->sh1.Advance(sliceCycles, 0);
+                REQUIRE(refCycles == lazyCycles);
+                cycles += refCycles;
+
+                // Read a counter, which synchronizes the whole ITU
+                reference->probe.MemReadWord(kITUBase + kTimerBase[0] + kTCNT);
+            }
+
+            INFO(fmt::format("checkpoint {}, cycle {}", checkpoint, cycles));
+            REQUIRE(lazy->ReadState() == reference->ReadState());
+        }
+    }
+}
@@ -0,0 +1,320 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/hw/cdblock/cd_drive.hpp>
+#include <ymir/hw/sh1/sh1.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <fmt/format.h>
+
+#include <bit>
+#include <memory>
+#include <random>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Test subject class
+
+using namespace ymir;
+
+namespace sh1_sci {
+
+// SCI0 registers
+inline constexpr uint32 kSMR0 = 0x5FFFEC0;
+inline constexpr uint32 kBRR0 = 0x5FFFEC1;
+inline constexpr uint32 kSCR0 = 0x5FFFEC2;
+inline constexpr uint32 kTDR0 = 0x5FFFEC3;
+inline constexpr uint32 kSSR0 = 0x5FFFEC4;
+inline constexpr uint32 kRDR0 = 0x5FFFEC5;
+
+// BRR = 3 with the phi/1 clock results in 16 cycles per bit
+inline constexpr uint64 kCyclesPerBit = 16;
+
+// SH-1 spinning in an idle loop with SCI0 wired to a peer. The test acts as the CD block program driving SCI0.
+struct TestSubject {
+    sys::SH1Bus bus{};
+    sh1::SH1 sh1{bus};
+    sh1::SH1::Probe &probe{sh1.GetProbe()};
+
+    std::array<uint8, sh1::kROMSize> rom{};
+
+    // Total cycles executed by the SH-1, which is the time base used by SCI transfers
+    uint64 cycles = 0;
+
+    // Bytes the mock peer shifts into the SH-1 and the bytes it received, along with the cycle count at the start of
+    // the time slice in which they were exchanged
+    std::vector<uint8> peerTxBytes;
+    size_t peerTxPos = 0;
+    std::vector<uint8> peerRxBytes;
+    std::vector<uint64> peerRxCycles;
+    std::vector<uint64> peerTxCycles;
+
+    TestSubject() {
+        // Reset vector points to an infinite loop:
+        //   0400: bra 0400
+        //   0402: nop
+        util::WriteBE<uint32>(&rom[0x0], 0x400);
+        util::WriteBE<uint32>(&rom[0x4], 0xF001000);
+        util::WriteBE<uint16>(&rom[0x400], 0xAFFE);
+        util::WriteBE<uint16>(&rom[0x402], 0x0009);
+        sh1.LoadROM(rom);
+        sh1.Reset(true);
+
+        sh1.SetSCI0Callbacks(util::MakeClassMemberRequiredCallback<&TestSubject::PeerTransmit>(this),
+                             util::MakeClassMemberRequiredCallback<&TestSubject::PeerReceive>(this));
+    }
+
+    // Sets up SCI0 in clocked synchronous mode with an internal clock and enables the transmitter and receiver
+    void ConfigureSCI0() {
+        probe.MemWriteByte(kSMR0, 0x80);
+        probe.MemWriteByte(kBRR0, 0x03);
+        probe.MemWriteByte(kSCR0, 0x30);
+    }
+
+    void Advance(uint64 sliceCycles) {
+        cycles += sh1.Advance(sliceCycles, 0);
+    }
+
+    savestate::SH1SaveState SaveState() const {
+        savestate::SH1SaveState state{};
+        sh1.SaveState(state);
+        return state;
+    }
+
+    // -------------------------------------------------------------------------
+    // CD block program side
+
+    bool TransmitterIdle() const {
+        return probe.MemPeekByte(kSSR0) & 0x04;
+    }
+
+    bool HasReceived() const {
+        return probe.MemPeekByte(kSSR0) & 0x40;
+    }
+
+    void Transmit(uint8 value) {
+        probe.MemWriteByte(kTDR0, value);
+        const uint8 ssr = probe.MemReadByte(kSSR0);
+        probe.MemWriteByte(kSSR0, ssr & ~0x80);
+    }
+
+    uint8 Receive() {
+        const uint8 value = probe.MemReadByte(kRDR0);
+        const uint8 ssr = probe.MemReadByte(kSSR0);
+        probe.MemWriteByte(kSSR0, ssr & ~0x40);
+        return value;
+    }
+
+    // Determines how many frames end by the start of the next time slice based on the saved SCI0 state: none, the frame
+    // in TSR, or also the one queued in TDR.
+    // An idle channel rewinds its frame timing to cycle zero, so frames queued after an idle period end right away.
+    uint32 FramesEndingNow() const {
+        const auto state = SaveState();
+        const auto &ch = state.sci.channels[0];
+        const bool txEnable = ch.SCR & 0x20;
+        const bool txEnd = ch.SSR & 0x04;
+        if (!txEnable || txEnd || ch.TSRbit == 0u) {
+            return 0;
+        }
+        const uint64 bitsLeft = 8u - std::countr_zero(ch.TSRbit);
+        const uint64 frameEnd = ch.currCycles + bitsLeft * kCyclesPerBit;
+        if (state.totalCycles < frameEnd) {
+            return 0;
+        }
+        return ch.TDRvalid && state.totalCycles >= frameEnd + 8 * kCyclesPerBit ? 2 : 1;
+    }
+
+    // -------------------------------------------------------------------------
+    // Mock peer
+
+    uint8 PeerTransmit() {
+        peerTxCycles.push_back(cycles);
+        const uint8 value = peerTxBytes[peerTxPos];
+        peerTxPos = (peerTxPos + 1) % peerTxBytes.size();
+        return value;
+    }
+
+    void PeerReceive(uint8 value) {
+        peerRxCycles.push_back(cycles);
+        peerRxBytes.push_back(value);
+    }
+};
+
+// CD drive resuming a transfer from a save state, connected to the SH-1 in place of the mock peer
+struct DriveTestSubject : TestSubject {
+    core::Scheduler scheduler{};
+    media::Disc disc{};
+    media::fs::Filesystem fs{};
+    core::Configuration::CDBlock config{};
+    cdblock::CDDrive drive{scheduler, disc, fs, config};
+
+    DriveTestSubject() {
+        drive.MapCallbacks(sh1.CbSetCOMSYNCn, sh1.CbSetCOMREQn, sh1.CbCDBDataSector,
+                           util::MakeClassMemberRequiredCallback<&DriveTestSubject::CDDASector>(this),
+                           util::MakeClassMemberRequiredCallback<&DriveTestSubject::SectorTransferDone>(this));
+        sh1.SetSCI0Callbacks(drive.CbSerialRx, drive.CbSerialTx);
+    }
+
+    savestate::CDDriveSaveState DriveState() const {
+        savestate::CDDriveSaveState state{};
+        drive.SaveState(state);
+        return state;
+    }
+
+    uint32 CDDASector(std::span<uint8, 2352> data) {
+        return 0;
+    }
+
+    void SectorTransferDone() {}
+};
+
+} // namespace sh1_sci
+
+using namespace sh1_sci;
+
+TEST_CASE("SH-1 SCI exchanges whole bytes at the end of each frame", "[sh1][sci]") {
+    for (const uint32 seed : {1u, 4321u, 8765309u}) {
+        INFO(fmt::format("seed {}", seed));
+
+        auto subject = std::make_unique<TestSubject>();
+        std::mt19937 rng{seed};
+
+        std::vector<uint8> txBytes(13);
+        for (auto &value : txBytes) {
+            value = rng();
+        }
+        subject->peerTxBytes.resize(13);
+        for (auto &value : subject->peerTxBytes) {
+            value = rng();
+        }
+
+        subject->ConfigureSCI0();
+
+        std::vector<uint8> rxBytes;
+        std::vector<uint8> expectedRxBytes;
+        size_t txPos = 0;
+        for (uint32 iter = 0; iter < 10000 && txPos < txBytes.size(); ++iter) {
+            if (subject->HasReceived()) {
+                rxBytes.push_back(subject->Receive());
+            }
+            if (txPos < txBytes.size() && subject->TransmitterIdle()) {
+                subject->Transmit(txBytes[txPos++]);
+                if (txPos < txBytes.size() && rng() % 2 == 0) {
+                    // Also fill TDR to send two frames back to back
+                    subject->Transmit(txBytes[txPos++]);
+                }
+            }
+
+            const uint32 frames = subject->FramesEndingNow();
+            const size_t prevExchanges = subject->peerRxBytes.size();
+            subject->Advance(rng() % 100 + 1);
+            REQUIRE(subject->peerRxBytes.size() - prevExchanges == frames);
+
+            // RDR only holds the last byte received in the slice
+            if (frames > 0) {
+                const size_t count = subject->peerTxBytes.size();
+                expectedRxBytes.push_back(subject->peerTxBytes[(subject->peerTxPos + count - 1) % count]);
+            }
+        }
+        if (subject->HasReceived()) {
+            rxBytes.push_back(subject->Receive());
+        }
+
+        CHECK(subject->peerRxBytes == txBytes);
+        CHECK(rxBytes == expectedRxBytes);
+
+        // The receive byte is taken in the same slice as the transmit byte
+        CHECK(subject->peerTxCycles == subject->peerRxCycles);
+    }
+}
+
+TEST_CASE("SH-1 SCI resumes frames from save states taken in the middle of a byte", "[sh1][sci]") {
+    auto subject = std::make_unique<TestSubject>();
+    subject->peerTxBytes = {0x3C};
+
+    subject->ConfigureSCI0();
+    subject->Transmit(0xA5);
+
+    // Pretend the state was saved three bits into the frame by a version that shifted one bit at a time
+    auto state = subject->SaveState();
+    auto &ch = state.sci.channels[0];
+    REQUIRE(ch.TSR == 0xA5);
+    ch.TSRbit = 1u << 3u;
+    ch.RSRbit = 1u << 3u;
+    ch.RSR = 0x04;
+    ch.currCycles = state.totalCycles;
+    subject->sh1.LoadState(state);
+
+    // The frame ends after the remaining five bits
+    const uint64 frameEnd = subject->cycles + 5 * kCyclesPerBit;
+    while (subject->peerRxBytes.empty() && subject->cycles < frameEnd + 100) {
+        subject->Advance(7);
+    }
+    REQUIRE(subject->peerRxBytes.size() == 1);
+    CHECK(subject->peerRxBytes[0] == 0xA5);
+    CHECK(subject->peerRxCycles[0] >= frameEnd);
+    CHECK(subject->peerRxCycles[0] < frameEnd + 16);
+
+    // The whole byte is taken from the peer
+    REQUIRE(subject->HasReceived());
+    CHECK(subject->Receive() == 0x3C);
+}
+
+TEST_CASE("SH-1 SCI resumes CD drive transfers from save states taken in the middle of a byte", "[sh1][sci][cddrive]") {
+    auto subject = std::make_unique<DriveTestSubject>();
+
+    std::array<uint8, 13> command{};
+    std::array<uint8, 13> status{};
+    for (uint32 i = 0; i < 13; ++i) {
+        command[i] = 0x80 + i;
+        status[i] = 0x10 + i;
+    }
+
+    // The drive is five bits into the second command byte
+    auto driveState = subject->DriveState();
+    driveState.commandData.fill(0);
+    driveState.commandData[0] = command[0];
+    driveState.commandData[1] = command[1] & 0x1F;
+    driveState.commandPos = 13;
+    driveState.statusData = status;
+    driveState.statusPos = 13;
+    driveState.state = savestate::CDDriveSaveState::TxState::TxByte;
+    subject->drive.LoadState(driveState);
+
+    // ... and so is the SH-1
+    subject->ConfigureSCI0();
+    subject->Transmit(command[1]);
+    auto state = subject->SaveState();
+    state.sci.channels[0].TSRbit = 1u << 5u;
+    state.sci.channels[0].RSRbit = 1u << 5u;
+    state.sci.channels[0].RSR = status[1] & 0x1F;
+    state.sci.channels[0].currCycles = state.totalCycles;
+    subject->sh1.LoadState(state);
+
+    std::vector<uint8> rxBytes;
+    size_t txPos = 2;
+    for (uint32 iter = 0; iter < 10000 && rxBytes.size() < 12; ++iter) {
+        if (subject->HasReceived()) {
+            rxBytes.push_back(subject->Receive());
+
+            // Positions realign to byte boundaries after the first byte
+            const auto currState = subject->DriveState();
+            const uint8 expectedPos = (rxBytes.size() + 1) * 8 % (13 * 8);
+            CHECK(currState.commandPos == expectedPos);
+            CHECK(currState.statusPos == expectedPos);
+        }
+        if (txPos < command.size() && subject->TransmitterIdle()) {
+            subject->Transmit(command[txPos++]);
+        }
+        subject->Advance(10);
+    }
+
+    const std::vector<uint8> expectedRx(status.begin() + 1, status.end());
+    CHECK(rxBytes == expectedRx);
+
+    const auto finalState = subject->DriveState();
+    CHECK(finalState.commandData == command);
+    CHECK(finalState.commandPos == 0);
+    CHECK(finalState.statusPos == 0);
+    CHECK(finalState.state == savestate::CDDriveSaveState::TxState::TxEnd);
+}
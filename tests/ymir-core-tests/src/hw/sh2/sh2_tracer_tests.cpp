@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/hw/sh2/sh2.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <array>
+#include <span>
+#include <utility>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Test subject class
+
+using namespace ymir;
+
+namespace sh2_tracer {
+
+// Runs a loop of `add #1, r1` instructions on a standalone SH-2 backed by 64 KiB of mirrored RAM and collects the
+// traced events.
+struct TestSubject : debug::ISH2Tracer {
+    static constexpr uint32 kRAMMask = 0xFFFF;
+    static constexpr uint32 kCodeAddress = 0x100;
+    static constexpr uint32 kLoopLength = 16;
+
+    sys::SH2Bus bus{};
+    sh2::SH2 sh2{bus, true};
+    alignas(4) std::array<uint8, kRAMMask + 1> ram{};
+
+    TestSubject() {
+        bus.MapBoth(
+            0x000'0000, 0x7FF'FFFF, this,
+            [](uint32 address, void *ctx) -> uint8 { return static_cast<TestSubject *>(ctx)->ram[address & kRAMMask]; },
+            [](uint32 address, void *ctx) -> uint16 {
+                return util::ReadBE<uint16>(&static_cast<TestSubject *>(ctx)->ram[address & kRAMMask & ~1u]);
+            },
+            [](uint32 address, void *ctx) -> uint32 {
+                return util::ReadBE<uint32>(&static_cast<TestSubject *>(ctx)->ram[address & kRAMMask & ~3u]);
+            },
+            [](uint32 address, uint8 value, void *ctx) {
+                static_cast<TestSubject *>(ctx)->ram[address & kRAMMask] = value;
+            },
+            [](uint32 address, uint16 value, void *ctx) {
+                util::WriteBE<uint16>(&static_cast<TestSubject *>(ctx)->ram[address & kRAMMask & ~1u], value);
+            },
+            [](uint32 address, uint32 value, void *ctx) {
+                util::WriteBE<uint32>(&static_cast<TestSubject *>(ctx)->ram[address & kRAMMask & ~3u], value);
+            });
+
+        // Reset vectors
+        util::WriteBE<uint32>(&ram[0x0], kCodeAddress);
+        util::WriteBE<uint32>(&ram[0x4], 0x8000);
+
+        uint32 address = kCodeAddress;
+        for (uint32 i = 0; i < kLoopLength; ++i) {
+            util::WriteBE<uint16>(&ram[address], 0x7101); // add #1, r1
+            address += sizeof(uint16);
+        }
+        // bra loop; nop
+        const sint32 disp = (static_cast<sint32>(kCodeAddress) - static_cast<sint32>(address + 4)) / 2;
+        util::WriteBE<uint16>(&ram[address], 0xA000 | (disp & 0xFFF));
+        util::WriteBE<uint16>(&ram[address + 2], 0x0009);
+
+        sh2.Reset(true);
+        sh2.UseTracer(this);
+    }
+
+    // -------------------------------------------------------------------------
+    // ISH2Tracer implementation
+
+    void ExecuteInstruction(uint32 pc, uint16 opcode, bool delaySlot) override {
+        instructions.push_back({pc, opcode, delaySlot});
+    }
+
+    void BranchDelay(uint32 target) override {
+        branchTargets.push_back(target);
+    }
+
+    void DelaySlot(uint32 pc, uint32 target) override {
+        delaySlotTargets.push_back(target);
+    }
+
+    void Begin32x32Division(sint32 dividend, sint32 divisor, bool overflowIntrEnable) override {
+        divisions.push_back({dividend, divisor});
+    }
+
+    void EndDivision(sint32 quotient, sint32 remainder, bool overflow) override {
+        divisionResults.push_back({quotient, remainder});
+    }
+
+    void ProcessRecords(std::span<const debug::SH2TraceRecord> records) override {
+        batchSizes.push_back(records.size());
+        ISH2Tracer::ProcessRecords(records);
+    }
+
+    // -------------------------------------------------------------------------
+    // Traces
+
+    struct InstructionInfo {
+        uint32 pc;
+        uint16 opcode;
+        bool delaySlot;
+    };
+
+    std::vector<InstructionInfo> instructions;
+    std::vector<uint32> branchTargets;
+    std::vector<uint32> delaySlotTargets;
+    std::vector<std::pair<sint32, sint32>> divisions;
+    std::vector<std::pair<sint32, sint32>> divisionResults;
+    std::vector<size_t> batchSizes;
+};
+
+} // namespace sh2_tracer
+
+using namespace sh2_tracer;
+
+TEST_CASE_METHOD(TestSubject, "SH2 tracer records are delivered in order by the end of Advance", "[sh2][tracer]") {
+    sh2.Advance<true, false>(2000);
+
+    // All records must be delivered by the time Advance returns, in batches no larger than the trace buffer
+    REQUIRE(batchSizes.size() > 1);
+    size_t totalRecords = 0;
+    for (size_t size : batchSizes) {
+        totalRecords += size;
+    }
+    CHECK(totalRecords == instructions.size() + branchTargets.size() + delaySlotTargets.size());
+
+    // Every traced instruction must follow the loop, and every add must have been traced
+    uint32 expectedPC = kCodeAddress;
+    uint32 adds = 0;
+    uint32 branches = 0;
+    for (const InstructionInfo &instr : instructions) {
+        REQUIRE(instr.pc == expectedPC);
+        if (instr.opcode == 0x7101) {
+            CHECK_FALSE(instr.delaySlot);
+            ++adds;
+            expectedPC += sizeof(uint16);
+        } else if (instr.opcode == 0x0009) {
+            CHECK(instr.delaySlot);
+            expectedPC = kCodeAddress;
+        } else {
+            ++branches;
+            expectedPC += sizeof(uint16);
+        }
+    }
+    CHECK(adds == sh2.GetProbe().R(1));
+    CHECK(branchTargets.size() == branches);
+    for (uint32 target : branchTargets) {
+        CHECK(target == kCodeAddress);
+    }
+    for (uint32 target : delaySlotTargets) {
+        CHECK(target == kCodeAddress);
+    }
+}
+
+TEST_CASE_METHOD(TestSubject, "SH2 tracer records are delivered by the end of Step and stop when detached",
+                 "[sh2][tracer]") {
+    // Step delivers its records immediately
+    sh2.Step<true, false>();
+    REQUIRE(instructions.size() == 1);
+    CHECK(instructions[0].pc == kCodeAddress);
+
+    // No records are delivered after detaching
+    sh2.UseTracer(nullptr);
+    sh2.Advance<true, false>(100);
+    CHECK(instructions.size() == 1);
+}
+
+TEST_CASE_METHOD(TestSubject, "SH2 tracer records from probe divisions are delivered immediately", "[sh2][tracer]") {
+    // Divisions triggered by the debugger run outside of Advance and Step, possibly while the emulator is paused
+    auto &probe = sh2.GetProbe();
+    probe.DIVU().DVSR = 7;
+    probe.DIVU().DVDNT = 100;
+    probe.ExecuteDiv32();
+
+    REQUIRE(divisions.size() == 1);
+    CHECK(divisions[0] == std::pair<sint32, sint32>{100, 7});
+    REQUIRE(divisionResults.size() == 1);
+    CHECK(divisionResults[0] == std::pair<sint32, sint32>{14, 2});
+}
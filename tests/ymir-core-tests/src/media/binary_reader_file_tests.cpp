@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/media/binary_reader/binary_reader_file.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Test subject class
+
+using namespace ymir;
+
+namespace binary_reader_file {
+
+// Large enough to enable read-ahead and to wrap around the read-ahead ring a few times
+inline constexpr uintmax_t kFileSize = 2 * 1024 * 1024 + 1234;
+
+inline constexpr uintmax_t kSectorSize = 2352;
+
+struct TestSubject {
+    std::filesystem::path path;
+    std::vector<uint8> contents;
+
+    TestSubject() {
+        path = std::filesystem::temp_directory_path() / fmt::format("ymir-binary-reader-file-{}.bin",
+                                                                    std::hash<std::thread::id>{}(
+                                                                        std::this_thread::get_id()));
+
+        std::mt19937 rng{12345};
+        contents.resize(kFileSize);
+        for (auto &byte : contents) {
+            byte = rng();
+        }
+
+        std::ofstream out{path, std::ios::binary | std::ios::trunc};
+        out.write(reinterpret_cast<const char *>(contents.data()), contents.size());
+    }
+
+    ~TestSubject() {
+        std::error_code error{};
+        std::filesystem::remove(path, error);
+    }
+
+    // Reads sectors sequentially from startOffset and checks them against the file contents.
+    // Returns the number of mismatched sectors.
+    uint32 CheckSequentialReads(const media::IBinaryReader &reader, uintmax_t startOffset) const {
+        std::vector<uint8> buf(kSectorSize);
+        uint32 mismatches = 0;
+        for (uintmax_t offset = startOffset; offset < kFileSize; offset += kSectorSize) {
+            const uintmax_t expectedSize = std::min(kSectorSize, kFileSize - offset);
+            const uintmax_t size = reader.Read(offset, kSectorSize, buf);
+            if (size != expectedSize || !std::equal(buf.begin(), buf.begin() + size, contents.begin() + offset)) {
+                ++mismatches;
+            }
+        }
+        return mismatches;
+    }
+};
+
+} // namespace binary_reader_file
+
+using namespace binary_reader_file;
+
+TEST_CASE("FileBinaryReader reports errors and file size", "[media][binary_reader]") {
+    TestSubject subject{};
+
+    SECTION("Existing file") {
+        std::error_code error{};
+        media::FileBinaryReader reader{subject.path, error};
+        REQUIRE_FALSE(error);
+        CHECK(reader.Size() == kFileSize);
+    }
+
+    SECTION("Missing file") {
+        std::error_code error{};
+        media::FileBinaryReader reader{subject.path.string() + ".missing", error};
+        CHECK(error);
+    }
+}
+
+TEST_CASE("FileBinaryReader reads match the file contents", "[media][binary_reader]") {
+    TestSubject subject{};
+    std::error_code error{};
+    media::FileBinaryReader reader{subject.path, error};
+    REQUIRE_FALSE(error);
+
+    SECTION("Sequential reads") {
+        // Read the file twice to also cover a read-ahead window that jumps back to the start
+        CHECK(subject.CheckSequentialReads(reader, 0) == 0);
+        CHECK(subject.CheckSequentialReads(reader, 0) == 0);
+    }
+
+    SECTION("Random reads") {
+        std::mt19937 rng{54321};
+        std::vector<uint8> buf(kSectorSize * 4);
+        for (uint32 i = 0; i < 1000; ++i) {
+            const uintmax_t offset = rng() % kFileSize;
+            const uintmax_t size = rng() % buf.size();
+            const uintmax_t expectedSize = std::min(size, kFileSize - offset);
+            INFO(fmt::format("offset {:X} size {:X}", offset, size));
+            REQUIRE(reader.Read(offset, size, buf) == expectedSize);
+            CHECK(std::equal(buf.begin(), buf.begin() + expectedSize, subject.contents.begin() + offset));
+        }
+    }
+
+    SECTION("Reads past the end of the file") {
+        std::vector<uint8> buf(kSectorSize);
+        CHECK(reader.Read(kFileSize, buf.size(), buf) == 0);
+        CHECK(reader.Read(kFileSize + kSectorSize, buf.size(), buf) == 0);
+        CHECK(reader.Read(kFileSize - 10, buf.size(), buf) == 10);
+    }
+
+    SECTION("Reads limited by the output buffer") {
+        std::vector<uint8> buf(100);
+        CHECK(reader.Read(0, kSectorSize, buf) == buf.size());
+        CHECK(std::equal(buf.begin(), buf.end(), subject.contents.begin()));
+    }
+}
+
+TEST_CASE("FileBinaryReader can be shared between threads", "[media][binary_reader]") {
+    TestSubject subject{};
+    std::error_code error{};
+    media::FileBinaryReader reader{subject.path, error};
+    REQUIRE_FALSE(error);
+
+    // Each thread streams the file from a different starting point, which keeps moving the read-ahead window around
+    std::array<uint32, 4> mismatches{};
+    std::vector<std::thread> threads;
+    for (uint32 i = 0; i < mismatches.size(); ++i) {
+        threads.emplace_back([&, i] {
+            mismatches[i] = subject.CheckSequentialReads(reader, i * (kFileSize / mismatches.size() / kSectorSize) *
+                                                                     kSectorSize);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32 i = 0; i < mismatches.size(); ++i) {
+        INFO(fmt::format("thread {}", i));
+        CHECK(mismatches[i] == 0);
+    }
+}
@@ -0,0 +1,199 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ymir/sys/bus.hpp>
+
+#include <fmt/format.h>
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Test subject class
+
+using namespace ymir;
+
+namespace bus_fast_memory {
+
+inline constexpr uint32 kWRAMSize = 1024 * 1024;
+
+// Address ranges used by the test
+inline constexpr uint32 kWRAMLowStart = 0x020'0000;
+inline constexpr uint32 kWRAMLowEnd = 0x02F'FFFF;
+inline constexpr uint32 kMMIOStart = 0x100'0000;
+inline constexpr uint32 kMMIOEnd = 0x10F'FFFF;
+inline constexpr uint32 kWRAMHighStart = 0x600'0000;
+inline constexpr uint32 kWRAMHighEnd = 0x7FF'FFFF;
+
+struct MMIOWrite {
+    uint32 address;
+    uint32 value;
+    uint32 size;
+
+    bool operator==(const MMIOWrite &) const = default;
+};
+
+// SH-2 bus with Work RAM-like virtual memory blocks and an MMIO region that records writes.
+// If fast is true, the fast memory window is enabled; otherwise all accesses go through the page table.
+struct TestSubject {
+    sys::SH2Bus bus{};
+    util::VirtualMemory wramLow{kWRAMSize};
+    util::VirtualMemory wramHigh{kWRAMSize};
+    util::VirtualMemory extra{kWRAMSize};
+
+    std::vector<MMIOWrite> mmioWrites;
+
+    explicit TestSubject(bool fast) {
+        REQUIRE(wramLow.IsAllocated());
+        REQUIRE(wramHigh.IsAllocated());
+        REQUIRE(extra.IsAllocated());
+        std::memset(wramLow.GetMemory(), 0, kWRAMSize);
+        std::memset(wramHigh.GetMemory(), 0, kWRAMSize);
+        std::memset(extra.GetMemory(), 0, kWRAMSize);
+
+        bus.MapVirtualMemory(kWRAMLowStart, kWRAMLowEnd, wramLow, true, sys::kHostEndianMemory);
+        bus.MapVirtualMemory(kWRAMHighStart, kWRAMHighEnd, wramHigh, true, sys::kHostEndianMemory);
+        MapMMIO(kMMIOStart, kMMIOEnd);
+
+        if (fast) {
+#if Ymir_FF_FAST_MEMORY
+            REQUIRE(bus.EnableFastMemory(true));
+            REQUIRE(bus.IsFastMemoryEnabled());
+#else
+            REQUIRE_FALSE(bus.EnableFastMemory(true));
+#endif
+        }
+    }
+
+    void MapMMIO(uint32 start, uint32 end) {
+        bus.MapNormal(
+            start, end, this, [](uint32 address, void *) -> uint8 { return address * 3; },
+            [](uint32 address, void *) -> uint16 { return address * 5; },
+            [](uint32 address, void *) -> uint32 { return address * 7; },
+            [](uint32 address, uint8 value, void *ctx) {
+                static_cast<TestSubject *>(ctx)->mmioWrites.push_back({address, value, 1});
+            },
+            [](uint32 address, uint16 value, void *ctx) {
+                static_cast<TestSubject *>(ctx)->mmioWrites.push_back({address, value, 2});
+            },
+            [](uint32 address, uint32 value, void *ctx) {
+                static_cast<TestSubject *>(ctx)->mmioWrites.push_back({address, value, 4});
+            });
+    }
+};
+
+// Picks a random address in one of the interesting regions, including unmapped space
+static uint32 RandomAddress(std::mt19937 &rng) {
+    switch (rng() % 5) {
+    case 0: return kWRAMLowStart + rng() % kWRAMSize;
+    case 1: return kWRAMHighStart + rng() % (kWRAMHighEnd - kWRAMHighStart + 1);
+    case 2: return kWRAMHighStart + rng() % 0x1000; // hit the same words through different mirrors below
+    case 3: return kMMIOStart + rng() % (kMMIOEnd - kMMIOStart + 1);
+    default: return rng() & 0x7FF'FFFF;
+    }
+}
+
+// Applies the same random accesses to both subjects and checks that every read returns the same value
+static void RunAccesses(TestSubject &fast, TestSubject &ref, std::mt19937 &rng, uint32 count) {
+    for (uint32 i = 0; i < count; ++i) {
+        uint32 address = RandomAddress(rng);
+        if (rng() % 4 == 0) {
+            // Read the same offset through another mirror of High Work RAM
+            address = kWRAMHighStart + (address & (kWRAMSize - 1)) + (rng() % 32) * kWRAMSize;
+        }
+        const uint32 value = rng();
+        const bool write = rng() % 2;
+        INFO(fmt::format("access {} to {:07X}", i, address));
+        switch (rng() % 3) {
+        case 0:
+            if (write) {
+                fast.bus.Write<uint8>(address, value);
+                ref.bus.Write<uint8>(address, value);
+            } else {
+                REQUIRE(fast.bus.Read<uint8>(address) == ref.bus.Read<uint8>(address));
+            }
+            break;
+        case 1:
+            if (write) {
+                fast.bus.Write<uint16>(address, value);
+                ref.bus.Write<uint16>(address, value);
+            } else {
+                REQUIRE(fast.bus.Read<uint16>(address) == ref.bus.Read<uint16>(address));
+            }
+            break;
+        case 2:
+            if (write) {
+                fast.bus.Write<uint32>(address, value);
+                ref.bus.Write<uint32>(address, value);
+            } else {
+                REQUIRE(fast.bus.Read<uint32>(address) == ref.bus.Read<uint32>(address));
+            }
+            break;
+        }
+    }
+
+    // Reads through the fast path must also agree with side-effect-free reads through the page table
+    for (uint32 i = 0; i < count / 16; ++i) {
+        const uint32 address = kWRAMLowStart + (rng() % kWRAMSize & ~3u);
+        INFO(fmt::format("peek {} at {:07X}", i, address));
+        REQUIRE(fast.bus.Read<uint32>(address) == fast.bus.Peek<uint32>(address));
+    }
+
+    REQUIRE(fast.mmioWrites == ref.mmioWrites);
+    REQUIRE(std::memcmp(fast.wramLow.GetMemory(), ref.wramLow.GetMemory(), kWRAMSize) == 0);
+    REQUIRE(std::memcmp(fast.wramHigh.GetMemory(), ref.wramHigh.GetMemory(), kWRAMSize) == 0);
+    REQUIRE(std::memcmp(fast.extra.GetMemory(), ref.extra.GetMemory(), kWRAMSize) == 0);
+}
+
+} // namespace bus_fast_memory
+
+using namespace bus_fast_memory;
+
+TEST_CASE("Bus fast memory accesses match the page table", "[bus][fast_memory]") {
+    auto fast = std::make_unique<TestSubject>(true);
+    auto ref = std::make_unique<TestSubject>(false);
+    std::mt19937 rng{12345};
+
+    SECTION("Initial mapping") {
+        RunAccesses(*fast, *ref, rng, 20000);
+    }
+
+    SECTION("Unmapping and remapping pages") {
+        RunAccesses(*fast, *ref, rng, 5000);
+
+        // Unmap one mirror of High Work RAM, put MMIO over another and replace Low Work RAM with a different block
+        for (TestSubject *subject : {fast.get(), ref.get()}) {
+            subject->bus.Unmap(0x600'0000, 0x60F'FFFF);
+            subject->MapMMIO(0x700'0000, 0x70F'FFFF);
+            subject->bus.MapVirtualMemory(kWRAMLowStart, kWRAMLowEnd, subject->extra, true, sys::kHostEndianMemory);
+        }
+        RunAccesses(*fast, *ref, rng, 20000);
+
+        // Restore the original mapping; the contents written before the remap must reappear
+        for (TestSubject *subject : {fast.get(), ref.get()}) {
+            subject->bus.MapVirtualMemory(kWRAMLowStart, kWRAMLowEnd, subject->wramLow, true, sys::kHostEndianMemory);
+            subject->bus.MapVirtualMemory(kWRAMHighStart, kWRAMHighEnd, subject->wramHigh, true,
+                                          sys::kHostEndianMemory);
+        }
+        RunAccesses(*fast, *ref, rng, 20000);
+
+        // Map a read-only view; writes through either path must be dropped
+        for (TestSubject *subject : {fast.get(), ref.get()}) {
+            subject->bus.MapVirtualMemory(0x780'0000, 0x78F'FFFF, subject->extra, false, sys::kHostEndianMemory);
+        }
+        RunAccesses(*fast, *ref, rng, 20000);
+    }
+
+    SECTION("Disabling and reenabling fast memory") {
+        RunAccesses(*fast, *ref, rng, 5000);
+        REQUIRE(fast->bus.EnableFastMemory(false));
+        REQUIRE_FALSE(fast->bus.IsFastMemoryEnabled());
+        RunAccesses(*fast, *ref, rng, 5000);
+#if Ymir_FF_FAST_MEMORY
+        REQUIRE(fast->bus.EnableFastMemory(true));
+        REQUIRE(fast->bus.IsFastMemoryEnabled());
+#endif
+        RunAccesses(*fast, *ref, rng, 5000);
+    }
+}
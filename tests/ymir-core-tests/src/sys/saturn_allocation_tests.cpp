@@ -0,0 +1,134 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "test_program.hpp"
+
+#include <alloc_counter/alloc_counter.hpp>
+
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/media/binary_reader/binary_reader_mem.hpp>
+
+#include <fmt/format.h>
+
+#include <memory>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Steady-state allocation guard
+//
+// Once the emulator has warmed up, running frames must not touch the heap. This test runs the test program from
+// test_program.hpp with CD-ROM reads active, issuing CD block commands from the host every frame and periodically saving
+// and restoring the whole state, then counts the heap allocations made by the emulator thread.
+
+using namespace ymir;
+
+namespace allocation {
+
+inline constexpr uint32 kWarmupFrames = 30;
+inline constexpr uint32 kMeasuredFrames = 60;
+inline constexpr uint32 kSaveStateInterval = 10;
+
+inline constexpr uint32 kDiscFrames = 1000;
+
+inline constexpr uint32 kCDBlockRegs = 0x0589'0000;
+
+// Builds a single-track Mode 1 data disc backed by zero-filled memory
+static media::Disc BuildTestDisc() {
+    media::Disc disc{};
+    auto &session = disc.sessions.emplace_back();
+    session.numTracks = 1;
+    session.firstTrackIndex = 0;
+    session.lastTrackIndex = 0;
+    session.startFrameAddress = 0;
+    session.endFrameAddress = kDiscFrames + 150 - 1;
+
+    auto &track = session.tracks[0];
+    track.SetSectorSize(2048);
+    track.controlADR = 0x41;
+    track.startFrameAddress = 150;
+    track.endFrameAddress = session.endFrameAddress;
+    track.index01FrameAddress = track.startFrameAddress;
+    track.indices.emplace_back(); // index 00
+    auto &index = track.indices.emplace_back();
+    index.startFrameAddress = track.startFrameAddress;
+    index.endFrameAddress = track.endFrameAddress;
+    track.binaryReader = std::make_unique<media::MemoryBinaryReader>(std::vector<uint8>(kDiscFrames * 2048));
+
+    session.BuildTOC();
+    return disc;
+}
+
+// Issues a CD block command from the host, runs a frame to let it complete and returns CR4 of the response
+static uint16 RunCDBlockCommand(Saturn &saturn, uint16 cr1, uint16 cr2, uint16 cr3, uint16 cr4) {
+    saturn.mainBus.Write<uint16>(kCDBlockRegs + 0x18, cr1);
+    saturn.mainBus.Write<uint16>(kCDBlockRegs + 0x1C, cr2);
+    saturn.mainBus.Write<uint16>(kCDBlockRegs + 0x20, cr3);
+    saturn.mainBus.Write<uint16>(kCDBlockRegs + 0x24, cr4);
+    saturn.RunFrame();
+    return saturn.mainBus.Read<uint16>(kCDBlockRegs + 0x24);
+}
+
+struct Result {
+    alloc_counter::Counts counts;
+    uint32 sectorsRead = 0;
+};
+
+static Result Run(bool debugTracing) {
+    auto saturn = std::make_unique<Saturn>();
+    auto ipl = test_program::BuildIPL();
+
+    saturn->configuration.video.threadedVDP1 = false;
+    saturn->configuration.video.threadedVDP2 = false;
+    saturn->configuration.audio.threadedSCSP = false;
+    saturn->EnableDebugTracing(debugTracing);
+    saturn->LoadIPL(*ipl);
+    saturn->Reset(true);
+    saturn->LoadDisc(BuildTestDisc());
+
+    auto state = std::make_unique<savestate::SaveState>();
+
+    // Connect the drive to filter 0, which outputs to partition 0, then play the whole disc on infinite repeat.
+    // Every iteration counts and deletes the sectors buffered in partition 0 so that the buffer never fills up.
+    RunCDBlockCommand(*saturn, 0x3000, 0x0000, 0x0000, 0x0000);
+    RunCDBlockCommand(*saturn, 0x1080, 150, 0x0F80, kDiscFrames);
+
+    Result result{};
+    auto iterate = [&](uint32 i) {
+        result.sectorsRead += RunCDBlockCommand(*saturn, 0x5100, 0x0000, 0x0000, 0x0000); // GetSectorNumber
+        RunCDBlockCommand(*saturn, 0x6200, 0x0000, 0x0000, 0xFFFF);                       // DeleteSectorData
+        if (i % kSaveStateInterval == 0) {
+            saturn->SaveState(*state);
+            saturn->RunFrame();
+            [[maybe_unused]] const bool loaded = saturn->LoadState(*state);
+        }
+    };
+
+    for (uint32 i = 0; i < kWarmupFrames; ++i) {
+        iterate(i);
+    }
+
+    result.sectorsRead = 0;
+    {
+        alloc_counter::Scope scope{};
+        for (uint32 i = 0; i < kMeasuredFrames; ++i) {
+            iterate(i);
+        }
+        result.counts = scope.Get();
+    }
+
+    return result;
+}
+
+} // namespace allocation
+
+using namespace allocation;
+
+TEST_CASE("Steady-state emulation does not allocate", "[saturn][allocation]") {
+    for (bool debugTracing : {false, true}) {
+        const Result result = Run(debugTracing);
+        INFO(fmt::format("debug tracing {}: {} allocations, {} bytes; {} sectors read", debugTracing,
+                         result.counts.allocations, result.counts.bytes, result.sectorsRead));
+        CHECK(result.sectorsRead > 0);
+        CHECK(result.counts.allocations == 0);
+    }
+}
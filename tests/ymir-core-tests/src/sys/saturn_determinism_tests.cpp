@@ -0,0 +1,394 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "test_program.hpp"
+
+#include <ymir/sys/memory_layout.hpp>
+#include <ymir/sys/saturn.hpp>
+
+#include <ymir/util/data_ops.hpp>
+
+#include <fmt/format.h>
+
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Golden-output harness
+//
+// Runs the whole system for a number of frames and records per-frame digests of the video output, the audio samples and
+// main memory while running the test program from test_program.hpp. Every combination of the options that select
+// different code paths must produce the exact same output. A variant of the test program also turns the slave SH-2 on
+// and off partway through frames, which switches the frame loop implementation in the middle of a frame. Another one
+// runs a program on the MC68EC000, which is used to compare running it in batches against running it sample by sample.
+
+using namespace ymir;
+
+namespace determinism {
+
+inline constexpr uint32 kFrameCount = 12;
+
+struct FrameDigest {
+    uint64 video = 0;
+    uint64 audio = 0;
+    uint64 memory = 0;
+
+    bool operator==(const FrameDigest &) const = default;
+};
+
+struct RunOptions {
+    bool debugTracing = false;
+    bool emulateSH2Cache = false;
+    bool threadedVDP1 = false;
+    bool threadedVDP2 = false;
+    bool threadedSCSP = false;
+    bool m68kBatching = false;
+    uint32 scspStepGranularity = 0;
+
+    // Run the system one master SH-2 instruction at a time instead of whole frames
+    bool stepping = false;
+
+    test_program::Options program{};
+};
+
+// Emulator state sampled at the end of each frame
+struct FrameState {
+    uint32 renderedFrames = 0;
+    bool slaveSH2Enabled = false;
+    uint32 masterCounter = 0;
+    uint32 slaveCounter = 0;
+    uint16 soundCounter = 0;
+};
+
+// FNV-1a
+static void Hash(uint64 &hash, const void *data, size_t size) {
+    const auto *bytes = static_cast<const uint8 *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+}
+
+static constexpr uint64 kHashSeed = 0xCBF29CE484222325ull;
+
+static std::vector<FrameDigest> Run(const RunOptions &options, std::vector<FrameState> *states = nullptr,
+                                    uint32 frameCount = kFrameCount) {
+    auto saturn = std::make_unique<Saturn>();
+    auto ipl = test_program::BuildIPL(options.program);
+
+    saturn->configuration.video.threadedVDP1 = options.threadedVDP1;
+    saturn->configuration.video.threadedVDP2 = options.threadedVDP2;
+    saturn->configuration.audio.threadedSCSP = options.threadedSCSP;
+    saturn->configuration.audio.m68kBatching = options.m68kBatching;
+    saturn->SCSP.SetStepGranularity(options.scspStepGranularity);
+    saturn->EnableDebugTracing(options.debugTracing);
+    saturn->EnableSH2CacheEmulation(options.emulateSH2Cache);
+    saturn->LoadIPL(*ipl);
+    saturn->Reset(true);
+
+    struct Context {
+        uint64 video = kHashSeed;
+        uint64 audio = kHashSeed;
+        uint32 renderedFrames = 0;
+    } ctx;
+
+    saturn->VDP.SetSoftwareRenderCallback({&ctx, [](uint32 *fb, uint32 width, uint32 height, void *ctx) {
+                                               auto &c = *static_cast<Context *>(ctx);
+                                               ++c.renderedFrames;
+                                               c.video = kHashSeed;
+                                               Hash(c.video, &width, sizeof(width));
+                                               Hash(c.video, &height, sizeof(height));
+                                               Hash(c.video, fb, width * height * sizeof(uint32));
+                                           }});
+    saturn->SCSP.SetSampleCallback({&ctx, [](sint16 left, sint16 right, void *ctx) {
+                                        auto &c = *static_cast<Context *>(ctx);
+                                        Hash(c.audio, &left, sizeof(left));
+                                        Hash(c.audio, &right, sizeof(right));
+                                    }});
+
+    // Memory is hashed in guest byte order so that the digests don't depend on the storage layout
+    std::vector<uint8> wramLow(sys::kWRAMLowSize);
+    std::vector<uint8> wramHigh(sys::kWRAMHighSize);
+
+    std::vector<FrameDigest> digests;
+    for (uint32 i = 0; i < frameCount; ++i) {
+        ctx.video = kHashSeed;
+        ctx.audio = kHashSeed;
+        ctx.renderedFrames = 0;
+        if (options.stepping) {
+            // Frames end when the VDP enters the vertical blanking area, like in RunFrame()
+            while (saturn->VDP.GetVerticalPhase() == vdp::VerticalPhase::BlankingAndSync) {
+                saturn->StepMasterSH2();
+            }
+            while (saturn->VDP.GetVerticalPhase() != vdp::VerticalPhase::BlankingAndSync) {
+                saturn->StepMasterSH2();
+            }
+        } else {
+            saturn->RunFrame();
+        }
+
+        FrameDigest &digest = digests.emplace_back();
+        digest.video = ctx.video;
+        digest.audio = ctx.audio;
+        digest.memory = kHashSeed;
+        sys::CopyToGuestOrder(wramLow, saturn->mem.WRAMLow());
+        sys::CopyToGuestOrder(wramHigh, saturn->mem.WRAMHigh());
+        Hash(digest.memory, wramLow.data(), wramLow.size());
+        Hash(digest.memory, wramHigh.data(), wramHigh.size());
+
+        if (states != nullptr) {
+            FrameState &state = states->emplace_back();
+            state.renderedFrames = ctx.renderedFrames;
+            state.slaveSH2Enabled = saturn->IsSlaveSH2Enabled();
+            state.masterCounter = util::ReadBE<uint32>(&wramHigh[test_program::kMasterCounterAddress & 0xFFFFF]);
+            state.slaveCounter = util::ReadBE<uint32>(&wramHigh[test_program::kSlaveCounterAddress & 0xFFFFF]);
+            state.soundCounter = saturn->mainBus.Peek<uint16>(0x5A0'0000 | test_program::kSoundCounterAddress);
+        }
+    }
+
+    // Stop the render and SCSP threads before the callback context goes out of scope
+    saturn.reset();
+
+    return digests;
+}
+
+// Digests of the default configuration.
+// If emulation behavior changes on purpose, replace these with the actual digests printed by the failing test.
+static constexpr std::array<FrameDigest, kFrameCount> kReferenceDigests = {{
+    // clang-format off
+    {0x3251A7A3E3991D0A, 0xCA9F2DE4B95F5ADD, 0xBF90EA3CE412ADDE},
+    {0xAE4045EE28DB9D0A, 0x7790849BADCF9865, 0x2F5D87E310F970DA},
+    {0x903CA3122959D402, 0x1789BF0D9980C7C5, 0x38C8877F661627A2},
+    {0x460FAA9B91549D0A, 0x5285E3C88A5B7F25, 0x6B2272171CA8F59F},
+    {0x5E105F30ABBB9D0A, 0x37F63529F3321785, 0x13389670B4FC528C},
+    {0xB0AF6314D29B400A, 0xDCF3B35740B808AD, 0xB0E8825D07EA85E1},
+    {0x4712B85A5761584A, 0x3BE89FA38A1C67C5, 0xB3CADDD77219A119},
+    {0xFC4ADD180CC95D0A, 0x075047DED59E3BDD, 0x52EF315E716402F3},
+    {0xE241BCA698409D0A, 0x007C641E1D0C6C25, 0x7F83487943D9CA1F},
+    {0x4581B78954EF9832, 0xA74DC80E9D1CF2E5, 0xA3410805A3BBE0E0},
+    {0xE93B1EAADBE86A4A, 0xE308B149A20B5FA5, 0x8C1F2810BBD730FC},
+    {0x1E4EADED87ABDD0A, 0x33D2D1C9D95AA065, 0x83BE8558D3B8B3F8},
+    // clang-format on
+}};
+
+// Digests of the sound CPU program with the MC68EC000 running sample by sample and in batches
+static constexpr std::array<FrameDigest, kFrameCount> kSoundCPUReferenceDigests = {{
+    // clang-format off
+    {0x3251A7A3E3991D0A, 0xB5450CABF5A0EA29, 0x72E80CE255BA89D5},
+    {0x6FADEC7274DB9D0A, 0xCA68EFDACD15AE2D, 0x7D6DBFB40FE02C89},
+    {0xAB12B5DDBDC8C52A, 0x7C5A89E2B48EFD55, 0xF454594D793657AE},
+    {0xBFCB5DCA3291DD0A, 0x2C3E92D6476E3639, 0x0F7790E1BBEEC112},
+    {0xE7BCF229B1D1DD0A, 0x56A0978909BD4C75, 0x223A9A4B875E6310},
+    {0xF5DAA9894136A59A, 0x1DDBA9541AE22A9D, 0xEBC0A6EFE2C36A1A},
+    {0xBABF56CA4D555D0A, 0x8BB9429963F1A615, 0x124473F9B3F104F2},
+    {0x476225997D9ADD0A, 0x4A38E64D18265BE1, 0x43ED2D839F01F26F},
+    {0xF7FDA50F5A331F6A, 0x53918CEC9833AC71, 0x2109B25702026646},
+    {0xCFA0CFC7EBF259EA, 0xADAE2D61609679ED, 0x4CFC210C035CD11C},
+    {0x58C694FDD57B00AA, 0x98C89B737F28CD6D, 0x5147037DE0FE4CC3},
+    {0x06A74B9AA971D18A, 0xE4984701AB06116D, 0xBFFE04621F202FD7},
+    // clang-format on
+}};
+
+static constexpr std::array<FrameDigest, kFrameCount> kSoundCPUBatchedReferenceDigests = {{
+    // clang-format off
+    {0x3251A7A3E3991D0A, 0x051556A99E04ABF9, 0x72E80CE255BA89D5},
+    {0x6FADEC7274DB9D0A, 0xAF57E1E75A96F0A1, 0x7D6DBFB40FE02C89},
+    {0xAB12B5DDBDC8C52A, 0x636E2FEEC4609E0D, 0xF454594D793657AE},
+    {0xBFCB5DCA3291DD0A, 0x4A486875638FC24D, 0x0F7790E1BBEEC112},
+    {0xE7BCF229B1D1DD0A, 0xF1F72E16658FB0F1, 0x223A9A4B875E6310},
+    {0xF5DAA9894136A59A, 0xA65CA83F694FBABD, 0xEBC0A6EFE2C36A1A},
+    {0xBABF56CA4D555D0A, 0xCBA6819A02BB9641, 0x124473F9B3F104F2},
+    {0x476225997D9ADD0A, 0xB4C0E2CD21C3EA91, 0x43ED2D839F01F26F},
+    {0xF7FDA50F5A331F6A, 0x3714A54C1D216B61, 0x2109B25702026646},
+    {0xCFA0CFC7EBF259EA, 0x7AB7F5A0F2B31D25, 0x4CFC210C035CD11C},
+    {0x58C694FDD57B00AA, 0x764E71CBE8A40C09, 0x5147037DE0FE4CC3},
+    {0x06A74B9AA971D18A, 0xF043D0910290D01D, 0xBFFE04621F202FD7},
+    // clang-format on
+}};
+
+// Turns the slave SH-2 on during frame 2 and off during frame 6
+static constexpr test_program::Options kSlaveSH2Toggle{
+    .slaveSH2OnCount = 0x10000,
+    .slaveSH2OffCount = 0x30000,
+};
+
+// Runs the MC68EC000 alongside the SH-2s
+static constexpr test_program::Options kSoundCPU{
+    .soundCPU = true,
+};
+
+static std::string ToString(const std::vector<FrameDigest> &digests) {
+    std::string out;
+    for (size_t i = 0; i < digests.size(); ++i) {
+        out += fmt::format("frame {:2d}: video {:016X} audio {:016X} memory {:016X}\n", i, digests[i].video,
+                           digests[i].audio, digests[i].memory);
+    }
+    return out;
+}
+
+} // namespace determinism
+
+using namespace determinism;
+
+TEST_CASE("Test program exercises video, audio and memory", "[saturn][determinism]") {
+    const auto digests = Run({});
+    REQUIRE(digests.size() == kFrameCount);
+    INFO(ToString(digests));
+
+    // Every output must change over time, otherwise the harness would not detect any divergence
+    auto allSame = [&](auto member) {
+        for (const auto &digest : digests) {
+            if (digest.*member != digests.back().*member) {
+                return false;
+            }
+        }
+        return true;
+    };
+    CHECK_FALSE(allSame(&FrameDigest::video));
+    CHECK_FALSE(allSame(&FrameDigest::audio));
+    CHECK_FALSE(allSame(&FrameDigest::memory));
+}
+
+TEST_CASE("Sound CPU program runs the MC68EC000", "[saturn][determinism]") {
+    for (bool m68kBatching : {false, true}) {
+        RunOptions options{};
+        options.m68kBatching = m68kBatching;
+        options.program = kSoundCPU;
+
+        std::vector<FrameState> frames{};
+        Run(options, &frames);
+        REQUIRE(frames.size() == kFrameCount);
+        for (size_t i = 1; i < kFrameCount; ++i) {
+            INFO(fmt::format("M68K batching {}, frame {}: sound counter {:X} / {:X}", m68kBatching, i,
+                             frames[i - 1].soundCounter, frames[i].soundCounter));
+            CHECK(frames[i].soundCounter != frames[i - 1].soundCounter);
+        }
+
+        // Without a program on the MC68EC000 there is nothing to batch
+        options.program = {};
+        INFO(fmt::format("M68K batching {}", m68kBatching));
+        CHECK(Run(options) == Run({}));
+    }
+}
+
+TEST_CASE("Output matches the stored reference", "[saturn][determinism]") {
+    auto check = [](const RunOptions &options, const std::array<FrameDigest, kFrameCount> &reference) {
+        const auto digests = Run(options);
+        INFO(fmt::format("sound CPU {}, M68K batching {}", options.program.soundCPU, options.m68kBatching));
+        INFO("Actual:\n" << ToString(digests));
+        REQUIRE(digests.size() == reference.size());
+        for (size_t i = 0; i < digests.size(); ++i) {
+            INFO("Frame " << i);
+            CHECK(digests[i] == reference[i]);
+        }
+    };
+
+    check({}, kReferenceDigests);
+    check({.m68kBatching = false, .program = kSoundCPU}, kSoundCPUReferenceDigests);
+    check({.m68kBatching = true, .program = kSoundCPU}, kSoundCPUBatchedReferenceDigests);
+}
+
+TEST_CASE("Output is identical across code paths", "[saturn][determinism]") {
+    // SH-2 cache emulation, MC68EC000 batching and the SCSP step granularity change the timing of the emulated system,
+    // so each combination gets its own baseline. Debug tracing and the threaded renderers and SCSP must not change the
+    // output.
+    auto check = [](const RunOptions &baseOptions, bool allVariants) {
+        const auto reference = Run(baseOptions);
+        for (uint32 i = 1; i < 8; ++i) {
+            RunOptions options = baseOptions;
+            options.debugTracing = i & 1;
+            options.threadedVDP1 = i & 2;
+            options.threadedVDP2 = i & 2;
+            options.threadedSCSP = i & 4;
+            if (!allVariants && (options.threadedVDP1 || options.threadedSCSP)) {
+                continue;
+            }
+
+            INFO(fmt::format("debug tracing {}, SH-2 cache {}, threaded VDP1 {}, threaded VDP2 {}, threaded SCSP {}, "
+                             "M68K batching {}, SCSP step granularity {}",
+                             options.debugTracing, options.emulateSH2Cache, options.threadedVDP1,
+                             options.threadedVDP2, options.threadedSCSP, options.m68kBatching,
+                             options.scspStepGranularity));
+            const auto digests = Run(options);
+            INFO("Reference:\n" << ToString(reference) << "Actual:\n" << ToString(digests));
+            CHECK(digests == reference);
+        }
+    };
+
+    for (bool emulateSH2Cache : {false, true}) {
+        RunOptions options{};
+        options.emulateSH2Cache = emulateSH2Cache;
+        check(options, true);
+
+        options.program = kSlaveSH2Toggle;
+        check(options, true);
+
+        options.program = kSoundCPU;
+        for (bool m68kBatching : {false, true}) {
+            options.m68kBatching = m68kBatching;
+            check(options, true);
+        }
+    }
+
+    // The renderers are unaffected by the SCSP step granularity, and the threaded SCSP always steps whole samples
+    for (uint32 granularity = 1; granularity <= 5; ++granularity) {
+        RunOptions options{};
+        options.scspStepGranularity = granularity;
+        check(options, false);
+    }
+}
+
+TEST_CASE("Turning the slave SH-2 on and off mid-frame matches stepping one instruction at a time",
+          "[saturn][determinism]") {
+    // Whole frames run in time slices and only bring the scheduler up to date at the end of each slice, so the SMPC
+    // commands complete up to one slice earlier relative to the CPUs than when stepping. Slices never exceed one SCSP
+    // sample (about 650 cycles), and each slave SH-2 loop iteration takes several cycles and adds 3 to the counter.
+    // Allow the slave SH-2 counter to drift by up to one slice at each of the two switches.
+    static constexpr uint32 kMaxSlaveCounterDrift = 2 * 650 / 4 * 3;
+
+    for (bool emulateSH2Cache : {false, true}) {
+        RunOptions options{};
+        options.emulateSH2Cache = emulateSH2Cache;
+        options.program = kSlaveSH2Toggle;
+
+        std::vector<FrameState> frames{};
+        const auto digests = Run(options, &frames);
+
+        std::vector<FrameState> refFrames{};
+        options.stepping = true;
+        const auto refDigests = Run(options, &refFrames);
+
+        REQUIRE(frames.size() == kFrameCount);
+        REQUIRE(refFrames.size() == kFrameCount);
+        for (size_t i = 0; i < kFrameCount; ++i) {
+            INFO(fmt::format("SH-2 cache {}, frame {}: master {:X} / {:X}, slave {:X} / {:X}", emulateSH2Cache, i,
+                             frames[i].masterCounter, refFrames[i].masterCounter, frames[i].slaveCounter,
+                             refFrames[i].slaveCounter));
+
+            // Each call to RunFrame() must produce exactly one frame, even if the slave SH-2 was switched during it
+            CHECK(frames[i].renderedFrames == 1);
+            CHECK(refFrames[i].renderedFrames == 1);
+
+            // The slave SH-2 is turned on during frame 2 and off during frame 6
+            CHECK(refFrames[i].slaveSH2Enabled == (i >= 2 && i < 6));
+            CHECK(frames[i].slaveSH2Enabled == refFrames[i].slaveSH2Enabled);
+
+            // The master SH-2 and the SCSP are unaffected by the slave SH-2 and must match exactly.
+            // Video is not compared because the VDP renders in slices too, which changes when register writes land.
+            CHECK(frames[i].masterCounter == refFrames[i].masterCounter);
+            CHECK(digests[i].audio == refDigests[i].audio);
+
+            // The slave SH-2 runs only while enabled
+            const bool prevEnabled = i > 0 && refFrames[i - 1].slaveSH2Enabled;
+            if (!prevEnabled && !refFrames[i].slaveSH2Enabled) {
+                CHECK(frames[i].slaveCounter == (i == 0 ? 0 : frames[i - 1].slaveCounter));
+                CHECK(refFrames[i].slaveCounter == (i == 0 ? 0 : refFrames[i - 1].slaveCounter));
+            }
+            const uint32 drift = frames[i].slaveCounter > refFrames[i].slaveCounter
+                                     ? frames[i].slaveCounter - refFrames[i].slaveCounter
+                                     : refFrames[i].slaveCounter - frames[i].slaveCounter;
+            CHECK(drift <= kMaxSlaveCounterDrift);
+        }
+        CHECK(frames.back().slaveCounter > 0);
+    }
+}
@@ -0,0 +1,236 @@
+#include "test_program.hpp"
+
+#include <ymir/util/data_ops.hpp>
+
+#include <utility>
+#include <vector>
+
+using namespace ymir;
+
+namespace test_program {
+
+std::unique_ptr<std::array<uint8, sys::kIPLSize>> BuildIPL(const Options &options) {
+    auto ipl = std::make_unique<std::array<uint8, sys::kIPLSize>>();
+    ipl->fill(0);
+
+    auto write16 = [&](uint32 address, uint16 value) { util::WriteBE<uint16>(&(*ipl)[address], value); };
+    auto write32 = [&](uint32 address, uint32 value) { util::WriteBE<uint32>(&(*ipl)[address], value); };
+
+    static constexpr uint32 kCodeAddress = 0x100;
+    static constexpr uint32 kTableAddress = 0x200;
+
+    static constexpr uint32 kCacheThrough = 0x2000'0000;
+
+    static constexpr uint32 kVDP1VRAM = 0x25C0'0000;
+    static constexpr uint32 kPolygonCmd = kVDP1VRAM + 0x40;
+
+    // Reset vectors: PC and SP
+    write32(0x0, kCodeAddress);
+    write32(0x4, 0x0600'4000);
+
+    // Register and memory writes performed on startup, as 16-bit values
+    std::vector<std::pair<uint32, uint16>> writes;
+    auto add = [&](uint32 address, uint16 value) { writes.emplace_back(address, value); };
+
+    // VDP1 command table: system clipping, local coordinates, polygon, end
+    add(kVDP1VRAM + 0x00, 0x0009);
+    add(kVDP1VRAM + 0x14, 319);
+    add(kVDP1VRAM + 0x16, 223);
+    add(kVDP1VRAM + 0x20, 0x000A);
+    add(kVDP1VRAM + 0x2C, 0);
+    add(kVDP1VRAM + 0x2E, 0);
+    add(kPolygonCmd + 0x00, 0x0004);
+    add(kPolygonCmd + 0x04, 0x0000);
+    add(kPolygonCmd + 0x06, 0xFC1F);
+    add(kPolygonCmd + 0x0C, 40);
+    add(kPolygonCmd + 0x0E, 30);
+    add(kPolygonCmd + 0x10, 200);
+    add(kPolygonCmd + 0x12, 50);
+    add(kPolygonCmd + 0x14, 250);
+    add(kPolygonCmd + 0x16, 180);
+    add(kPolygonCmd + 0x18, 20);
+    add(kPolygonCmd + 0x1A, 150);
+    add(kPolygonCmd + 0x20, 0x8000);
+
+    // VDP1 registers: erase and draw automatically on every frame change
+    add(0x25D0'0000, 0x0000); // TVMR
+    add(0x25D0'0002, 0x0000); // FBCR
+    add(0x25D0'0006, 0x0000); // EWDR
+    add(0x25D0'0008, 0x0000); // EWLR
+    add(0x25D0'000A, 0x50E0); // EWRR
+    add(0x25D0'0004, 0x0002); // PTMR
+
+    // VDP2 registers: sprite layer over single-color back screen
+    add(0x25F8'00E0, 0x0020); // SPCTL
+    add(0x25F8'00F0, 0x0007); // PRISA
+    add(0x25F8'00AC, 0x0000); // BKTAU
+    add(0x25F8'00AE, 0x0000); // BKTAL
+    add(0x25F8'0000, 0x8000); // TVMD
+
+    // The MC68EC000 vectors are at the start of sound RAM, so the wave is moved out of the way when it's used
+    static constexpr uint32 kSoundRAM = 0x25A0'0000;
+    static constexpr uint32 kM68KCodeAddress = 0x1000;
+    static constexpr uint32 kM68KWaveAddress = 0x800;
+    const uint32 waveAddress = options.soundCPU ? kM68KWaveAddress : 0x000;
+
+    // Sound RAM: sawtooth wave
+    for (uint32 i = 0; i < 32; ++i) {
+        add(kSoundRAM + waveAddress + i * 2, static_cast<uint16>(i * 0x800 - 0x8000));
+    }
+
+    // SCSP slot 0: loop the wave at full volume, direct output
+    add(0x25B0'0002, waveAddress); // SA
+    add(0x25B0'0004, 0x0000);      // LSA
+    add(0x25B0'0006, 32);          // LEA
+    add(0x25B0'0008, 0x001F);      // AR
+    add(0x25B0'000A, 0x001F);      // RR
+    add(0x25B0'000C, 0x0000);      // TL
+    add(0x25B0'0010, 0x0000);      // OCT, FNS
+    add(0x25B0'0016, 0xE000);      // DISDL
+    add(0x25B0'0400, 0x000F);      // MVOL
+    add(0x25B0'0000, 0x1820);      // KYONEX, KYONB, LPCTL
+
+    if (options.soundCPU) {
+        // Reset vectors: SSP and PC
+        add(kSoundRAM + 0x0, 0x0008);
+        add(kSoundRAM + 0x2, 0x0000);
+        add(kSoundRAM + 0x4, 0x0000);
+        add(kSoundRAM + 0x6, kM68KCodeAddress);
+
+        // clang-format off
+        static constexpr uint16 kM68KCode[] = {
+            0x7000,                           // 1000  moveq   #0, d0
+            0x41F8, kSoundCounterAddress,     // 1002  lea     ($2000).w, a0   ; counter
+            0x43F8, kM68KWaveAddress + 0x20,  // 1006  lea     ($0820).w, a1   ; wave sample 16
+                                              //    loop:
+            0x5240,                           // 100A  addq.w  #1, d0
+            0x3080,                           // 100C  move.w  d0, (a0)
+            0x3280,                           // 100E  move.w  d0, (a1)
+            0x60F8,                           // 1010  bra.s   loop
+        };
+        // clang-format on
+        for (size_t i = 0; i < std::size(kM68KCode); ++i) {
+            add(kSoundRAM + kM68KCodeAddress + i * 2, kM68KCode[i]);
+        }
+
+        add(0x2010'001E, 0x0006); // SMPC COMREG = SNDON
+    }
+
+    for (size_t i = 0; i < writes.size(); ++i) {
+        write32(kTableAddress + i * 8 + 0, writes[i].first);
+        write32(kTableAddress + i * 8 + 4, writes[i].second);
+    }
+    const uint32 tableEnd = kTableAddress + writes.size() * 8;
+
+    if (options.slaveSH2OnCount == 0) {
+        // clang-format off
+        static constexpr uint16 kCode[] = {
+            0xD108, // 100  mov.l   @(0x124), r1        ; write table start
+            0xD209, // 102  mov.l   @(0x128), r2        ; write table end
+            0xD609, // 104  mov.l   @(0x12C), r6        ; back screen color
+            0xD70A, // 106  mov.l   @(0x130), r7        ; Work RAM
+            0xD80A, // 108  mov.l   @(0x134), r8        ; polygon vertex A X
+            0xE500, // 10A  mov     #0, r5
+                    //    init:
+            0x6316, // 10C  mov.l   @r1+, r3
+            0x6416, // 10E  mov.l   @r1+, r4
+            0x2341, // 110  mov.w   r4, @r3
+            0x3122, // 112  cmp/hs  r2, r1
+            0x8BFA, // 114  bf      init
+                    //    loop:
+            0x7501, // 116  add     #1, r5
+            0x2651, // 118  mov.w   r5, @r6
+            0x2752, // 11A  mov.l   r5, @r7
+            0x2851, // 11C  mov.w   r5, @r8
+            0xAFFA, // 11E  bra     loop
+            0x0009, // 120  nop
+        };
+        // clang-format on
+        for (size_t i = 0; i < std::size(kCode); ++i) {
+            write16(kCodeAddress + i * 2, kCode[i]);
+        }
+        write32(0x124, kTableAddress);
+        write32(0x128, tableEnd);
+        write32(0x12C, 0x25E0'0000);
+        write32(0x130, kCacheThrough | kMasterCounterAddress);
+        write32(0x134, kPolygonCmd + 0x0C);
+        return ipl;
+    }
+
+    // Both SH-2s start from the reset vector. The master SH-2 raises a flag in Work RAM once it's done initializing,
+    // which sends the slave SH-2 to its own loop.
+    // clang-format off
+    static constexpr uint16 kCode[] = {
+        0xDC16, // 100  mov.l   @(0x15C), r12       ; master running flag
+        0x60C2, // 102  mov.l   @r12, r0
+        0x8800, // 104  cmp/eq  #0, r0
+        0x8B20, // 106  bf      slave
+        0xD115, // 108  mov.l   @(0x160), r1        ; write table start
+        0xD216, // 10A  mov.l   @(0x164), r2        ; write table end
+        0xD616, // 10C  mov.l   @(0x168), r6        ; back screen color
+        0xD717, // 10E  mov.l   @(0x16C), r7        ; Work RAM
+        0xD817, // 110  mov.l   @(0x170), r8        ; polygon vertex A X
+        0xE500, // 112  mov     #0, r5
+                //    init:
+        0x6316, // 114  mov.l   @r1+, r3
+        0x6416, // 116  mov.l   @r1+, r4
+        0x2341, // 118  mov.w   r4, @r3
+        0x3122, // 11A  cmp/hs  r2, r1
+        0x8BFA, // 11C  bf      init
+        0xD915, // 11E  mov.l   @(0x174), r9        ; SMPC COMREG
+        0xDA15, // 120  mov.l   @(0x178), r10       ; SSHON count
+        0xDB16, // 122  mov.l   @(0x17C), r11       ; SSHOFF count
+        0xE001, // 124  mov     #1, r0
+        0x2C02, // 126  mov.l   r0, @r12
+                //    loop:
+        0x7501, // 128  add     #1, r5
+        0x2651, // 12A  mov.w   r5, @r6
+        0x2752, // 12C  mov.l   r5, @r7
+        0x2851, // 12E  mov.w   r5, @r8
+        0x35A0, // 130  cmp/eq  r10, r5
+        0x8903, // 132  bt      sshon
+        0x35B0, // 134  cmp/eq  r11, r5
+        0x8904, // 136  bt      sshoff
+        0xAFF6, // 138  bra     loop
+        0x0009, // 13A  nop
+                //    sshon:
+        0xE002, // 13C  mov     #2, r0              ; SSHON
+        0xA001, // 13E  bra     command
+        0x0009, // 140  nop
+                //    sshoff:
+        0xE003, // 142  mov     #3, r0              ; SSHOFF
+                //    command:
+        0x2900, // 144  mov.b   r0, @r9
+        0xAFEF, // 146  bra     loop
+        0x0009, // 148  nop
+                //    slave:
+        0xD70D, // 14A  mov.l   @(0x180), r7        ; Work RAM
+        0xD80D, // 14C  mov.l   @(0x184), r8        ; polygon vertex C X
+        0xE500, // 14E  mov     #0, r5
+                //    slaveLoop:
+        0x7503, // 150  add     #3, r5
+        0x2752, // 152  mov.l   r5, @r7
+        0x2851, // 154  mov.w   r5, @r8
+        0xAFFB, // 156  bra     slaveLoop
+        0x0009, // 158  nop
+    };
+    // clang-format on
+    for (size_t i = 0; i < std::size(kCode); ++i) {
+        write16(kCodeAddress + i * 2, kCode[i]);
+    }
+    write32(0x15C, kCacheThrough | 0x0600'0020);
+    write32(0x160, kTableAddress);
+    write32(0x164, tableEnd);
+    write32(0x168, 0x25E0'0000);
+    write32(0x16C, kCacheThrough | kMasterCounterAddress);
+    write32(0x170, kPolygonCmd + 0x0C);
+    write32(0x174, 0x2010'001F);
+    write32(0x178, options.slaveSH2OnCount);
+    write32(0x17C, options.slaveSH2OffCount);
+    write32(0x180, kCacheThrough | kSlaveCounterAddress);
+    write32(0x184, kPolygonCmd + 0x14);
+
+    return ipl;
+}
+
+} // namespace test_program
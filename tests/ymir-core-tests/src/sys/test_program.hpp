@@ -0,0 +1,43 @@
+#pragma once
+
+#include <ymir/sys/memory_defs.hpp>
+
+#include <ymir/core/types.hpp>
+
+#include <array>
+#include <memory>
+
+// Self-contained Saturn test program shared by the whole-system tests.
+//
+// The program is generated here so that the tests run without any external images. It sets up VDP1 to draw a polygon
+// every frame, VDP2 to display the sprite layer over the back screen, and SCSP slot 0 to loop a sawtooth wave from sound
+// RAM, then spins in a loop that continuously writes a counter to the polygon's position, the back screen color and
+// Work RAM. The output of each frame therefore depends on exact CPU timing as well as on the renderers and the SCSP.
+namespace test_program {
+
+struct Options {
+    // If nonzero, the master SH-2 turns the slave SH-2 on with the SMPC SSHON command once its loop counter reaches
+    // this value, and back off with SSHOFF when it reaches slaveSH2OffCount. The slave SH-2 runs a loop of its own that
+    // writes another counter to Work RAM and to one of the polygon's vertices.
+    uint32 slaveSH2OnCount = 0;
+    uint32 slaveSH2OffCount = 0;
+
+    // If true, the startup code loads a program into sound RAM and turns the MC68EC000 on with the SMPC SNDON command.
+    // The MC68EC000 loops incrementing a counter that it writes to sound RAM and to one of the samples of the wave
+    // played by SCSP slot 0, so the audio output also depends on its timing.
+    bool soundCPU = false;
+};
+
+// Work RAM address of the master SH-2 loop counter
+inline constexpr uint32 kMasterCounterAddress = 0x0600'0000;
+
+// Work RAM address of the slave SH-2 loop counter
+inline constexpr uint32 kSlaveCounterAddress = 0x0600'0010;
+
+// Sound RAM address of the MC68EC000 loop counter
+inline constexpr uint32 kSoundCounterAddress = 0x2000;
+
+// Builds an IPL image that runs the test program on the master SH-2 after a reset.
+std::unique_ptr<std::array<uint8, ymir::sys::kIPLSize>> BuildIPL(const Options &options = {});
+
+} // namespace test_program
@@ -2,9 +2,16 @@
 
 #include <protocol/json_rpc_adapter.hpp>
 #include <protocol/line_framer.hpp>
+#include <protocol/stream_framer.hpp>
 
+#include <ymir/debug/protocol/memory_subscription.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -119,3 +126,127 @@ TEST_CASE("ymir-dbg JsonRpcAdapter handles malformed and unsupported input", "[p
     REQUIRE(arrayParams.has_value());
     CHECK(arrayParams->params.is_array());
 }
+
+TEST_CASE("ymir-dbg StreamFramer splits lines and binary frames", "[protocol]") {
+    std::vector<std::string> lines;
+    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> blobs;
+    ymir::debug::StreamFramer framer(
+        [&](std::string_view line) { lines.emplace_back(line); },
+        [&](uint32_t blobId, std::span<const uint8_t> payload) {
+            blobs.emplace_back(blobId, std::vector<uint8_t>(payload.begin(), payload.end()));
+        },
+        [](ymir::debug::StreamFramerError) { FAIL("Unexpected error"); });
+
+    // Payloads may contain line terminators and NUL bytes
+    const std::vector<uint8_t> payload{0x00, 0x0A, 0x7B, 0xFF, 0x0D};
+    std::string stream = R"({"jsonrpc":"2.0","id":1,"result":{"blob_id":7}})"
+                         "\n";
+    ymir::debug::AppendBinaryFrame(stream, 7, payload);
+    ymir::debug::AppendBinaryFrame(stream, 8, {});
+    stream += R"({"jsonrpc":"2.0","id":2,"result":{}})"
+              "\n";
+
+    // Feed one byte at a time to exercise frames split across reads
+    for (char c : stream) {
+        framer.Push(&c, 1);
+    }
+
+    REQUIRE(lines.size() == 2);
+    CHECK(lines[0] == R"({"jsonrpc":"2.0","id":1,"result":{"blob_id":7}})");
+    CHECK(lines[1] == R"({"jsonrpc":"2.0","id":2,"result":{}})");
+    REQUIRE(blobs.size() == 2);
+    CHECK(blobs[0].first == 7);
+    CHECK(blobs[0].second == payload);
+    CHECK(blobs[1].first == 8);
+    CHECK(blobs[1].second.empty());
+}
+
+TEST_CASE("ymir-dbg StreamFramer skips oversized payloads", "[protocol]") {
+    bool sawError{};
+    bool sawBinary{};
+    std::vector<std::string> lines;
+    ymir::debug::StreamFramer framer([&](std::string_view line) { lines.emplace_back(line); },
+                                     [&](uint32_t, std::span<const uint8_t>) { sawBinary = true; },
+                                     [&](ymir::debug::StreamFramerError err) {
+                                         sawError = true;
+                                         CHECK(err == ymir::debug::StreamFramerError::PayloadTooLarge);
+                                     });
+
+    const uint32_t length = ymir::debug::StreamFramer::kMaxPayloadLength + 1;
+    std::string header;
+    header += ymir::debug::kBinaryFrameMarker;
+    header.append({'\x01', '\x00', '\x00', '\x00'});
+    for (uint32_t i = 0; i < 4; ++i) {
+        header += static_cast<char>((length >> (i * 8u)) & 0xFF);
+    }
+    framer.Push(header.data(), header.size());
+    CHECK(sawError);
+
+    // Feed the payload in small chunks; line terminators inside it must not produce lines
+    const std::string chunk(64 * 1024, '\n');
+    for (uint32_t remaining = length; remaining > 0;) {
+        const uint32_t count = std::min(remaining, static_cast<uint32_t>(chunk.size()));
+        framer.Push(chunk.data(), count);
+        remaining -= count;
+    }
+
+    const std::string line = R"({"jsonrpc":"2.0","method":"debug.version","id":1})"
+                             "\n";
+    framer.Push(line.data(), line.size());
+    CHECK_FALSE(sawBinary);
+    REQUIRE(lines.size() == 1);
+    CHECK(lines[0] == R"({"jsonrpc":"2.0","method":"debug.version","id":1})");
+}
+
+TEST_CASE("ymir-dbg StreamFramer rejects frame markers inside lines", "[protocol]") {
+    std::vector<ymir::debug::StreamFramerError> errors;
+    std::vector<std::string> lines;
+    bool sawBinary{};
+    ymir::debug::StreamFramer framer([&](std::string_view line) { lines.emplace_back(line); },
+                                     [&](uint32_t, std::span<const uint8_t>) { sawBinary = true; },
+                                     [&](ymir::debug::StreamFramerError err) { errors.push_back(err); });
+
+    // The marker and everything after it up to the line terminator are dropped along with the partial line
+    std::string stream = R"({"jsonrpc":"2.0",)";
+    stream += ymir::debug::kBinaryFrameMarker;
+    stream += R"("id":1})"
+              "\n";
+    stream += R"({"jsonrpc":"2.0","method":"debug.version","id":1})"
+              "\n";
+    framer.Push(stream.data(), stream.size());
+
+    CHECK_FALSE(sawBinary);
+    REQUIRE(errors.size() == 1);
+    CHECK(errors[0] == ymir::debug::StreamFramerError::MarkerInsideLine);
+    REQUIRE(lines.size() == 1);
+    CHECK(lines[0] == R"({"jsonrpc":"2.0","method":"debug.version","id":1})");
+}
+
+TEST_CASE("ymir-dbg MemorySubscription reports changed pages", "[protocol]") {
+    ymir::debug::MemSubscribeParams params;
+    params.size = 10;
+    params.page_size = 4;
+    ymir::debug::MemorySubscription sub{params};
+    CHECK(sub.PageCount() == 3);
+
+    std::vector<uint8_t> memory(10, 0);
+    std::vector<uint32_t> pages;
+    std::vector<uint8_t> payload;
+
+    // First update reports everything
+    CHECK(sub.Update(memory, pages, payload));
+    CHECK(pages == std::vector<uint32_t>{0, 1, 2});
+    CHECK(payload.size() == 10);
+
+    pages.clear();
+    payload.clear();
+    CHECK_FALSE(sub.Update(memory, pages, payload));
+    CHECK(pages.empty());
+    CHECK(payload.empty());
+
+    memory[5] = 0x12;
+    memory[9] = 0x34;
+    CHECK(sub.Update(memory, pages, payload));
+    CHECK(pages == std::vector<uint32_t>{1, 2});
+    CHECK(payload == std::vector<uint8_t>{0x00, 0x12, 0x00, 0x00, 0x00, 0x34});
+}
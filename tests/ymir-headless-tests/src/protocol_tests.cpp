@@ -17,7 +17,7 @@
 
 TEST_CASE("Protocol version constants", "[protocol]") {
     CHECK(ymir::debug::kProtocolName == "ymir-debug");
-    CHECK(ymir::debug::kProtocolVersion == "0.1.0");
+    CHECK(ymir::debug::kProtocolVersion == "0.2.0");
     CHECK(ymir::debug::kStdioJsonRpcLinesTransport == "stdio-jsonrpc-lines");
 }
 
@@ -26,6 +26,13 @@ TEST_CASE("DebugTarget string round-trip", "[protocol]") {
     CHECK(ToString(ymir::debug::DebugTarget::Sh2Slave) == "sh2.slave");
 }
 
+TEST_CASE("MemorySpace string round-trip", "[protocol]") {
+    CHECK(ToString(ymir::debug::MemorySpace::Sh2Bus) == "sh2.bus");
+    CHECK(ToString(ymir::debug::MemorySpace::WorkRamHigh) == "wram.high");
+    CHECK(ToString(ymir::debug::MemorySpace::Vdp2Cram) == "vdp2.cram");
+    CHECK(ToString(ymir::debug::MemorySpace::ScspRam) == "scsp.ram");
+}
+
 TEST_CASE("ExecutionState string round-trip", "[protocol]") {
     auto s = ymir::debug::ExecutionState::Starting;
     CHECK(ToString(s) == "starting");
@@ -50,6 +57,9 @@ TEST_CASE("ErrorCode string round-trip", "[protocol]") {
 TEST_CASE("CommandMethod string round-trip", "[protocol]") {
     CHECK(ToString(ymir::debug::CommandMethod::RegsRead) == "regs.read");
     CHECK(ToString(ymir::debug::CommandMethod::MemPeek) == "mem.peek");
+    CHECK(ToString(ymir::debug::CommandMethod::MemReadBulk) == "mem.read_bulk");
+    CHECK(ToString(ymir::debug::CommandMethod::MemSubscribe) == "mem.subscribe");
+    CHECK(ToString(ymir::debug::CommandMethod::MemUnsubscribe) == "mem.unsubscribe");
     CHECK(ToString(ymir::debug::CommandMethod::DisasmAt) == "disasm.at");
     CHECK(ToString(ymir::debug::CommandMethod::ExecContinue) == "exec.continue");
     CHECK(ToString(ymir::debug::CommandMethod::ExecPause) == "exec.pause");
@@ -140,7 +150,7 @@ TEST_CASE("DebugEvent carries typed event payload", "[protocol]") {
 TEST_CASE("DebugVersionResult with nested ApplicationInfo", "[protocol]") {
     ymir::debug::DebugVersionResult version;
     version.protocol = "ymir-debug";
-    version.protocol_version = "0.1.0";
+    version.protocol_version = "0.2.0";
     version.transport = "stdio-jsonrpc-lines";
     version.application.name = "ymir-headless";
     version.application.version = "0.3.2-dev";
@@ -166,7 +176,7 @@ TEST_CASE("InstanceStatusResult includes instance_id", "[protocol]") {
 TEST_CASE("InstanceReadyEvent full shape", "[protocol]") {
     ymir::debug::InstanceReadyEvent ready;
     ready.protocol = "ymir-debug";
-    ready.protocol_version = "0.1.0";
+    ready.protocol_version = "0.2.0";
     ready.transport = "stdio-jsonrpc-lines";
     ready.instance_id = "local-001";
     ready.state = ymir::debug::ExecutionState::Paused;